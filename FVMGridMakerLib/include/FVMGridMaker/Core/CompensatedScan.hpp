@@ -0,0 +1,120 @@
+// ----------------------------------------------------------------------------
+// File: CompensatedScan.hpp
+// Author: FVMGridMaker Team
+// Version: 1.0
+// Date: 2025-10-27
+// Description: Soma prefixada (scan inclusivo) in-place com soma compensada
+//              de Neumaier, paralela por blocos de tamanho fixo e com
+//              resultado independente do número de threads.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#pragma once
+
+/**
+ * @file  CompensatedScan.hpp
+ * @brief `compensated_inclusive_scan`: v[i] ← v[0] + ... + v[i].
+ *
+ * @details
+ * Duas passadas sobre blocos de @ref kReduceBlock elementos:
+ *  1. cada bloco calcula sua soma compensada (par soma/compensação);
+ *  2. os pares são acumulados em ordem (serial, n/bloco itens) e cada bloco
+ *     refaz seu scan a partir do deslocamento exato do bloco anterior.
+ *
+ * A decomposição não depende da `ExecPolicy`, logo o resultado é idêntico
+ * bit a bit em qualquer execução. O erro de arredondamento de cada v[i]
+ * é O(ε)·|v[i]| (independente de n), em vez de O(n·ε) da soma ingênua.
+ */
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/ParallelFor.hpp>
+#include <FVMGridMaker/Core/namespace.h>
+#include <FVMGridMaker/Core/type.h>
+
+FVMGRIDMAKER_NAMESPACE_OPEN
+CORE_NAMESPACE_OPEN
+
+/// Acumulador de Neumaier (Kahan–Babuška): valor = sum + comp.
+struct CompensatedSum {
+    Real sum  {Real(0)};
+    Real comp {Real(0)};
+
+    constexpr void add(Real x) noexcept {
+        const Real t = sum + x;
+        if (std::abs(sum) >= std::abs(x)) comp += (sum - t) + x;
+        else                              comp += (x - t) + sum;
+        sum = t;
+    }
+
+    constexpr void add(const CompensatedSum& o) noexcept {
+        add(o.sum);
+        comp += o.comp;
+    }
+
+    [[nodiscard]] constexpr Real value() const noexcept { return sum + comp; }
+};
+
+/**
+ * @brief Scan inclusivo compensado, in-place.
+ *
+ * @param v      Dados (entrada: parcelas; saída: somas prefixadas).
+ * @param policy Política de execução (não altera o resultado).
+ * @param block  Tamanho do bloco (fixo: define a ordem de arredondamento).
+ */
+inline void compensated_inclusive_scan(std::span<Real> v,
+                                       ExecPolicy policy = ExecPolicy::Serial,
+                                       std::size_t block = kReduceBlock)
+{
+    const std::size_t n = v.size();
+    if (n == 0u) return;
+    block = std::max<std::size_t>(block, 1u);
+
+    const std::size_t nb    = (n + block - 1u) / block;
+    const std::size_t grain = std::max<std::size_t>(kParallelGrain / block, 1u);
+    Real* p = v.data();
+
+    // 1) somas compensadas por bloco
+    std::vector<CompensatedSum> offset(nb);
+    parallel_for_chunks(nb, policy, [&offset, p, n, block](std::size_t b, std::size_t e) {
+        for (std::size_t k = b; k < e; ++k) {
+            CompensatedSum s{};
+            const std::size_t hi = std::min(n, (k + 1u) * block);
+            for (std::size_t i = k * block; i < hi; ++i) s.add(p[i]);
+            offset[k] = s;
+        }
+    }, grain);
+
+    // 2) deslocamentos exclusivos (serial, em ordem)
+    CompensatedSum run{};
+    for (auto& o : offset) {
+        const CompensatedSum blk = o;
+        o = run;
+        run.add(blk);
+    }
+
+    // 3) scan de cada bloco a partir do seu deslocamento
+    parallel_for_chunks(nb, policy, [&offset, p, n, block](std::size_t b, std::size_t e) {
+        for (std::size_t k = b; k < e; ++k) {
+            CompensatedSum s = offset[k];
+            const std::size_t hi = std::min(n, (k + 1u) * block);
+            for (std::size_t i = k * block; i < hi; ++i) {
+                s.add(p[i]);
+                p[i] = s.value();
+            }
+        }
+    }, grain);
+}
+
+CORE_NAMESPACE_CLOSE
+FVMGRIDMAKER_NAMESPACE_CLOSE
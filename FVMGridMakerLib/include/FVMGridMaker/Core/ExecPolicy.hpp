@@ -1,11 +1,13 @@
 // ----------------------------------------------------------------------------
 // File: ExecPolicy.hpp
 // Author: FVMGridMaker Team
-// Version: 1.0
-// Date: 2025-10-25
+// Version: 1.1
+// Date: 2025-10-27
 // Description: Seleção do execution policy padrão sem dependências externas.
 //              Por default usa unseq (vetorização, sem threads).
 //              Defina FVMG_ENABLE_PSTL_PAR se quiser par_unseq (requer TBB).
+//              Também define core::ExecPolicy (Auto/Serial/Parallel), a
+//              política escolhida em tempo de execução pelo chamador.
 // License: GNU GPL v3
 // ----------------------------------------------------------------------------
 #pragma once
@@ -33,5 +35,14 @@ CORE_NAMESPACE_OPEN
   #endif
 #endif
 
+/**
+ * @brief Políticas de execução escolhidas em tempo de execução.
+ *
+ * - `Serial`   : força caminho serial.
+ * - `Parallel` : paraleliza sempre que houver mais de um thread de hardware.
+ * - `Auto`     : paraleliza apenas quando o trabalho compensa (N grande).
+ */
+enum class ExecPolicy { Auto, Serial, Parallel };
+
 CORE_NAMESPACE_CLOSE
 FVMGRIDMAKER_NAMESPACE_CLOSE
@@ -0,0 +1,190 @@
+// ----------------------------------------------------------------------------
+// File: ParallelFor.hpp
+// Author: FVMGridMaker Team
+// Version: 1.3
+// Date: 2025-10-27
+// Description: Laço paralelo por blocos contíguos com std::thread (sem
+//              dependências externas: não requer TBB/PSTL) e redução
+//              determinística (independente do número de threads).
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#pragma once
+
+/**
+ * @file  ParallelFor.hpp
+ * @brief `parallel_for_chunks`: divide [0,n) em blocos contíguos e executa
+ *        `f(begin, end)` em cada bloco.
+ *
+ * @details
+ * O bloco 0 roda no thread chamador; os demais em `std::thread`s criados
+ * para a chamada. Os blocos são contíguos e disjuntos, de modo que laços
+ * elemento a elemento produzem resultado idêntico (bit a bit) ao serial.
+ * A primeira exceção lançada por um bloco é relançada no chamador.
+ *
+ * Aninhamento: dentro de um bloco de uma chamada com mais de um bloco,
+ * `Auto` vale 1 bloco (os threads de fora já ocupam o hardware; sem isso,
+ * um laço `Auto` por item criaria hw×hw threads). `Parallel` explícito
+ * continua valendo.
+ *
+ * `deterministic_reduce` reduz por blocos de tamanho FIXO e combina os
+ * parciais em ordem: o arredondamento não depende de quantos threads rodam.
+ */
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/namespace.h>
+
+FVMGRIDMAKER_NAMESPACE_OPEN
+CORE_NAMESPACE_OPEN
+
+/// Elementos mínimos por thread em `ExecPolicy::Auto`.
+inline constexpr std::size_t kParallelGrain = std::size_t(1) << 16;
+
+DETAIL_NAMESPACE_OPEN
+
+/// `true` no thread que executa um bloco de um laço com mais de um bloco.
+inline thread_local bool in_parallel_region = false;
+
+/// Marca o thread corrente como dentro de um laço paralelo (restaura na saída).
+struct ParallelRegion {
+    bool outer{in_parallel_region};
+    ParallelRegion() noexcept { in_parallel_region = true; }
+    ~ParallelRegion() { in_parallel_region = outer; }
+    ParallelRegion(const ParallelRegion&) = delete;
+    ParallelRegion& operator=(const ParallelRegion&) = delete;
+};
+
+DETAIL_NAMESPACE_CLOSE
+
+/// Threads de hardware disponíveis (>= 1). Consultado uma vez: na glibc,
+/// hardware_concurrency() lê /sys a cada chamada (~µs por malha pequena).
+[[nodiscard]] inline std::size_t hardware_threads() noexcept {
+    static const std::size_t hw = [] {
+        const unsigned n = std::thread::hardware_concurrency();
+        return n == 0u ? std::size_t(1) : static_cast<std::size_t>(n);
+    }();
+    return hw;
+}
+
+/**
+ * @brief Número de blocos que `parallel_for_chunks` usará para @p n itens.
+ *
+ * - `Serial`   → 1
+ * - `Parallel` → min(threads, n)
+ * - `Auto`     → min(threads, n / grain), no mínimo 1; 1 dentro de um
+ *                 bloco de outro laço paralelo
+ */
+[[nodiscard]] inline std::size_t
+parallel_chunks(std::size_t n, ExecPolicy policy,
+                std::size_t grain = kParallelGrain) noexcept {
+    if (n == 0u || policy == ExecPolicy::Serial) return 1u;
+    if (policy == ExecPolicy::Auto && detail::in_parallel_region) return 1u;
+    const std::size_t hw = hardware_threads();
+    const std::size_t by_work =
+        (policy == ExecPolicy::Parallel) ? n : n / std::max<std::size_t>(grain, 1u);
+    return std::max<std::size_t>(1u, std::min(hw, by_work));
+}
+
+/**
+ * @brief Executa `f(begin, end)` sobre blocos contíguos de [0, n).
+ *
+ * @param n      Tamanho do intervalo.
+ * @param policy Política de execução.
+ * @param f      Callable `void(std::size_t begin, std::size_t end)`.
+ * @param grain  Elementos mínimos por bloco em `Auto`.
+ */
+template <class F>
+void parallel_for_chunks(std::size_t n, ExecPolicy policy, F&& f,
+                         std::size_t grain = kParallelGrain) {
+    if (n == 0u) return;
+
+    const std::size_t T = parallel_chunks(n, policy, grain);
+    if (T <= 1u) {
+        f(std::size_t(0), n);
+        return;
+    }
+
+    const std::size_t base = n / T;
+    const std::size_t rem  = n % T;
+    auto bounds = [base, rem](std::size_t t) noexcept {
+        return t * base + std::min(t, rem);
+    };
+
+    std::vector<std::exception_ptr> errors(T);
+    std::vector<std::thread> workers;
+    workers.reserve(T - 1u);
+
+    for (std::size_t t = 1; t < T; ++t) {
+        workers.emplace_back([&f, &errors, &bounds, t] {
+            const detail::ParallelRegion region;
+            try {
+                f(bounds(t), bounds(t + 1u));
+            } catch (...) {
+                errors[t] = std::current_exception();
+            }
+        });
+    }
+
+    {
+        const detail::ParallelRegion region;
+        try {
+            f(bounds(0), bounds(1));
+        } catch (...) {
+            errors[0] = std::current_exception();
+        }
+    }
+
+    for (auto& w : workers) w.join();
+
+    for (auto& e : errors) {
+        if (e) std::rethrow_exception(e);
+    }
+}
+
+/// Tamanho fixo dos blocos de `deterministic_reduce`.
+inline constexpr std::size_t kReduceBlock = 4096;
+
+/**
+ * @brief Redução com resultado independente do número de threads.
+ *
+ * @param n        Tamanho do intervalo [0, n).
+ * @param policy   Política de execução.
+ * @param init     Elemento neutro de @p join.
+ * @param block_fn Callable `T(std::size_t begin, std::size_t end)` que reduz
+ *                 um bloco.
+ * @param join     Callable `T(const T&, const T&)` (aplicado em ordem).
+ * @param block    Tamanho do bloco (fixo: define a ordem de arredondamento).
+ */
+template <class T, class BlockFn, class JoinFn>
+T deterministic_reduce(std::size_t n, ExecPolicy policy, T init,
+                       BlockFn&& block_fn, JoinFn&& join,
+                       std::size_t block = kReduceBlock) {
+    if (n == 0u) return init;
+    block = std::max<std::size_t>(block, 1u);
+
+    const std::size_t nb = (n + block - 1u) / block;
+    std::vector<T> partial(nb, init);
+    parallel_for_chunks(nb, policy, [&](std::size_t b, std::size_t e) {
+        for (std::size_t k = b; k < e; ++k) {
+            partial[k] = block_fn(k * block, std::min(n, (k + 1u) * block));
+        }
+    }, std::max<std::size_t>(kParallelGrain / block, 1u));
+
+    T acc = init;
+    for (const T& p : partial) acc = join(acc, p);
+    return acc;
+}
+
+CORE_NAMESPACE_CLOSE
+FVMGRIDMAKER_NAMESPACE_CLOSE
@@ -1,7 +1,7 @@
 // ----------------------------------------------------------------------------
 // File: namespace.h
 // Author: FVMGridMaker Team
-// Version: 1.2
+// Version: 1.3
 // Date: 2025-10-26
 // Description: Macros para abrir/fechar a hierarquia de namespaces usada
 //              pelo projeto FVMGridMaker, evitando erros de escopo e
@@ -13,7 +13,7 @@
 /**
  * @file    namespace.h
  * @author  FVMGridMaker Team
- * @version 1.2
+ * @version 1.3
  * @date    2025-10-26
  *
  * @brief   Macros auxiliares para abrir/fechar a hierarquia de namespaces do
@@ -45,6 +45,7 @@
 #define PATTERNS_NS            patterns
 #define CENTERING_NS           centering
 #define DISTRIBUTION_NS        distribution
+#define IO_NS                  io
 #define ERROR_NS               error
 #define CORE_NS                core
 #define DETAIL_NS              detail
@@ -61,6 +62,7 @@
 #define PATTERNS_NAMESPACE_OPEN               namespace PATTERNS_NS {
 #define CENTERING_NAMESPACE_OPEN              namespace CENTERING_NS {
 #define DISTRIBUTION_NAMESPACE_OPEN           namespace DISTRIBUTION_NS {
+#define IO_NAMESPACE_OPEN                     namespace IO_NS {
 #define ERROR_NAMESPACE_OPEN                  namespace ERROR_NS {
 #define CORE_NAMESPACE_OPEN                   namespace CORE_NS {
 #define DETAIL_NAMESPACE_OPEN                 namespace DETAIL_NS {
@@ -77,6 +79,7 @@
 #define PATTERNS_NAMESPACE_CLOSE              }
 #define CENTERING_NAMESPACE_CLOSE             }
 #define DISTRIBUTION_NAMESPACE_CLOSE          }
+#define IO_NAMESPACE_CLOSE                    }
 #define ERROR_NAMESPACE_CLOSE                 }
 #define CORE_NAMESPACE_CLOSE                  }
 #define DETAIL_NAMESPACE_CLOSE                }
@@ -96,6 +99,10 @@
 #define FVMG_GRID1D_UTILS_OPEN      FVMGRIDMAKER_NAMESPACE_OPEN GRID_NAMESPACE_OPEN GRID1D_NAMESPACE_OPEN UTILS_NAMESPACE_OPEN
 #define FVMG_GRID1D_UTILS_CLOSE     UTILS_NAMESPACE_CLOSE GRID1D_NAMESPACE_CLOSE GRID_NAMESPACE_CLOSE FVMGRIDMAKER_NAMESPACE_CLOSE
 
+// grid1d::io
+#define FVMG_GRID1D_IO_OPEN         FVMGRIDMAKER_NAMESPACE_OPEN GRID_NAMESPACE_OPEN GRID1D_NAMESPACE_OPEN IO_NAMESPACE_OPEN
+#define FVMG_GRID1D_IO_CLOSE        IO_NAMESPACE_CLOSE GRID1D_NAMESPACE_CLOSE GRID_NAMESPACE_CLOSE FVMGRIDMAKER_NAMESPACE_CLOSE
+
 // grid1d::patterns (raiz dos padrões)
 #define FVMG_GRID1D_PATTERNS_OPEN   FVMGRIDMAKER_NAMESPACE_OPEN GRID_NAMESPACE_OPEN GRID1D_NAMESPACE_OPEN PATTERNS_NAMESPACE_OPEN
 #define FVMG_GRID1D_PATTERNS_CLOSE  PATTERNS_NAMESPACE_CLOSE GRID1D_NAMESPACE_CLOSE GRID_NAMESPACE_CLOSE FVMGRIDMAKER_NAMESPACE_CLOSE
@@ -1,7 +1,7 @@
 // ============================================================================
 // File: FileErrors.h
 // Project: FVMGridMaker
-// Version: 1.6 (Remove thread_local from constexpr function)
+// Version: 1.7 (InvalidFormat / ChecksumMismatch para arquivos de malha)
 // Description: Erros de E/S (File) + especialização de ErrorTraits.
 // License: GNU GPL v3
 // ============================================================================
@@ -35,7 +35,8 @@ ERROR_NAMESPACE_OPEN
 enum class FileErr : std::uint16_t {
     FileNotFound = 1, AccessDenied = 2, ReadError = 3,
     WriteError = 4, InvalidPath = 5,
-    _Min = FileNotFound, _Max = InvalidPath
+    InvalidFormat = 6, ChecksumMismatch = 7,
+    _Min = FileNotFound, _Max = ChecksumMismatch
 };
 
 DETAIL_NAMESPACE_OPEN
@@ -60,6 +61,10 @@ constexpr FileErrorInfo get_file_error_info_data(FileErr e) {
             return {sv{"FILE_WRITE_ERROR"}, Severity::Error, sv{"An error occurred while writing to the file: {path}."}, sv{"Ocorreu um erro ao escrever no arquivo: {path}."}};
         case FileErr::InvalidPath:
             return {sv{"FILE_INVALID_PATH"}, Severity::Error, sv{"The provided path is invalid: {path}."}, sv{"O caminho fornecido é inválido: {path}."}};
+        case FileErr::InvalidFormat:
+            return {sv{"FILE_INVALID_FORMAT"}, Severity::Error, sv{"Invalid or unsupported file format: {path} ({what})."}, sv{"Formato de arquivo inválido ou não suportado: {path} ({what})."}};
+        case FileErr::ChecksumMismatch:
+            return {sv{"FILE_CHECKSUM_MISMATCH"}, Severity::Error, sv{"Checksum mismatch (corrupted data): {path}."}, sv{"Checksum divergente (dados corrompidos): {path}."}};
         default:
              return {sv{}, Severity::Trace, sv{}, sv{}}; // Valor padrão seguro
     }
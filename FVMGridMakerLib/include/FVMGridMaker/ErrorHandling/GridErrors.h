@@ -2,7 +2,7 @@
 // File: GridErrors.h
 // Project: FVMGridMaker
 // Author: FVMGridMaker Team
-// Version: 1.0
+// Version: 1.3
 // Date: 2025-10-26
 // Description: Erros relacionados a malhas (Grid) + especialização de
 //              ErrorTraits. Destinado a validações de Builder/Patterns
@@ -51,8 +51,10 @@ enum class GridErr : std::uint16_t {
     ExecPolicyUnsupported    = 12,  // política de execução indisponível
     ParallelBackendMissing   = 13,  // PSTL pedida, backend ausente (ex.: TBB)
     BuilderStateInvalid      = 14,  // Builder usado em estado inconsistente
+    RegistryFrozen           = 15,  // registro de distribuições já congelado
+    CenterOutsideCell        = 16,  // centro fora de [xf[i], xf[i+1]]
     _Min = InvalidN,
-    _Max = BuilderStateInvalid
+    _Max = CenterOutsideCell
 };
 
 // ----------------------------------------------------------------------------
@@ -102,8 +104,8 @@ constexpr GridErrorInfo get_grid_error_info_data(GridErr e) {
 
         case GridErr::DegenerateMesh:
             return {sv{"GRID_DEGENERATE_MESH"}, Severity::Error,
-                    sv{"Degenerate mesh: at least one cell size is non-positive."},
-                    sv{"Malha degenerada: ao menos um tamanho de célula é não-positivo."}};
+                    sv{"Degenerate mesh: non-positive cell size at index {i}."},
+                    sv{"Malha degenerada: tamanho de célula não-positivo no índice {i}."}};
 
         case GridErr::NonIncreasingFaces:
             return {sv{"GRID_NON_INCREASING_FACES"}, Severity::Error,
@@ -139,6 +141,16 @@ constexpr GridErrorInfo get_grid_error_info_data(GridErr e) {
             return {sv{"GRID_BUILDER_STATE_INVALID"}, Severity::Error,
                     sv{"Grid1DBuilder used in an invalid or incomplete state."},
                     sv{"Grid1DBuilder usado em estado inválido ou incompleto."}};
+
+        case GridErr::RegistryFrozen:
+            return {sv{"GRID_REGISTRY_FROZEN"}, Severity::Error,
+                    sv{"Distribution registry is frozen; registration rejected ({where})."},
+                    sv{"Registro de distribuições congelado; registro rejeitado ({where})."}};
+
+        case GridErr::CenterOutsideCell:
+            return {sv{"GRID_CENTER_OUTSIDE_CELL"}, Severity::Error,
+                    sv{"Center {i} lies outside its cell [xf[{i}], xf[{i}+1]]."},
+                    sv{"Centro {i} fora da sua célula [xf[{i}], xf[{i}+1]]."}};
         default:
             return {sv{}, Severity::Trace, sv{}, sv{}};
     }
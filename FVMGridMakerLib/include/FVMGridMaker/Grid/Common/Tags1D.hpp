@@ -1,7 +1,7 @@
 // ----------------------------------------------------------------------------
 // File: Tags1D.hpp
 // Author: FVMGridMaker Team
-// Version: 1.4
+// Version: 1.7
 // Date: 2025-10-26
 // Description: Tags (1D) para seleção de centralização e distribuição,
 //              geradas via X-Macro (suporta extensão do usuário).
@@ -17,7 +17,8 @@
  * @details
  * Define:
  *   - `CenteringTag`     (FaceCentered, CellCentered)
- *   - `DistributionTag`  (Uniform1D, Random1D)
+ *   - `DistributionTag`  (Uniform1D, Random1D, Geometric1D, Vinokur1D,
+ *                         Equidistribution1D)
  *
  * As listas são geradas por X-Macros. O usuário pode definir, antes de incluir:
  *   - FVMG_CENTERINGS(X)
@@ -50,7 +51,10 @@ GRID_NAMESPACE_OPEN
 #ifndef FVMG_DISTRIBUTIONS
   #define FVMG_DISTRIBUTIONS(X) \
       X(Uniform1D)              \
-      X(Random1D)
+      X(Random1D)               \
+      X(Geometric1D)            \
+      X(Vinokur1D)              \
+      X(Equidistribution1D)
 #endif
 
 // -----------------------------------------------------------------------------
@@ -0,0 +1,153 @@
+// ----------------------------------------------------------------------------
+// File: AnalyticGrid1D.h
+// Author: FVMGridMaker Team
+// Version: 1.1
+// Date: 2025-10-27
+// Description: Malha 1D preguiçosa para distribuições em forma fechada:
+//              guarda só N, A e B e calcula faces, centros e deltas sob
+//              demanda; materializa um Grid1D quando spans são necessários.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#pragma once
+
+/**
+ * @file  AnalyticGrid1D.h
+ * @brief `AnalyticGrid1D<D>` e os aliases `UniformGrid1D` e `GeometricGrid1D`.
+ *
+ * @details
+ * Memória O(1) em vez dos quatro arrays O(N) do Grid1D: um laço sobre
+ * `face(i)` / `center(i)` / ... fica limitado por cálculo, não por banda.
+ *
+ * `D` fornece a face em forma fechada, `D::face(i, N, A, B)`. Os demais
+ * valores seguem as expressões do fechamento face-centered
+ * (ClosureKernel1D), logo coincidem bit a bit com
+ * `Grid1DBuilder(...).setCentering(FaceCentered).build()` da mesma
+ * distribuição (com as mesmas opções de ponto flutuante):
+ *  - xc[i] = 0.5*(xf[i] + xf[i+1]),  dF[i] = xf[i+1] - xf[i],
+ *  - dC = { xc0-xf0, xc1-xc0, ..., xfN-xcN-1 }.
+ *
+ * Não expõe spans (não há armazenamento); para os templates `GridLike`
+ * (Grid1DStats, basic_exec, gravação em arquivo) use `materialize()`.
+ */
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/ParallelFor.hpp>
+#include <FVMGridMaker/Core/namespace.h>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1DStorage.h>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Centering/ClosureKernel1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Geometric1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Uniform1D.hpp>
+
+FVMGRIDMAKER_NAMESPACE_OPEN
+GRID_NAMESPACE_OPEN
+GRID1D_NAMESPACE_OPEN
+API_NAMESPACE_OPEN
+
+/// Distribuição com face em forma fechada: `d.face(i, N, A, B) -> Real`.
+template <class D>
+concept ClosedFormFaces1D =
+    requires(const D& d, std::size_t i, std::size_t n, core::Real a, core::Real b) {
+        { d.face(i, n, a, b) } -> std::convertible_to<core::Real>;
+    };
+
+/**
+ * @brief Malha 1D analítica: N, A, B (+ parâmetros de @p D), sem arrays.
+ */
+template <ClosedFormFaces1D D>
+class AnalyticGrid1D {
+public:
+    using Real  = ::FVMGridMaker::core::Real;
+    using Index = ::FVMGridMaker::core::Index;
+
+    AnalyticGrid1D() = default;
+
+    /// Malha de @p n volumes em [a, b] (n > 0, a < b).
+    AnalyticGrid1D(Index n, Real a, Real b, D dist = D{}) noexcept
+        : m_n(n), m_a(a), m_b(b), m_dist(dist)
+    {
+        assert(n > 0 && a < b);
+    }
+
+    // Info agregada
+    Index nVolumes() const noexcept { return m_n; }
+    Index nFaces()   const noexcept { return m_n > 0 ? m_n + 1u : 0u; }
+    bool  empty()    const noexcept { return m_n == 0; }
+
+    // Acesso escalar (sem checagem de faixa), calculado sob demanda
+    Real face(Index i) const noexcept {
+        return static_cast<Real>(m_dist.face(i, m_n, m_a, m_b));
+    }
+    Real center(Index i) const noexcept {
+        return Real(0.5) * (face(i) + face(i + 1u));
+    }
+    Real deltaFace(Index i) const noexcept {
+        return face(i + 1u) - face(i);
+    }
+    Real deltaCenter(Index i) const noexcept {
+        if (i == 0)   return center(0) - face(0);
+        if (i == m_n) return face(m_n) - center(m_n - 1u);
+        return center(i) - center(i - 1u);
+    }
+
+    /// Parâmetros da distribuição.
+    const D& distribution() const noexcept { return m_dist; }
+
+    /**
+     * @brief Materializa os quatro arrays em um Grid1D: faces em forma
+     *        fechada + ClosureKernel1D (mesmos valores dos acessores
+     *        escalares, para qualquer @p policy). Se @p D oferece
+     *        `facesRange(N, A, B, first, out)`, as faces vêm do kernel em
+     *        faixa da distribuição.
+     */
+    Grid1D materialize(core::ExecPolicy policy = core::ExecPolicy::Auto) const {
+        if (m_n == 0) return Grid1D{};
+
+        Grid1DStorage s(m_n);
+        const std::span<Real> xf = s.faces();
+
+        // Cópia local: os parâmetros não podem ser aliasados pelas escritas
+        // e saem do laço (ex.: dx da uniforme)
+        const AnalyticGrid1D g = *this;
+        core::parallel_for_chunks(xf.size(), policy, [=](std::size_t b, std::size_t e) {
+            if constexpr (requires { g.m_dist.facesRange(g.m_n, g.m_a, g.m_b, b, xf); }) {
+                g.m_dist.facesRange(g.m_n, g.m_a, g.m_b, b, xf.subspan(b, e - b));
+            } else {
+                for (std::size_t i = b; i < e; ++i) xf[i] = g.face(i);
+            }
+        });
+        patterns::centering::close_from_faces(xf, s.centers(), s.deltasFaces(),
+                                              s.deltasCenters(), policy);
+        return Grid1D(std::move(s));
+    }
+
+private:
+    Index m_n{0};
+    Real  m_a{0};
+    Real  m_b{1};
+    [[no_unique_address]] D m_dist{};
+};
+
+/// Malha uniforme preguiçosa: xf[i] = A + i·(B-A)/N.
+using UniformGrid1D = AnalyticGrid1D<patterns::distribution::Uniform1D>;
+
+/// Malha geométrica preguiçosa: xf[i] = A + L·(r^i-1)/(r^N-1).
+using GeometricGrid1D = AnalyticGrid1D<patterns::distribution::Geometric1D>;
+
+API_NAMESPACE_CLOSE
+GRID1D_NAMESPACE_CLOSE
+GRID_NAMESPACE_CLOSE
+FVMGRIDMAKER_NAMESPACE_CLOSE
@@ -1,9 +1,11 @@
 // ----------------------------------------------------------------------------
 // File: Grid1D.h
 // Author: FVMGridMaker Team
-// Version: 2.0
-// Date: 2025-10-25
+// Version: 2.4
+// Date: 2025-10-27
 // Description: API leve e simples para Grid1D (faces, centros, deltas).
+//              Os quatro vetores vivem em uma única arena alinhada
+//              (Grid1DStorage).
 // License: GNU GPL v3
 // ----------------------------------------------------------------------------
 #pragma once
@@ -11,6 +13,7 @@
 // ----------------------------------------------------------------------------
 // includes C++
 // ----------------------------------------------------------------------------
+#include <algorithm>
 #include <span>
 #include <vector>
 #include <cstddef>
@@ -21,6 +24,9 @@
 // ----------------------------------------------------------------------------
 #include <FVMGridMaker/Core/namespace.h>
 #include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/ErrorHandling/ErrorHandling.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1DStorage.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1DView.h>
 
 FVMGRIDMAKER_NAMESPACE_OPEN
 GRID_NAMESPACE_OPEN
@@ -41,46 +47,73 @@ public:
     Grid1D& operator=(Grid1D&&) noexcept  = default;
     ~Grid1D()                             = default;
 
-    // Construtor usado pelo Builder (precisa ser público para evitar o erro “private within this context”)
+    /// Alinhamento (bytes) garantido para o início de cada span.
+    static constexpr std::size_t kAlignment = Grid1DStorage::kAlignment;
+
+    /// Construtor usado pelos builders: assume a arena já preenchida.
+    explicit Grid1D(Grid1DStorage storage) noexcept
+        : m_storage(std::move(storage))
+    {}
+
+    // Construtor a partir de vetores (copia para a arena; tamanhos N+1, N, N, N+1;
+    // tamanhos inconsistentes → FVMG_ERROR(CoreErr::InvalidArgument); sem
+    // exceção (Policy::Status) a malha fica vazia)
     explicit Grid1D(std::vector<Real> faces,
                     std::vector<Real> centers,
                     std::vector<Real> dF,
                     std::vector<Real> dC)
-        : m_faces(std::move(faces))
-        , m_centers(std::move(centers))
-        , m_dF(std::move(dF))
-        , m_dC(std::move(dC))
-    {}
+    {
+        if (faces.empty() && centers.empty()) return;
 
-    // Acesso por span (somente leitura)
-    std::span<const Real> faces() const noexcept {
-        return std::span<const Real>(m_faces.data(), m_faces.size());
-    }
-    std::span<const Real> centers() const noexcept {
-        return std::span<const Real>(m_centers.data(), m_centers.size());
-    }
-    std::span<const Real> deltasFaces() const noexcept {
-        return std::span<const Real>(m_dF.data(), m_dF.size());
-    }
-    std::span<const Real> deltasCenters() const noexcept {
-        return std::span<const Real>(m_dC.data(), m_dC.size());
+        // Tamanhos checados também em release: std::copy escreve na arena
+        const std::size_t N = centers.size();
+        if (faces.size() != N + 1u || dF.size() != N || dC.size() != N + 1u) {
+            FVMG_ERROR(error::CoreErr::InvalidArgument, {
+                {"where", "Grid1D::Grid1D(vectors)"},
+                {"what",  "vector sizes must be (N+1, N, N, N+1)"}
+            });
+            return;   // Policy::Status: malha vazia
+        }
+
+        Grid1DStorage s(static_cast<Index>(N));
+        std::copy(faces.begin(),   faces.end(),   s.faces().begin());
+        std::copy(centers.begin(), centers.end(), s.centers().begin());
+        std::copy(dF.begin(),      dF.end(),      s.deltasFaces().begin());
+        std::copy(dC.begin(),      dC.end(),      s.deltasCenters().begin());
+        m_storage = std::move(s);
     }
 
+    // Acesso por span (somente leitura)
+    std::span<const Real> faces() const noexcept         { return m_storage.faces(); }
+    std::span<const Real> centers() const noexcept       { return m_storage.centers(); }
+    std::span<const Real> deltasFaces() const noexcept   { return m_storage.deltasFaces(); }
+    std::span<const Real> deltasCenters() const noexcept { return m_storage.deltasCenters(); }
+
     // Info agregada
-    Index nVolumes() const noexcept { return static_cast<Index>(m_centers.size()); }
-    Index nFaces()   const noexcept { return static_cast<Index>(m_faces.size());   }
+    Index nVolumes() const noexcept { return static_cast<Index>(centers().size()); }
+    Index nFaces()   const noexcept { return static_cast<Index>(faces().size());   }
 
     // Acesso escalar (sem checagem de faixa)
-    Real face(Index i) const noexcept   { return m_faces[static_cast<std::size_t>(i)]; }
-    Real center(Index i) const noexcept { return m_centers[static_cast<std::size_t>(i)]; }
-    Real deltaFace(Index i) const noexcept { return m_dF[static_cast<std::size_t>(i)]; }
-    Real deltaCenter(Index i) const noexcept { return m_dC[static_cast<std::size_t>(i)]; }
+    Real face(Index i) const noexcept        { return faces()[static_cast<std::size_t>(i)]; }
+    Real center(Index i) const noexcept      { return centers()[static_cast<std::size_t>(i)]; }
+    Real deltaFace(Index i) const noexcept   { return deltasFaces()[static_cast<std::size_t>(i)]; }
+    Real deltaCenter(Index i) const noexcept { return deltasCenters()[static_cast<std::size_t>(i)]; }
+
+    /// Visão não-proprietária dos quatro spans (vale enquanto o Grid1D viver).
+    Grid1DView view() const& noexcept {
+        return Grid1DView(faces(), centers(), deltasFaces(), deltasCenters());
+    }
+    Grid1DView view() const&& = delete;   // evita visão de temporário
+
+    operator Grid1DView() const& noexcept { return view(); }
+    operator Grid1DView() const&& = delete;
+
+    /// Arena subjacente (somente leitura).
+    const Grid1DStorage& storage() const noexcept { return m_storage; }
 
 private:
-    std::vector<Real> m_faces;   // tamanho N+1
-    std::vector<Real> m_centers; // tamanho N
-    std::vector<Real> m_dF;      // tamanho N
-    std::vector<Real> m_dC;      // tamanho N+1
+    // faces (N+1) | centers (N) | dF (N) | dC (N+1) — uma única alocação
+    Grid1DStorage m_storage;
 };
 
 API_NAMESPACE_CLOSE
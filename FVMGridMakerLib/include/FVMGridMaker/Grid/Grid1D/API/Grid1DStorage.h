@@ -0,0 +1,169 @@
+// ----------------------------------------------------------------------------
+// File: Grid1DStorage.h
+// Author: FVMGridMaker Team
+// Version: 1.0
+// Date: 2025-10-27
+// Description: Armazenamento SoA do Grid1D em uma única arena alinhada
+//              (faces, centros, dF, dC), com cada vetor iniciando em uma
+//              linha de cache (64 bytes).
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#pragma once
+
+/**
+ * @file   Grid1DStorage.h
+ * @brief  Arena única, alinhada a 64 bytes, para os quatro vetores do Grid1D.
+ *
+ * @details
+ * Layout (SoA, uma alocação):
+ * @code
+ *  | faces (N+1) | pad | centers (N) | pad | dF (N) | pad | dC (N+1) | pad |
+ * @endcode
+ * Cada bloco começa em múltiplo de @ref Grid1DStorage::kAlignment bytes, o que
+ * permite cargas vetoriais alinhadas nos laços de fluxo. O padding é zerado.
+ */
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <utility>
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/namespace.h>
+#include <FVMGridMaker/Core/type.h>
+
+FVMGRIDMAKER_NAMESPACE_OPEN
+GRID_NAMESPACE_OPEN
+GRID1D_NAMESPACE_OPEN
+API_NAMESPACE_OPEN
+
+class Grid1DStorage {
+public:
+    using Real  = ::FVMGridMaker::core::Real;
+    using Index = ::FVMGridMaker::core::Index;
+
+    /// Alinhamento (bytes) do início da arena e de cada vetor.
+    static constexpr std::size_t kAlignment = 64;
+
+    /// Quantidade de Real por linha de cache (granularidade do padding).
+    static constexpr std::size_t kLane = kAlignment / sizeof(Real);
+
+    static_assert(kAlignment % sizeof(Real) == 0,
+                  "Grid1DStorage: kAlignment deve ser múltiplo de sizeof(Real)");
+
+    // ctors básicos
+    Grid1DStorage() = default;
+
+    /// Aloca a arena para N volumes (N+1 faces).
+    explicit Grid1DStorage(Index nVolumes)
+        : m_n(nVolumes)
+    {
+        const std::size_t n = static_cast<std::size_t>(nVolumes);
+        m_offCenters = padded(n + 1u);
+        m_offDF      = m_offCenters + padded(n);
+        m_offDC      = m_offDF      + padded(n);
+        m_size       = m_offDC      + padded(n + 1u);
+
+        m_arena.reset(static_cast<Real*>(
+            ::operator new(m_size * sizeof(Real), std::align_val_t{kAlignment})));
+        std::fill_n(m_arena.get(), m_size, Real(0));
+    }
+
+    Grid1DStorage(const Grid1DStorage& other)
+        : Grid1DStorage()
+    {
+        if (!other.m_arena) return;
+        *this = Grid1DStorage(other.m_n);
+        std::copy_n(other.m_arena.get(), m_size, m_arena.get());
+    }
+
+    Grid1DStorage& operator=(const Grid1DStorage& other) {
+        if (this != &other) {
+            Grid1DStorage tmp(other);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    Grid1DStorage(Grid1DStorage&& other) noexcept { swap(other); }
+
+    Grid1DStorage& operator=(Grid1DStorage&& other) noexcept {
+        Grid1DStorage tmp(std::move(other));
+        swap(tmp);
+        return *this;
+    }
+
+    ~Grid1DStorage() = default;
+
+    void swap(Grid1DStorage& other) noexcept {
+        using std::swap;
+        swap(m_arena,      other.m_arena);
+        swap(m_n,          other.m_n);
+        swap(m_offCenters, other.m_offCenters);
+        swap(m_offDF,      other.m_offDF);
+        swap(m_offDC,      other.m_offDC);
+        swap(m_size,       other.m_size);
+    }
+
+    // Info agregada
+    [[nodiscard]] bool  empty()    const noexcept { return !m_arena; }
+    [[nodiscard]] Index nVolumes() const noexcept { return empty() ? Index(0) : m_n; }
+
+    /// Tamanho total da arena em bytes (inclui padding).
+    [[nodiscard]] std::size_t bytes() const noexcept { return m_size * sizeof(Real); }
+
+    // Acesso mutável (usado pelos builders)
+    std::span<Real> faces()         noexcept { return block(0,            nFacesRaw()); }
+    std::span<Real> centers()       noexcept { return block(m_offCenters, nCellsRaw()); }
+    std::span<Real> deltasFaces()   noexcept { return block(m_offDF,      nCellsRaw()); }
+    std::span<Real> deltasCenters() noexcept { return block(m_offDC,      nFacesRaw()); }
+
+    // Acesso somente leitura
+    std::span<const Real> faces()         const noexcept { return cblock(0,            nFacesRaw()); }
+    std::span<const Real> centers()       const noexcept { return cblock(m_offCenters, nCellsRaw()); }
+    std::span<const Real> deltasFaces()   const noexcept { return cblock(m_offDF,      nCellsRaw()); }
+    std::span<const Real> deltasCenters() const noexcept { return cblock(m_offDC,      nFacesRaw()); }
+
+    /// Arredonda @p n para o próximo múltiplo de @ref kLane.
+    static constexpr std::size_t padded(std::size_t n) noexcept {
+        return (n + kLane - 1u) / kLane * kLane;
+    }
+
+private:
+    struct AlignedDelete {
+        void operator()(Real* p) const noexcept {
+            ::operator delete(p, std::align_val_t{kAlignment});
+        }
+    };
+
+    std::size_t nFacesRaw() const noexcept { return empty() ? 0u : static_cast<std::size_t>(m_n) + 1u; }
+    std::size_t nCellsRaw() const noexcept { return empty() ? 0u : static_cast<std::size_t>(m_n); }
+
+    std::span<Real> block(std::size_t off, std::size_t n) noexcept {
+        return empty() ? std::span<Real>{} : std::span<Real>(m_arena.get() + off, n);
+    }
+    std::span<const Real> cblock(std::size_t off, std::size_t n) const noexcept {
+        return empty() ? std::span<const Real>{} : std::span<const Real>(m_arena.get() + off, n);
+    }
+
+    std::unique_ptr<Real, AlignedDelete> m_arena{};
+    Index       m_n          {0};
+    std::size_t m_offCenters {0};
+    std::size_t m_offDF      {0};
+    std::size_t m_offDC      {0};
+    std::size_t m_size       {0};   // em elementos Real
+};
+
+inline void swap(Grid1DStorage& a, Grid1DStorage& b) noexcept { a.swap(b); }
+
+API_NAMESPACE_CLOSE
+GRID1D_NAMESPACE_CLOSE
+GRID_NAMESPACE_CLOSE
+FVMGRIDMAKER_NAMESPACE_CLOSE
@@ -0,0 +1,98 @@
+// ----------------------------------------------------------------------------
+// File: Grid1DView.h
+// Author: FVMGridMaker Team
+// Version: 1.1
+// Date: 2025-10-27
+// Description: Visão não-proprietária de uma malha 1D (faces, centros,
+//              deltas) sobre memória externa, com a mesma API de spans do
+//              Grid1D (ex.: arquivo mapeado em memória, arrays de um
+//              solver ou buffers de Python/NumPy).
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#pragma once
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <cassert>
+#include <cstddef>
+#include <span>
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/namespace.h>
+#include <FVMGridMaker/Core/type.h>
+
+FVMGRIDMAKER_NAMESPACE_OPEN
+GRID_NAMESPACE_OPEN
+GRID1D_NAMESPACE_OPEN
+API_NAMESPACE_OPEN
+
+/**
+ * @brief Malha 1D sem posse dos dados: quatro spans somente leitura.
+ *
+ * Cópia barata (quatro ponteiros + tamanhos). O chamador garante que a
+ * memória observada vive mais que a visão.
+ *
+ * Expõe os mesmos acessores de `api::Grid1D`, logo serve a todos os
+ * templates `GridLike` (Grid1DStats, basic_exec, ...). Um Grid1D converte
+ * implicitamente para Grid1DView (ver `Grid1D::view()`).
+ */
+class Grid1DView {
+public:
+    using Real  = ::FVMGridMaker::core::Real;
+    using Index = ::FVMGridMaker::core::Index;
+
+    Grid1DView() = default;
+
+    /// Visão sobre arrays existentes (tamanhos N+1, N, N, N+1).
+    Grid1DView(std::span<const Real> faces,
+               std::span<const Real> centers,
+               std::span<const Real> dF,
+               std::span<const Real> dC) noexcept
+        : m_faces(faces), m_centers(centers), m_dF(dF), m_dC(dC)
+    {
+        assert((faces.empty() && centers.empty()) ||
+               (faces.size() == centers.size() + 1u &&
+                dF.size()    == centers.size()      &&
+                dC.size()    == centers.size() + 1u));
+    }
+
+    /// Visão sobre ponteiros crus de @p n volumes (tamanhos n+1, n, n, n+1).
+    Grid1DView(const Real* faces, const Real* centers,
+               const Real* dF, const Real* dC, Index n) noexcept
+        : Grid1DView(std::span<const Real>(faces,   n > 0 ? n + 1u : 0u),
+                     std::span<const Real>(centers, n),
+                     std::span<const Real>(dF,      n),
+                     std::span<const Real>(dC,      n > 0 ? n + 1u : 0u))
+    {}
+
+    // Acesso por span (somente leitura)
+    std::span<const Real> faces() const noexcept         { return m_faces; }
+    std::span<const Real> centers() const noexcept       { return m_centers; }
+    std::span<const Real> deltasFaces() const noexcept   { return m_dF; }
+    std::span<const Real> deltasCenters() const noexcept { return m_dC; }
+
+    // Info agregada
+    Index nVolumes() const noexcept { return static_cast<Index>(m_centers.size()); }
+    Index nFaces()   const noexcept { return static_cast<Index>(m_faces.size());   }
+    bool  empty()    const noexcept { return m_centers.empty(); }
+
+    // Acesso escalar (sem checagem de faixa)
+    Real face(Index i) const noexcept        { return m_faces[static_cast<std::size_t>(i)]; }
+    Real center(Index i) const noexcept      { return m_centers[static_cast<std::size_t>(i)]; }
+    Real deltaFace(Index i) const noexcept   { return m_dF[static_cast<std::size_t>(i)]; }
+    Real deltaCenter(Index i) const noexcept { return m_dC[static_cast<std::size_t>(i)]; }
+
+private:
+    std::span<const Real> m_faces{};
+    std::span<const Real> m_centers{};
+    std::span<const Real> m_dF{};
+    std::span<const Real> m_dC{};
+};
+
+API_NAMESPACE_CLOSE
+GRID1D_NAMESPACE_CLOSE
+GRID_NAMESPACE_CLOSE
+FVMGRIDMAKER_NAMESPACE_CLOSE
@@ -1,7 +1,7 @@
 // ----------------------------------------------------------------------------
 // File: ConfigureDistribution.hpp
 // Author: FVMGridMaker Team
-// Version: 2.0
+// Version: 2.3
 // Date: 2025-10-26
 // Description: Função utilitária para aplicar DistOptions em Grid1DBuilder.
 //              Define a DistributionTag e injeta (quando presente) o payload
@@ -21,8 +21,11 @@
 #include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBuilder.hpp>
 #include <FVMGridMaker/Grid/Grid1D/Builders/DistOptions.hpp>
 
-// Para o any_cast do payload suportado pelo builder atual:
+// Para o any_cast dos payloads suportados pelo builder atual:
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Equidistribution1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Geometric1D.hpp>
 #include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Random1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Vinokur1D.hpp>
 
 #include <any>
 
@@ -38,7 +41,8 @@ BUILDERS_NAMESPACE_OPEN
  * - Sempre define o `DistributionTag`.
  * - Se houver payload em `cfg.any`, faz `std::any_cast` para o tipo suportado
  *   pelo builder **para aquele tag** e chama `setOption(...)`.
- * - Implementado de forma mínima para o estado atual do builder (Random1D).
+ * - Payloads suportados: Random1D::Options, Geometric1D::Options,
+ *   Vinokur1D::Options e Equidistribution1D::Options.
  *   Outras distribuições podem ser adicionadas depois (novo case do switch).
  */
 inline void configureDistribution(Grid1DBuilder& builder, const DistOptions& cfg) {
@@ -55,6 +59,30 @@ inline void configureDistribution(Grid1DBuilder& builder, const DistOptions& cfg
             break;
         }
 
+        case grid::DistributionTag::Geometric1D: {
+            using patterns::distribution::Geometric1D;
+            if (const auto* opt = std::any_cast<Geometric1D::Options>(&cfg.any)) {
+                builder.setOption(*opt);
+            }
+            break;
+        }
+
+        case grid::DistributionTag::Vinokur1D: {
+            using patterns::distribution::Vinokur1D;
+            if (const auto* opt = std::any_cast<Vinokur1D::Options>(&cfg.any)) {
+                builder.setOption(*opt);
+            }
+            break;
+        }
+
+        case grid::DistributionTag::Equidistribution1D: {
+            using patterns::distribution::Equidistribution1D;
+            if (const auto* opt = std::any_cast<Equidistribution1D::Options>(&cfg.any)) {
+                builder.setOption(*opt);
+            }
+            break;
+        }
+
         default:
             // Sem payload conhecido para outros tags no estado atual do builder.
             break;
@@ -1,7 +1,7 @@
 // ----------------------------------------------------------------------------
 // File: DistOptions.hpp
 // Author: FVMGridMaker Team
-// Version: 2.0
+// Version: 2.3
 // Date: 2025-10-26
 // Description: Contêiner leve para transportar a configuração de distribuição
 //              (DistributionTag + payload opcional via std::any) do usuário
@@ -22,6 +22,9 @@
 #include <FVMGridMaker/Grid/Common/Tags1D.hpp> // DistributionTag
 
 #include <any>
+#include <cstdint>
+#include <functional>
+#include <vector>
 
 FVMGRIDMAKER_NAMESPACE_OPEN
 GRID_NAMESPACE_OPEN
@@ -68,6 +71,50 @@ public:
                                       core::Real w_hi);
 
     /// @}
+
+    /// @name Fábricas convenientes para Geometric1D
+    /// @{
+
+    /**
+     * @brief Cria configuração Geometric1D.
+     * @param ratio razão entre larguras consecutivas d_{i+1}/d_i.
+     */
+    static DistOptions Geometric1D_Ratio(core::Real ratio);
+
+    /// @}
+
+    /// @name Fábricas convenientes para Vinokur1D
+    /// @{
+
+    /**
+     * @brief Cria configuração Vinokur1D.
+     * @param first_width largura da primeira célula (fração de B - A).
+     * @param last_width  largura da última célula (fração de B - A).
+     */
+    static DistOptions Vinokur1D_Widths(core::Real first_width, core::Real last_width);
+
+    /// @}
+
+    /// @name Fábricas convenientes para Equidistribution1D
+    /// @{
+
+    /**
+     * @brief Cria configuração Equidistribution1D a partir de uma densidade amostrada.
+     * @param density   amostras w_k ≥ 0 do monitor.
+     * @param positions posições x_k das amostras (vazio → uniformes em [A, B]).
+     */
+    static DistOptions Equidistribution1D_Density(std::vector<core::Real> density,
+                                                  std::vector<core::Real> positions = {});
+
+    /**
+     * @brief Cria configuração Equidistribution1D a partir de uma função monitora.
+     * @param monitor função w(x) ≥ 0 (thread-safe se a ExecPolicy for paralela).
+     * @param samples pontos de amostragem (0 → 4N + 1).
+     */
+    static DistOptions Equidistribution1D_Monitor(std::function<core::Real(core::Real)> monitor,
+                                                  core::Index samples = 0);
+
+    /// @}
 };
 
 BUILDERS_NAMESPACE_CLOSE
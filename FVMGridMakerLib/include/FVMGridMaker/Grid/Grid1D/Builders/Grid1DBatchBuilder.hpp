@@ -0,0 +1,144 @@
+// ----------------------------------------------------------------------------
+// File: Grid1DBatchBuilder.hpp
+// Author: FVMGridMaker Team
+// Version: 1.1
+// Date: 2025-10-27
+// Description: Construção de muitas malhas 1D em uma chamada: uma arena
+//              compartilhada por todo o lote, registro consultado uma vez
+//              por distribuição e malhas distribuídas entre threads.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#pragma once
+
+/**
+ * @file  Grid1DBatchBuilder.hpp
+ * @brief `Grid1DSpec`, `Grid1DBatch` e `Grid1DBatchBuilder`.
+ *
+ * @details
+ * Para lotes de muitas malhas pequenas o custo fixo por `build()` domina
+ * (validação, lookup no registro, uma alocação por malha, opções
+ * empacotadas em std::any). O lote:
+ *  - valida todas as especificações antes de gerar;
+ *  - resolve a entrada do registro uma vez por DistributionTag;
+ *  - usa as opções já empacotadas em `DistOptions::any` (sem cópia);
+ *  - aloca uma única arena para todas as malhas (faces | centros | dF | dC
+ *    de cada malha, em sequência), reaproveitável com `buildInto`;
+ *  - divide as malhas entre threads (`ExecPolicy`); com uma só fatia, o
+ *    fechamento de cada malha usa a própria ExecPolicy.
+ *
+ * Aninhamento: com as malhas divididas entre threads, o fechamento roda
+ * serial e os geradores com `Options::exec = Auto` (o padrão) também
+ * (`parallel_for_chunks` não abre threads em `Auto` dentro de um bloco
+ * paralelo); `Parallel` explícito nas opções abre threads por malha.
+ * Exceções da geração/validação de uma malha saem com " [spec i]" na
+ * mensagem (mesmo tipo e código).
+ *
+ * Cada malha é idêntica a `Grid1DBuilder::build()` com os mesmos
+ * parâmetros. `Grid1DBatch[i]` é um Grid1DView válido enquanto o lote viver.
+ *
+ * @code
+ * std::vector<Grid1DSpec> specs(1000, {64, 0.0, 1.0, {DistributionTag::Uniform1D, {}}});
+ * const auto batch = Grid1DBatchBuilder{}.build(specs);
+ * for (std::size_t i = 0; i < batch.size(); ++i) use(batch[i]);
+ * @endcode
+ */
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker (ordem alfabética por caminho)
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/namespace.h>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1DView.h>
+#include <FVMGridMaker/Grid/Grid1D/Builders/DistOptions.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++ (ordem alfabética)
+// ----------------------------------------------------------------------------
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+FVMG_GRID1D_BUILDERS_OPEN
+
+/// Parâmetros de uma malha do lote (mesmos campos do Grid1DBuilder).
+struct Grid1DSpec {
+    core::Index        n{0};
+    core::Real         a{0.0};
+    core::Real         b{1.0};
+    DistOptions        dist{grid::DistributionTag::Uniform1D, {}};   ///< tag + opções
+    grid::CenteringTag centering{grid::CenteringTag::FaceCentered};
+};
+
+/**
+ * @brief Malhas de um lote em uma única arena (somente leitura).
+ */
+class Grid1DBatch {
+public:
+    using Real  = ::FVMGridMaker::core::Real;
+    using Index = ::FVMGridMaker::core::Index;
+
+    Grid1DBatch() = default;
+
+    /// Número de malhas.
+    [[nodiscard]] std::size_t size() const noexcept {
+        return m_offsets.empty() ? 0u : m_offsets.size() - 1u;
+    }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    /// Visão da malha @p i (sem checagem de faixa).
+    [[nodiscard]] api::Grid1DView operator[](std::size_t i) const noexcept {
+        const Real* p = m_data.get() + m_offsets[i];
+        const Index n = (m_offsets[i + 1u] - m_offsets[i] - 2u) / 4u;
+        return api::Grid1DView(p, p + n + 1u, p + 2u * n + 1u, p + 3u * n + 1u, n);
+    }
+
+    /// Tamanho da arena em bytes.
+    [[nodiscard]] std::size_t bytes() const noexcept {
+        return m_offsets.empty() ? 0u : m_offsets.back() * sizeof(Real);
+    }
+
+private:
+    friend class Grid1DBatchBuilder;
+
+    std::unique_ptr<Real[]>  m_data;
+    std::size_t              m_capacity{0};   // reais alocados em m_data
+    std::vector<std::size_t> m_offsets;       // início de cada malha (+ total)
+};
+
+/**
+ * @brief Constrói um lote de malhas a partir de especificações.
+ */
+class Grid1DBatchBuilder {
+public:
+    Grid1DBatchBuilder() = default;
+
+    /// Distribuição das malhas entre threads (padrão: Auto).
+    Grid1DBatchBuilder& setExecPolicy(core::ExecPolicy policy);
+
+    /// Valida cada malha dentro do fechamento (como Grid1DBuilder).
+    Grid1DBatchBuilder& setValidation(bool enabled);
+
+    /**
+     * @brief Constrói todas as malhas de @p specs.
+     *
+     * Lança InvalidArgument (campo "i" = índice da especificação) para
+     * N == 0 ou B <= A, antes de gerar qualquer malha.
+     */
+    [[nodiscard]] Grid1DBatch build(std::span<const Grid1DSpec> specs) const;
+
+    /**
+     * @brief Como build(), reaproveitando a arena de @p batch quando ela
+     *        comporta o novo lote (laços que reconstroem lotes a cada
+     *        iteração não pagam alocação nem page faults de novo).
+     */
+    void buildInto(std::span<const Grid1DSpec> specs, Grid1DBatch& batch) const;
+
+private:
+    core::ExecPolicy exec_ {core::ExecPolicy::Auto};
+    bool             check_{false};
+};
+
+FVMG_GRID1D_BUILDERS_CLOSE
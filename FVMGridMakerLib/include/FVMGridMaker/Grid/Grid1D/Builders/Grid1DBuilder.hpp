@@ -1,13 +1,20 @@
 // ----------------------------------------------------------------------------
 // File: Grid1DBuilder.hpp
 // Author: FVMGridMaker Team
-// Version: 2.3
-// Date: 2025-10-26
+// Version: 2.12
+// Date: 2025-10-27
 // Description: Declaração do construtor de malhas 1D (Grid1DBuilder).
 //              - Resolve geradores via registro (faces/centers)
-//              - Suporta distribuições Uniform1D e Random1D (e outras via registro)
+//              - Suporta distribuições Uniform1D, Random1D, Geometric1D,
+//                Vinokur1D e Equidistribution1D (e outras via registro)
 //              - Permite escolher o centering (Face/Cell)
-//              - setOption(Random1D::Options) para injetar parâmetros de Random1D
+//              - setOption(<Distribuição>::Options) para injetar
+//                parâmetros da distribuição
+//              - buildInto(...) escreve a malha em buffers do chamador
+//              - setExecPolicy(...) paraleliza o fechamento (xc/xf, dF, dC)
+//              - setValidation(true) valida a malha dentro do fechamento
+//              - stream(...)/buildChunked(...) geram a malha em blocos
+//              - Grid1DCache reaproveita build() por parâmetros
 // License: GNU GPL v3
 // ----------------------------------------------------------------------------
 #pragma once
@@ -15,25 +22,40 @@
 // ----------------------------------------------------------------------------
 // includes FVMGridMaker (ordem alfabética por caminho)
 // ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
 #include <FVMGridMaker/Core/namespace.h>
 #include <FVMGridMaker/Core/type.h>
 #include <FVMGridMaker/Grid/Common/Tags1D.hpp>
 #include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
-#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Random1D.hpp> // Options de Random1D
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1DView.h>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DStream.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Equidistribution1D.hpp> // Options de Equidistribution1D
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Geometric1D.hpp> // Options de Geometric1D
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Random1D.hpp>    // Options de Random1D
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Vinokur1D.hpp>   // Options de Vinokur1D
 
 // ----------------------------------------------------------------------------
 // includes C++ (ordem alfabética)
 // ----------------------------------------------------------------------------
+#include <any>
+#include <functional>
 #include <optional>
+#include <span>
 
 FVMG_GRID1D_BUILDERS_OPEN
 
+using FVMGridMaker::core::ExecPolicy;
 using FVMGridMaker::core::Index;
 using FVMGridMaker::core::Real;
 using FVMGridMaker::grid::CenteringTag;
 using FVMGridMaker::grid::DistributionTag;
 using FVMGridMaker::grid::grid1d::api::Grid1D;
+using FVMGridMaker::grid::grid1d::patterns::distribution::Equidistribution1D;
+using FVMGridMaker::grid::grid1d::patterns::distribution::Geometric1D;
 using FVMGridMaker::grid::grid1d::patterns::distribution::Random1D;
+using FVMGridMaker::grid::grid1d::patterns::distribution::Vinokur1D;
+
+class Grid1DCache;
 
 /**
  * @brief Builder de malhas 1D (Grid1D).
@@ -60,18 +82,102 @@ public:
     /// Injeta opções específicas da distribuição Random1D.
     Grid1DBuilder& setOption(const Random1D::Options& opt);
 
+    /// Injeta opções específicas da distribuição Geometric1D (razão r).
+    Grid1DBuilder& setOption(const Geometric1D::Options& opt);
+
+    /// Injeta opções específicas da distribuição Vinokur1D (larguras das pontas).
+    Grid1DBuilder& setOption(const Vinokur1D::Options& opt);
+
+    /// Injeta opções específicas da distribuição Equidistribution1D (monitor).
+    Grid1DBuilder& setOption(const Equidistribution1D::Options& opt);
+
+    /**
+     * @brief Política de execução do fechamento da malha (padrão: Auto).
+     *
+     * @details As passagens de fechamento (centros/faces, dF, dC) rodam em
+     * blocos contíguos via `core::parallel_for_chunks`. O resultado é
+     * idêntico bit a bit ao serial para qualquer política.
+     */
+    Grid1DBuilder& setExecPolicy(ExecPolicy policy);
+
+    /**
+     * @brief Valida a malha durante o fechamento (padrão: desligado).
+     *
+     * @details Cada bloco do kernel de fechamento verifica dF > 0 e dC > 0
+     * logo após escrevê-los, ainda em cache: faces e centros estritamente
+     * crescentes e centros dentro das células, sem segunda passada. A
+     * primeira violação é reportada via `FVMG_ERROR` com `GridErr` e o
+     * índice `{i}`:
+     *  - NonIncreasingFaces: xf[i] > xf[i+1] (ou NaN);
+     *  - DegenerateMesh: xf[i] == xf[i+1] (célula de largura nula);
+     *  - NonIncreasingCenters: xc[i+1] <= xc[i] (só em CellCentered: em
+     *    FaceCentered os centros são médias de faces já verificadas);
+     *  - CenterOutsideCell: xc[i] fora de (xf[i], xf[i+1]).
+     */
+    Grid1DBuilder& setValidation(bool enabled);
+
     /// Constrói e retorna o Grid1D materializado.
     Grid1D build() const;
 
+    /**
+     * @brief Constrói a malha diretamente em buffers fornecidos pelo chamador.
+     *
+     * @param xf faces  (N+1)
+     * @param xc centros (N)
+     * @param dF larguras das faces (N)
+     * @param dC distâncias entre centros (N+1)
+     *
+     * @details Mesmo resultado de `build()`, sem alocar o Grid1D. Se a
+     * distribuição registrou `fill_faces_fn`/`fill_centers_fn`, a sequência
+     * base é escrita in-place e nenhuma alocação ocorre no builder.
+     * Tamanhos incompatíveis com N lançam FVMGException (InvalidArgument).
+     */
+    void buildInto(std::span<Real> xf,
+                   std::span<Real> xc,
+                   std::span<Real> dF,
+                   std::span<Real> dC) const;
+
+    /**
+     * @brief Gerador da malha em blocos de @p chunk células (memória O(chunk)).
+     *
+     * @details Cada bloco traz os mesmos valores de `build()` (ver
+     * Grid1DStream). Suporta Uniform1D e Random1D com
+     * `Random1D::Options::Policy::CounterBased`; demais casos e chunk == 0
+     * lançam FVMGException (InvalidArgument). `setValidation` não se aplica.
+     */
+    Grid1DStream stream(Index chunk) const;
+
+    /// Percorre a malha em blocos, em ordem: `sink(first, bloco)`.
+    void buildChunked(Index chunk,
+                      const std::function<void(Index, const api::Grid1DView&)>& sink) const;
+
 private:
+    friend class Grid1DCache;   // chave do cache lê todos os campos
+
+    void validate() const;
+    void pack_options();
+    void fill(std::span<Real> xf,
+              std::span<Real> xc,
+              std::span<Real> dF,
+              std::span<Real> dC) const;
+
     Index            n_    {0};
     Real             a_    {0.0};
     Real             b_    {1.0};
     DistributionTag  dist_ {DistributionTag::Uniform1D};
     CenteringTag     cent_ {CenteringTag::FaceCentered};
+    ExecPolicy       exec_ {ExecPolicy::Auto};
+    bool             check_{false};
+
+    // Opções específicas de cada distribuição (armazenadas se fornecidas)
+    std::optional<Random1D::Options>    random1d_options_;
+    std::optional<Geometric1D::Options> geometric1d_options_;
+    std::optional<Vinokur1D::Options>   vinokur1d_options_;
+    std::optional<Equidistribution1D::Options> equidistribution1d_options_;
 
-    // Opções específicas de Random1D (armazenadas se fornecidas)
-    std::optional<Random1D::Options> random1d_options_;
+    // Payload da distribuição corrente já empacotado para o registro
+    // (evita std::any a cada build; refeito por setDistribution/setOption)
+    std::any options_any_;
 };
 
 FVMG_GRID1D_BUILDERS_CLOSE
@@ -0,0 +1,184 @@
+// ----------------------------------------------------------------------------
+// File: Grid1DBuilderT.hpp
+// Author: FVMGridMaker Team
+// Version: 1.2
+// Date: 2025-10-27
+// Description: Builder de malhas 1D resolvido em tempo de compilação.
+//              Chama diretamente os functors de distribuição (Distribution1D)
+//              e de centralização (Centering1D), sem registro, std::function
+//              ou std::any — tudo pode ser inlined pelo compilador.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#pragma once
+
+/**
+ * @file  Grid1DBuilderT.hpp
+ * @brief Variante estática do @ref Grid1DBuilder.
+ *
+ * @details
+ * Uso típico:
+ * @code
+ * using namespace FVMGridMaker::grid::grid1d;
+ * auto g = builders::Grid1DBuilderT<patterns::distribution::Uniform1D,
+ *                                   patterns::centering::FaceCentered>{}
+ *              .setN(64).setDomain(0.0, 1.0).build();
+ * @endcode
+ *
+ * Produz a mesma malha que o @ref Grid1DBuilder para a mesma distribuição:
+ *  - `C::kTag == FaceCentered`: D gera faces; C deriva centros/dF/dC.
+ *  - `C::kTag == CellCentered`: D gera centros; C reconstrói faces/dF/dC e as
+ *    faces de borda são fechadas no domínio (xf[0]=A, xf[N]=B), como no
+ *    builder dinâmico.
+ */
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker (ordem alfabética por caminho)
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/namespace.h>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/ErrorHandling/ErrorHandling.h>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1DStorage.h>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Centering/ConceptsCentering.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/ConceptsDistribution.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++ (ordem alfabética)
+// ----------------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+FVMG_GRID1D_BUILDERS_OPEN
+
+/**
+ * @brief Builder estático: D (distribuição) × C (centralização).
+ *
+ * @tparam D functor que satisfaz `patterns::distribution::Distribution1D`.
+ * @tparam C functor que satisfaz `patterns::centering::Centering1D`.
+ */
+template <patterns::distribution::Distribution1D D,
+          patterns::centering::Centering1D       C>
+class Grid1DBuilderT {
+public:
+    using Real  = core::Real;
+    using Index = core::Index;
+
+    Grid1DBuilderT() = default;
+
+    /// Usa instâncias já configuradas dos functors (ex.: Random1D{opt}).
+    explicit Grid1DBuilderT(D dist, C cent = C{})
+        : dist_(std::move(dist)), cent_(std::move(cent)) {}
+
+    /// Define o número de volumes (N > 0).
+    Grid1DBuilderT& setN(Index n) { n_ = n; return *this; }
+
+    /// Define o domínio [A,B] (exige B > A).
+    Grid1DBuilderT& setDomain(Real a, Real b) { a_ = a; b_ = b; return *this; }
+
+    /// Semente repassada ao functor de distribuição.
+    Grid1DBuilderT& setSeed(std::uint64_t seed) { seed_ = seed; return *this; }
+
+    /// Espaçamento mínimo repassado ao functor de distribuição.
+    Grid1DBuilderT& setDxMin(Real dx_min) { dx_min_ = dx_min; return *this; }
+
+    /// Constrói e retorna o Grid1D materializado (uma alocação: a arena).
+    [[nodiscard]] api::Grid1D build() const {
+        if (!valid("Grid1DBuilderT::build")) return api::Grid1D{};
+        api::Grid1DStorage storage(n_);
+        fill(storage.faces(), storage.centers(),
+             storage.deltasFaces(), storage.deltasCenters());
+        return api::Grid1D{std::move(storage)};
+    }
+
+    /// Constrói em buffers do chamador (N+1, N, N, N+1). Não aloca.
+    void buildInto(std::span<Real> xf,
+                   std::span<Real> xc,
+                   std::span<Real> dF,
+                   std::span<Real> dC) const {
+        if (!valid("Grid1DBuilderT::buildInto")) return;
+        const std::size_t N = static_cast<std::size_t>(n_);
+        if (xf.size() != N + 1u || xc.size() != N ||
+            dF.size() != N      || dC.size() != N + 1u) {
+            FVMG_ERROR(error::CoreErr::InvalidArgument, {
+                {"where", "Grid1DBuilderT::buildInto"},
+                {"what",  "buffer sizes must be (N+1, N, N, N+1)"}
+            });
+            return;   // Policy::Status: buffers intocados
+        }
+        fill(xf, xc, dF, dC);
+    }
+
+private:
+    // false após FVMG_ERROR sem exceção (Policy::Status): nada é gerado.
+    bool valid(const char* where) const {
+        if (n_ == 0) {
+            FVMG_ERROR(error::CoreErr::InvalidArgument, {
+                {"where", where},
+                {"what",  "N must be > 0"}
+            });
+            return false;
+        }
+        if (!(b_ > a_)) {
+            FVMG_ERROR(error::CoreErr::InvalidArgument, {
+                {"where", where},
+                {"what",  "requires B > A"}
+            });
+            return false;
+        }
+        return true;
+    }
+
+    void fill(std::span<Real> xf,
+              std::span<Real> xc,
+              std::span<Real> dF,
+              std::span<Real> dC) const {
+        // Functors const (todos os da biblioteca) são chamados sem cópia;
+        // só um functor com makeFaces/makeCenters não-const é copiado.
+        if constexpr (requires(const D& d, std::span<Real> v) {
+                          d.makeFaces(n_, a_, b_, v, seed_, dx_min_);
+                          d.makeCenters(n_, a_, b_, v, seed_, dx_min_);
+                      }) {
+            fill_with(dist_, xf, xc, dF, dC);
+        } else {
+            D dist = dist_;
+            fill_with(dist, xf, xc, dF, dC);
+        }
+    }
+
+    template <class Dist>
+    void fill_with(Dist& dist,
+                   std::span<Real> xf,
+                   std::span<Real> xc,
+                   std::span<Real> dF,
+                   std::span<Real> dC) const {
+        if constexpr (C::kTag == CenteringTag::FaceCentered) {
+            dist.makeFaces(n_, a_, b_, xf, seed_, dx_min_);
+            cent_(std::span<const Real>(xf.data(), xf.size()), xc, dF, dC);
+        } else {
+            dist.makeCenters(n_, a_, b_, xc, seed_, dx_min_);
+            cent_(std::span<const Real>(xc.data(), xc.size()), xf, dF, dC);
+
+            // Fecha as faces de borda no domínio (mesma regra do Grid1DBuilder)
+            const std::size_t N = static_cast<std::size_t>(n_);
+            xf[0]     = a_;
+            xf[N]     = b_;
+            dF[0]     = xf[1] - xf[0];
+            dF[N - 1] = xf[N] - xf[N - 1];
+            dC[0]     = xc[0] - xf[0];
+            dC[N]     = xf[N] - xc[N - 1];
+        }
+    }
+
+    D             dist_   {};
+    C             cent_   {};
+    Index         n_      {0};
+    Real          a_      {0.0};
+    Real          b_      {1.0};
+    std::uint64_t seed_   {0};
+    Real          dx_min_ {0.0};
+};
+
+FVMG_GRID1D_BUILDERS_CLOSE
@@ -0,0 +1,139 @@
+// ----------------------------------------------------------------------------
+// File: Grid1DCache.hpp
+// Author: FVMGridMaker Team
+// Version: 1.4
+// Date: 2025-10-27
+// Description: Cache LRU thread-safe, limitado em bytes, na frente de
+//              Grid1DBuilder::build(): malhas imutáveis compartilhadas
+//              (std::shared_ptr<const Grid1D>) indexadas pelos parâmetros
+//              que determinam a malha.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#pragma once
+
+/**
+ * @file  Grid1DCache.hpp
+ * @brief `Grid1DCache`: reaproveita malhas já construídas.
+ *
+ * @details
+ * A chave cobre N, domínio (bits exatos de A e B), distribuição,
+ * centering, validação e apenas as opções da distribuição ativa:
+ * Random1D::Options (w_lo, w_hi, seed, policy), Geometric1D::Options
+ * (ratio) ou Vinokur1D::Options (first_width, last_width). Opções
+ * guardadas para outras distribuições não afetam a malha e não entram.
+ * Parâmetros iguais → mesma malha compartilhada.
+ *
+ * Nenhuma ExecPolicy entra na chave (nem a do builder nem o `exec` das
+ * opções): geração e fechamento são determinísticos por blocos fixos e dão
+ * os mesmos bits para qualquer política, então builders que diferem só na
+ * política compartilham a entrada.
+ *
+ * Equidistribution1D com opções (função monitora, densidade) não entra na
+ * chave: esses builders são construídos sem passar pelo cache (contados
+ * como falta). A malha muda a cada re-malhagem de qualquer forma.
+ *
+ * - `get(b)`: acerto devolve a malha em cache e a marca como mais recente;
+ *   falta chama `b.build()` fora do lock (buscas concorrentes seguem) e
+ *   insere o resultado, removendo as menos recentes até caber no limite.
+ *   Se duas threads constroem a mesma chave ao mesmo tempo, a primeira a
+ *   inserir vence e ambas recebem o mesmo ponteiro.
+ * - O custo de cada entrada é `Grid1DStorage::bytes()`. Malhas maiores que
+ *   o limite são devolvidas sem entrar no cache.
+ * - Exceções de `build()` propagam; nada é inserido.
+ * - Remover uma entrada não invalida ponteiros já entregues.
+ */
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker (ordem alfabética por caminho)
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/namespace.h>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBuilder.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++ (ordem alfabética)
+// ----------------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+FVMG_GRID1D_BUILDERS_OPEN
+
+class Grid1DCache {
+public:
+    /// Contadores acumulados e ocupação atual.
+    struct Stats {
+        std::size_t hits{0};
+        std::size_t misses{0};
+        std::size_t evictions{0};
+        std::size_t entries{0};
+        std::size_t bytes{0};
+    };
+
+    /// Cache com no máximo @p max_bytes de malhas armazenadas.
+    explicit Grid1DCache(std::size_t max_bytes);
+
+    Grid1DCache(const Grid1DCache&)            = delete;
+    Grid1DCache& operator=(const Grid1DCache&) = delete;
+
+    /// Malha de @p b (constrói e insere na falta). Thread-safe.
+    [[nodiscard]] std::shared_ptr<const api::Grid1D> get(const Grid1DBuilder& b);
+
+    /// Remove todas as entradas (contadores de acerto/falta são mantidos).
+    void clear();
+
+    /// Instantâneo dos contadores.
+    [[nodiscard]] Stats stats() const;
+
+    /// Limite em bytes.
+    [[nodiscard]] std::size_t capacityBytes() const noexcept { return m_max_bytes; }
+
+private:
+    // Parâmetros que determinam a malha; reais comparados pelos bits
+    struct Key {
+        std::uint64_t n{0};
+        std::uint64_t a_bits{0};
+        std::uint64_t b_bits{0};
+        std::uint8_t  dist{0};
+        std::uint8_t  cent{0};
+        bool          check{false};
+        bool          has_options{false};
+        // Random1D
+        std::uint64_t w_lo_bits{0};
+        std::uint64_t w_hi_bits{0};
+        bool          has_seed{false};
+        std::uint64_t seed{0};
+        std::uint8_t  policy{0};
+        // Geometric1D
+        std::uint64_t ratio_bits{0};
+        // Vinokur1D
+        std::uint64_t first_width_bits{0};
+        std::uint64_t last_width_bits{0};
+
+        bool operator==(const Key&) const = default;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key& k) const noexcept;
+    };
+
+    using Value = std::shared_ptr<const api::Grid1D>;
+    using Lru   = std::list<std::pair<Key, Value>>;   // frente = mais recente
+
+    static Key key_of(const Grid1DBuilder& b) noexcept;
+    void evict_to_fit_locked();
+
+    const std::size_t m_max_bytes;
+
+    mutable std::mutex m_mutex;
+    Lru                m_lru;
+    std::unordered_map<Key, Lru::iterator, KeyHash> m_index;
+    Stats              m_stats{};
+};
+
+FVMG_GRID1D_BUILDERS_CLOSE
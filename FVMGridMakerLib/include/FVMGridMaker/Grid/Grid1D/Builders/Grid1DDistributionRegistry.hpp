@@ -1,8 +1,8 @@
 // ----------------------------------------------------------------------------
 // File: Grid1DDistributionRegistry.hpp
 // Author: FVMGridMaker Team
-// Version: 2.0
-// Date: 2025-10-26
+// Version: 2.2
+// Date: 2025-10-27
 // Description: Interface do registro extensível de geradores de distribuições
 //              1D (faces/centros) para o Grid1D. Não realiza auto-registro.
 //              Cada padrão (Uniform1D, Random1D, etc.) deve se registrar em
@@ -20,6 +20,15 @@
  *
  * Não há *auto-registration* aqui: cada implementação de padrão deve, no seu
  * `.cpp`, chamar `Grid1DDistributionRegistry::instance().registerDistribution(...)`.
+ *
+ * Ciclo de vida:
+ * - **Fase de registro** (startup): `registerDistribution`/`find`/`nameForTag`
+ *   são serializados por um `std::shared_mutex` (leituras concorrentes, escrita
+ *   exclusiva).
+ * - **Congelado** (`freeze()`): o registro passa a ser somente leitura. Um vetor
+ *   denso indexado por `DistributionTag` aponta para as entradas, e
+ *   `entryForTag()` é O(1), sem lock e sem alocação — seguro para muitos
+ *   threads. Registrar após `freeze()` gera `GridErr::RegistryFrozen`.
  */
 
 #pragma once
@@ -29,8 +38,13 @@
 #include <FVMGridMaker/Grid/Common/Tags1D.hpp>    // FVMGridMaker::grid::DistributionTag
 
 #include <any>
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <functional>
 #include <optional>
+#include <shared_mutex>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -45,10 +59,17 @@ BUILDERS_NAMESPACE_OPEN
  * @class Grid1DDistributionRegistry
  * @brief Registro singleton de geradores de distribuições 1D.
  *
- * Cada entrada contém dois *functors*:
+ * Cada entrada contém dois *functors* obrigatórios:
  * - `faces_fn(n, A, B, any_opt)`  → retorna coordenadas das **faces**
  * - `centers_fn(n, A, B, any_opt)`→ retorna coordenadas dos **centros**
  *
+ * e, opcionalmente, as variantes que escrevem em memória do chamador
+ * (mesmo formato de saída do concept `Distribution1D`):
+ * - `fill_faces_fn(n, A, B, out, any_opt)`   → escreve N+1 faces em `out`
+ * - `fill_centers_fn(n, A, B, out, any_opt)` → escreve N centros em `out`
+ *
+ * Quando presentes, o builder usa as variantes `fill_*` (sem alocação).
+ *
  * Onde:
  * - `n`   : número de células (ou pontos, conforme a convenção do padrão)
  * - `A,B` : limites do domínio 1D (A < B)
@@ -64,10 +85,20 @@ public:
             FVMGridMaker::core::Real  B,
             const std::any*           any_opt)>;
 
+    /// Assinatura de um gerador que escreve no span de saída do chamador.
+    using FillFn = std::function<
+        void(FVMGridMaker::core::Index          n,
+             FVMGridMaker::core::Real           A,
+             FVMGridMaker::core::Real           B,
+             std::span<FVMGridMaker::core::Real> out,
+             const std::any*                    any_opt)>;
+
     /// Par de geradores (faces, centros) para uma distribuição.
     struct Entry {
-        GenFn faces_fn;    ///< Gerador de faces.
-        GenFn centers_fn;  ///< Gerador de centros.
+        GenFn  faces_fn;         ///< Gerador de faces.
+        GenFn  centers_fn;       ///< Gerador de centros.
+        FillFn fill_faces_fn;    ///< (opcional) Escreve faces (N+1) in-place.
+        FillFn fill_centers_fn;  ///< (opcional) Escreve centros (N) in-place.
     };
 
     /**
@@ -118,14 +149,55 @@ public:
     [[nodiscard]] std::optional<Entry>
     findByTag(FVMGridMaker::grid::DistributionTag tag) const;
 
+    /**
+     * @brief Congela o registro (irreversível). Idempotente.
+     *
+     * @details Monta a tabela densa `tag -> const Entry*`. A partir daqui as
+     *          entradas não mudam mais de endereço nem de conteúdo.
+     */
+    void freeze();
+
+    /// `true` após `freeze()`.
+    [[nodiscard]] bool isFrozen() const noexcept {
+        return frozen_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Acesso por tag sem cópia.
+     * @param tag Enum `DistributionTag`.
+     * @return Ponteiro para a entrada, ou `nullptr` se o tag não estiver
+     *         registrado ou se o registro ainda não estiver congelado.
+     *
+     * @details O(1), sem lock e sem alocação. O ponteiro é estável durante
+     *          todo o restante do processo.
+     */
+    [[nodiscard]] const Entry*
+    entryForTag(FVMGridMaker::grid::DistributionTag tag) const noexcept {
+        const auto idx = static_cast<std::size_t>(tag);
+        if (!isFrozen() || idx >= by_tag_.size()) return nullptr;
+        return by_tag_[idx];
+    }
+
 private:
     Grid1DDistributionRegistry() = default;
 
+    static constexpr std::size_t kTagCount =
+        static_cast<std::size_t>(FVMGridMaker::grid::DistributionTag::Count);
+
+    void ensureNotFrozen(std::string_view where) const;
+
     // Mapa nome -> Entry
     std::unordered_map<std::string, Entry> names_{};
 
     // Mapa (int)tag -> nome (usa int para evitar necessidade de hash de enum)
     std::unordered_map<int, std::string> tag_to_name_{};
+
+    // Tabela densa tag -> Entry (preenchida em freeze(); nós do unordered_map
+    // têm endereço estável)
+    std::array<const Entry*, kTagCount> by_tag_{};
+
+    mutable std::shared_mutex mutex_{};
+    std::atomic<bool>         frozen_{false};
 };
 
 BUILDERS_NAMESPACE_CLOSE
@@ -0,0 +1,61 @@
+// ----------------------------------------------------------------------------
+// File: Grid1DFill.hpp
+// Author: FVMGridMaker Team
+// Version: 1.0
+// Date: 2025-10-27
+// Description: Núcleo compartilhado pelos builders dinâmicos (Grid1DBuilder,
+//              Grid1DBatchBuilder): resolve a entrada do registro e gera a
+//              malha em spans do chamador (sequência base + fechamento).
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#pragma once
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker (ordem alfabética por caminho)
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/namespace.h>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DDistributionRegistry.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++ (ordem alfabética)
+// ----------------------------------------------------------------------------
+#include <any>
+#include <optional>
+#include <span>
+
+FVMG_GRID1D_BUILDERS_OPEN
+DETAIL_NAMESPACE_OPEN
+
+/**
+ * @brief Entrada do registro para @p tag.
+ *
+ * Registro congelado: ponteiro estável, sem lock. Caso contrário, a entrada
+ * é copiada em @p copy (sob lock) e o ponteiro aponta para ela. Lança
+ * `std::runtime_error` se o tag não estiver registrado.
+ */
+const Grid1DDistributionRegistry::Entry*
+resolve_entry(grid::DistributionTag tag,
+              std::optional<Grid1DDistributionRegistry::Entry>& copy);
+
+/**
+ * @brief Gera a sequência base com @p entry e fecha a malha (N = xc.size()).
+ *
+ * Mesmo caminho de `Grid1DBuilder::build()`: base in-place quando a
+ * distribuição oferece `fill_*_fn`, fechamento por ClosureKernel1D com
+ * @p exec; com @p check, a primeira violação vira FVMG_ERROR(GridErr::...).
+ */
+void fill_grid1d(const Grid1DDistributionRegistry::Entry& entry,
+                 core::Real a, core::Real b,
+                 grid::CenteringTag centering,
+                 const std::any* options,
+                 core::ExecPolicy exec, bool check,
+                 std::span<core::Real> xf,
+                 std::span<core::Real> xc,
+                 std::span<core::Real> dF,
+                 std::span<core::Real> dC);
+
+DETAIL_NAMESPACE_CLOSE
+FVMG_GRID1D_BUILDERS_CLOSE
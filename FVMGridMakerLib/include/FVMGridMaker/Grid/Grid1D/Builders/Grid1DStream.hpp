@@ -0,0 +1,114 @@
+// ----------------------------------------------------------------------------
+// File: Grid1DStream.hpp
+// Author: FVMGridMaker Team
+// Version: 1.0
+// Date: 2025-10-27
+// Description: Geração de malhas 1D em blocos de células (streaming), com
+//              memória proporcional ao bloco e não a N. Obtido via
+//              Grid1DBuilder::stream(...) / buildChunked(...).
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#pragma once
+
+/**
+ * @file  Grid1DStream.hpp
+ * @brief `Grid1DStream`: percorre a malha em blocos consecutivos de células.
+ *
+ * @details
+ * Cada bloco é um Grid1DView das células [first, first + n):
+ *  - faces (n+1), centros (n), dF (n) e dC (n+1), com os valores que
+ *    `Grid1DBuilder::build()` produz nessas posições (bit a bit se a
+ *    distribuição registrada foi compilada com as mesmas opções de ponto
+ *    flutuante da biblioteca); qualquer tamanho de bloco gera exatamente
+ *    a mesma malha;
+ *  - blocos vizinhos compartilham a face xf[first+n] e a distância
+ *    dC[first+n]. Para concatenar os arrays globais, grave faces e dC sem
+ *    o último elemento em todos os blocos exceto o último (`last()`).
+ *
+ * Estado carregado entre blocos: uma janela de até três valores da
+ * sequência base (faces ou centros) e o estado do gerador (contador e
+ * soma compensada do Random1D). Os spans do bloco valem até o próximo
+ * `next()`.
+ *
+ * Distribuições suportadas: Uniform1D e Random1D com
+ * `Random1D::Options::Policy::CounterBased` (os pesos são recalculados por
+ * contador; o mt19937 sequencial não permite isso). Ambos os centerings.
+ */
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker (ordem alfabética por caminho)
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/namespace.h>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1DView.h>
+
+// ----------------------------------------------------------------------------
+// includes C++ (ordem alfabética)
+// ----------------------------------------------------------------------------
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <vector>
+
+FVMG_GRID1D_BUILDERS_OPEN
+
+class Grid1DBuilder;
+
+/**
+ * @brief Gerador de malha 1D em blocos (uso: `while (s.next()) use(s.chunk());`).
+ */
+class Grid1DStream {
+public:
+    using Real  = ::FVMGridMaker::core::Real;
+    using Index = ::FVMGridMaker::core::Index;
+
+    /// Produz o próximo bloco; `false` quando a malha terminou.
+    bool next();
+
+    /// Bloco corrente (células [first(), first() + chunk().nVolumes())).
+    [[nodiscard]] const api::Grid1DView& chunk() const noexcept { return m_chunk; }
+
+    /// Índice global da primeira célula do bloco corrente.
+    [[nodiscard]] Index first() const noexcept { return m_first; }
+
+    /// `true` se o bloco corrente termina em xf[N].
+    [[nodiscard]] bool last() const noexcept { return m_first + m_chunk.nVolumes() == m_n; }
+
+    /// Número total de volumes N.
+    [[nodiscard]] Index nVolumes() const noexcept { return m_n; }
+
+private:
+    friend class Grid1DBuilder;
+
+    /// Escreve os próximos out.size() valores da sequência base, em ordem.
+    using BaseFn = std::function<void(std::span<Real>)>;
+
+    Grid1DStream(Index n, Real a, Real b, CenteringTag centering,
+                 Index chunk, core::ExecPolicy exec, BaseFn base);
+
+    Index            m_n    {0};
+    Real             m_a    {0};
+    Real             m_b    {1};
+    CenteringTag     m_cent {CenteringTag::FaceCentered};
+    Index            m_block{0};
+    core::ExecPolicy m_exec {core::ExecPolicy::Auto};
+    BaseFn           m_base;
+
+    // Janela da sequência base: índices [m_win_lo, m_win_lo + m_win_n)
+    std::vector<Real> m_win;
+    std::size_t       m_win_lo{0};
+    std::size_t       m_win_n {0};
+
+    // Saídas do bloco (a sequência base é exposta direto da janela)
+    std::vector<Real> m_out;     // faces ou centros (n+1)
+    std::vector<Real> m_dF;      // n
+    std::vector<Real> m_dC;      // n+1
+
+    Index            m_first{0};
+    Index            m_next {0};
+    api::Grid1DView  m_chunk{};
+};
+
+FVMG_GRID1D_BUILDERS_CLOSE
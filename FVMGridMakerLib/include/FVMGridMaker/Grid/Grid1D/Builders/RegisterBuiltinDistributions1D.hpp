@@ -0,0 +1,144 @@
+// ----------------------------------------------------------------------------
+// File: RegisterBuiltinDistributions1D.hpp
+// Author: FVMGridMaker Team
+// Version: 1.3
+// Date: 2025-10-27
+// Description: Registro explícito, em uma chamada, dos padrões de distribuição
+//              1D que acompanham a biblioteca.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#pragma once
+
+/**
+ * @file  RegisterBuiltinDistributions1D.hpp
+ * @brief `registerBuiltinDistributions()`.
+ *
+ * @details
+ * O registro continua sem auto-registro: o chamador decide quando (e se)
+ * os padrões embutidos entram. A função registra Uniform1D, Random1D,
+ * Geometric1D, Vinokur1D e Equidistribution1D com as quatro funções da
+ * entrada (faces, centros e as variantes `fill_*`), associadas aos
+ * respectivos `DistributionTag`.
+ *
+ *  - Nomes já registrados são mantidos: um gerador do usuário registrado
+ *    antes não é sobrescrito (e um registrado depois sobrescreve o padrão).
+ *  - Com o registro congelado, não faz nada.
+ *  - Idempotente; chamar antes de `freeze()`.
+ *
+ * Header-only, como os próprios padrões: os geradores são compilados no TU
+ * do chamador, com as mesmas flags de uma chamada direta ao padrão (mesmos
+ * bits nas coordenadas).
+ *
+ * @code
+ * registerBuiltinDistributions();
+ * Grid1DDistributionRegistry::instance().freeze();
+ * @endcode
+ */
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker (ordem alfabética por caminho)
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/namespace.h>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DDistributionRegistry.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Equidistribution1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Geometric1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Random1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Uniform1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Vinokur1D.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <any>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+FVMGRIDMAKER_NAMESPACE_OPEN
+GRID_NAMESPACE_OPEN
+GRID1D_NAMESPACE_OPEN
+BUILDERS_NAMESPACE_OPEN
+
+namespace detail {
+
+/// Entrada para padrões com faces/centers/faces_into/centers_into estáticos.
+template <class P>
+Grid1DDistributionRegistry::Entry builtin_entry() {
+    using core::Index;
+    using core::Real;
+    Grid1DDistributionRegistry::Entry e{};
+    e.faces_fn = [](Index n, Real A, Real B, const std::any* o) {
+        return P::faces(n, A, B, o);
+    };
+    e.centers_fn = [](Index n, Real A, Real B, const std::any* o) {
+        return P::centers(n, A, B, o);
+    };
+    e.fill_faces_fn = [](Index n, Real A, Real B, std::span<Real> xf, const std::any* o) {
+        P::faces_into(n, A, B, xf, o);
+    };
+    e.fill_centers_fn = [](Index n, Real A, Real B, std::span<Real> xc, const std::any* o) {
+        P::centers_into(n, A, B, xc, o);
+    };
+    return e;
+}
+
+/// Uniform1D não tem opções: usa makeFaces/makeCenters.
+inline Grid1DDistributionRegistry::Entry uniform_entry() {
+    using core::Index;
+    using core::Real;
+    using patterns::distribution::Uniform1D;
+    Grid1DDistributionRegistry::Entry e{};
+    e.faces_fn = [](Index n, Real A, Real B, const std::any*) {
+        std::vector<Real> xf(static_cast<std::size_t>(n) + 1u);
+        Uniform1D{}.makeFaces(n, A, B, xf);
+        return xf;
+    };
+    e.centers_fn = [](Index n, Real A, Real B, const std::any*) {
+        std::vector<Real> xc(static_cast<std::size_t>(n));
+        Uniform1D{}.makeCenters(n, A, B, xc);
+        return xc;
+    };
+    e.fill_faces_fn = [](Index n, Real A, Real B, std::span<Real> xf, const std::any*) {
+        Uniform1D{}.makeFaces(n, A, B, xf);
+    };
+    e.fill_centers_fn = [](Index n, Real A, Real B, std::span<Real> xc, const std::any*) {
+        Uniform1D{}.makeCenters(n, A, B, xc);
+    };
+    return e;
+}
+
+inline void register_if_absent(Grid1DDistributionRegistry& reg, const char* name,
+                               Grid1DDistributionRegistry::Entry (*make)(),
+                               DistributionTag tag) {
+    if (reg.find(name)) return;
+    reg.registerDistribution(std::string{name}, make(), tag);
+}
+
+} // namespace detail
+
+/// Registra os padrões 1D embutidos que ainda não estiverem no registro.
+inline void registerBuiltinDistributions() {
+    namespace dist = patterns::distribution;
+    auto& reg = Grid1DDistributionRegistry::instance();
+    if (reg.isFrozen()) return;
+
+    detail::register_if_absent(reg, "Uniform1D", &detail::uniform_entry,
+                               DistributionTag::Uniform1D);
+    detail::register_if_absent(reg, "Random1D", &detail::builtin_entry<dist::Random1D>,
+                               DistributionTag::Random1D);
+    detail::register_if_absent(reg, "Geometric1D", &detail::builtin_entry<dist::Geometric1D>,
+                               DistributionTag::Geometric1D);
+    detail::register_if_absent(reg, "Vinokur1D", &detail::builtin_entry<dist::Vinokur1D>,
+                               DistributionTag::Vinokur1D);
+    detail::register_if_absent(reg, "Equidistribution1D",
+                               &detail::builtin_entry<dist::Equidistribution1D>,
+                               DistributionTag::Equidistribution1D);
+}
+
+BUILDERS_NAMESPACE_CLOSE
+GRID1D_NAMESPACE_CLOSE
+GRID_NAMESPACE_CLOSE
+FVMGRIDMAKER_NAMESPACE_CLOSE
@@ -0,0 +1,161 @@
+// ----------------------------------------------------------------------------
+// File: Grid1DFile.hpp
+// Author: FVMGridMaker Team
+// Version: 1.3
+// Date: 2025-10-27
+// Description: Formato binário versionado para malhas 1D e leitor por
+//              mapeamento em memória (mmap) que expõe um Grid1DView sem
+//              cópia, compartilhável entre processos.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#pragma once
+
+/**
+ * @file  Grid1DFile.hpp
+ * @brief `write_grid1d` / `MappedGrid1D::open`.
+ *
+ * @details
+ * Layout do arquivo (ordem de bytes nativa, registrada no cabeçalho):
+ * @code
+ *  | Grid1DFileHeader (128 B) | faces (N+1) | pad | centers (N) | pad |
+ *  | dF (N) | pad | dC (N+1) | pad |
+ * @endcode
+ * Cada seção começa em múltiplo de @ref kGrid1DFileAlignment bytes (o mesmo
+ * alinhamento de Grid1DStorage) e o padding é zerado. Como o mapeamento
+ * começa em limite de página, os spans do Grid1DView saem alinhados.
+ *
+ * O checksum (@ref grid1d_checksum) cobre apenas os quatro arrays; é um hash
+ * de 64 bits não criptográfico, calculado por blocos fixos (idêntico em
+ * qualquer ExecPolicy). A verificação na abertura é opcional: abrir sem
+ * verificar custa só a validação do cabeçalho, independentemente de N.
+ *
+ * Erros são reportados via FVMG_ERROR com `FileErr` (FileNotFound,
+ * AccessDenied, ReadError, WriteError, InvalidFormat, ChecksumMismatch).
+ */
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/namespace.h>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1DStorage.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1DView.h>
+
+FVMG_GRID1D_IO_OPEN
+
+/// Versão corrente do formato (incrementada a cada mudança de layout).
+inline constexpr std::uint32_t kGrid1DFileVersion = 1;
+
+/// Alinhamento (bytes) de cada seção do arquivo.
+inline constexpr std::size_t kGrid1DFileAlignment = api::Grid1DStorage::kAlignment;
+
+/// Marcador de ordem de bytes gravado pelo escritor.
+inline constexpr std::uint32_t kGrid1DFileEndian = 0x01020304u;
+
+/// Metadados gravados junto com a malha.
+struct Grid1DFileMeta {
+    DistributionTag distribution{DistributionTag::Uniform1D};
+    CenteringTag    centering{CenteringTag::FaceCentered};
+    double          a{0.0};          ///< domínio [a, b]
+    double          b{1.0};
+    std::uint64_t   seed{0};         ///< semente da distribuição (0 se não se aplica)
+};
+
+/// Cabeçalho on-disk (128 bytes, trivialmente copiável).
+struct Grid1DFileHeader {
+    char          magic[8];          ///< "FVMG1D\0\0"
+    std::uint32_t version;           ///< kGrid1DFileVersion
+    std::uint32_t header_bytes;      ///< sizeof(Grid1DFileHeader)
+    std::uint32_t real_bytes;        ///< sizeof(Real) do escritor
+    std::uint32_t endian;            ///< kGrid1DFileEndian na ordem do escritor
+    std::uint64_t n;                 ///< número de volumes N
+    double        a, b;              ///< domínio
+    std::uint8_t  distribution;      ///< DistributionTag
+    std::uint8_t  centering;         ///< CenteringTag
+    std::uint8_t  pad_[6];
+    std::uint64_t seed;
+    std::uint64_t offset[4];         ///< faces, centers, dF, dC (bytes desde o início)
+    std::uint64_t checksum;          ///< grid1d_checksum dos quatro arrays
+    std::uint8_t  reserved[24];
+};
+static_assert(sizeof(Grid1DFileHeader) == 128, "Grid1DFileHeader deve ter 128 bytes");
+static_assert(std::is_trivially_copyable_v<Grid1DFileHeader>);
+
+/**
+ * @brief Hash de 64 bits dos quatro arrays (ordem: faces, centers, dF, dC).
+ * @param policy política de execução (não altera o resultado)
+ */
+[[nodiscard]] std::uint64_t grid1d_checksum(const api::Grid1DView& g,
+                                            core::ExecPolicy policy = core::ExecPolicy::Auto);
+
+/**
+ * @brief Grava a malha em @p path no formato binário versionado.
+ *
+ * @details Uma passada para o checksum e outra de escrita sequencial em
+ * `path + ".tmp"`, que então substitui @p path via rename(): um leitor
+ * concorrente nunca mapeia um arquivo parcial. Falhas de E/S removem o
+ * temporário e geram FVMG_ERROR(FileErr::WriteError).
+ */
+void write_grid1d(const std::string& path, const api::Grid1DView& g,
+                  const Grid1DFileMeta& meta = {});
+
+/// Sobrecarga para Grid1D (aceita também temporários).
+inline void write_grid1d(const std::string& path, const api::Grid1D& g,
+                         const Grid1DFileMeta& meta = {}) {
+    write_grid1d(path, g.view(), meta);
+}
+
+/**
+ * @brief Arquivo de malha mapeado em memória (somente leitura).
+ *
+ * Somente movível; desfaz o mapeamento no destrutor. O Grid1DView de
+ * `view()` aponta para as páginas mapeadas e vale enquanto o objeto viver.
+ * O mapeamento é compartilhado (MAP_SHARED): processos que abrem o mesmo
+ * arquivo usam as mesmas páginas do cache do sistema.
+ */
+class MappedGrid1D {
+public:
+    MappedGrid1D() = default;
+    MappedGrid1D(MappedGrid1D&& other) noexcept;
+    MappedGrid1D& operator=(MappedGrid1D&& other) noexcept;
+    MappedGrid1D(const MappedGrid1D&)            = delete;
+    MappedGrid1D& operator=(const MappedGrid1D&) = delete;
+    ~MappedGrid1D();
+
+    /**
+     * @brief Mapeia @p path e valida o cabeçalho (magic, versão, tamanho de
+     *        Real, ordem de bytes, tags de distribuição/centragem e limites
+     *        das seções).
+     * @param verify também recalcula o checksum (uma passada sobre os dados)
+     */
+    [[nodiscard]] static MappedGrid1D open(const std::string& path, bool verify = false);
+
+    [[nodiscard]] bool                    is_open() const noexcept { return m_addr != nullptr; }
+    [[nodiscard]] const api::Grid1DView&  view()    const noexcept { return m_view; }
+    [[nodiscard]] const Grid1DFileMeta&   meta()    const noexcept { return m_meta; }
+    [[nodiscard]] const Grid1DFileHeader& header()  const noexcept;
+
+    /// Recalcula o checksum e compara com o cabeçalho.
+    [[nodiscard]] bool verify(core::ExecPolicy policy = core::ExecPolicy::Auto) const;
+
+private:
+    void release() noexcept;
+
+    void*           m_addr {nullptr};
+    std::size_t     m_bytes{0};
+    api::Grid1DView m_view {};
+    Grid1DFileMeta  m_meta {};
+};
+
+FVMG_GRID1D_IO_CLOSE
@@ -1,9 +1,10 @@
 // ----------------------------------------------------------------------------
 // File: CellCentered.hpp
 // Author: FVMGridMaker Team
-// Version: 1.1
-// Date: 2025-10-25
-// Description: Centralização a partir de centros (calcula faces/deltas).
+// Version: 1.3
+// Date: 2025-10-27
+// Description: Centralização a partir de centros (calcula faces/deltas)
+//              via kernel fundido (ClosureKernel1D).
 // License: GNU GPL v3
 // ----------------------------------------------------------------------------
 #pragma once
@@ -11,14 +12,18 @@
 // ----------------------------------------------------------------------------
 // includes C++ 
 // ----------------------------------------------------------------------------
-#include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <span>
 
 // ----------------------------------------------------------------------------
 // includes FVMGridMaker  
 // ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/namespace.h>
 #include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Centering/ClosureKernel1D.hpp>
 
 FVMGRIDMAKER_NAMESPACE_OPEN
 GRID_NAMESPACE_OPEN
@@ -36,6 +41,12 @@ struct CellCentered {
     using Real = FVMGridMaker::core::Real;
     using Size = std::size_t;
 
+    /// Sequência base: centros.
+    static constexpr CenteringTag kTag = CenteringTag::CellCentered;
+
+    /// Política de execução do kernel de fechamento.
+    FVMGridMaker::core::ExecPolicy exec{FVMGridMaker::core::ExecPolicy::Auto};
+
     void operator()(std::span<const Real> xc,
                     std::span<Real>       xf,
                     std::span<Real>       dF,
@@ -48,47 +59,18 @@ struct CellCentered {
 
         if (N == 0) return;
 
-        if (N == 1) {
-            xf[0] = xc[0];
-            xf[1] = xc[0];
-        } else {
-            // faces internas i = 1..N-1: média de centros adjacentes
-            std::transform(
-                xc.begin(), xc.begin() + static_cast<std::ptrdiff_t>(N - 1),
-                xc.begin() + 1,
-                xf.begin() + 1,
-                [](Real a, Real b) { return Real(0.5) * (a + b); }
-            );
-
-            // bordas por meia-largura
+        // bordas por meia-largura (N == 1: faces degeneradas no centro)
+        Real xL = xc[0];
+        Real xR = xc[0];
+        if (N > 1) {
             const Real dxL = xc[1]     - xc[0];
             const Real dxR = xc[N - 1] - xc[N - 2];
-            xf[0] = xc[0]         - Real(0.5) * dxL;
-            xf[N] = xc[N - 1]     + Real(0.5) * dxR;
-        }
-
-        // dF[i] = xf[i+1] - xf[i], i = 0..N-1
-        std::transform(
-            xf.begin() + 1, xf.end(),
-            xf.begin(),
-            dF.begin(),
-            [](Real right, Real left) { return right - left; }
-        );
-
-        // dC: extremidades com meias-larguras + diferenças entre centros no miolo
-        dC[0] = xc[0] - xf[0];
-
-        if (N > 1) {
-            // dC[i] = xc[i] - xc[i-1], i = 1..N-1
-            std::transform(
-                xc.begin() + 1, xc.end(),
-                xc.begin(),
-                dC.begin() + 1,
-                [](Real cur, Real prev) { return cur - prev; }
-            );
+            xL = xc[0]     - Real(0.5) * dxL;
+            xR = xc[N - 1] + Real(0.5) * dxR;
         }
 
-        dC[N] = xf[N] - xc[N - 1];
+        // faces internas, dF e dC em uma varredura
+        close_from_centers(xc, xL, xR, xf, dF, dC, exec);
     }
 };
 
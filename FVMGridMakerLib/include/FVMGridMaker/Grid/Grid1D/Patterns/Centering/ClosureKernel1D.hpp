@@ -0,0 +1,261 @@
+// ----------------------------------------------------------------------------
+// File: ClosureKernel1D.hpp
+// Author: FVMGridMaker Team
+// Version: 1.2
+// Date: 2025-10-27
+// Description: Kernel fundido de fechamento 1D: a partir da sequência base
+//              (faces OU centros) escreve os outros três vetores em uma única
+//              varredura por blocos de cache, com caminho SIMD explícito;
+//              opcionalmente verifica dF > 0 e dC > 0 no mesmo bloco.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#pragma once
+
+/**
+ * @file  ClosureKernel1D.hpp
+ * @brief `close_from_faces` / `close_from_centers`.
+ *
+ * @details
+ * Cada bloco de @ref kClosureBlock células é processado por inteiro antes do
+ * próximo: as sub-passagens (médias, dF, dC) relêem dados que ainda estão na
+ * L1, de modo que a memória principal é percorrida uma vez (leitura da base,
+ * escrita das três saídas).
+ *
+ * O laço interno usa `std::experimental::simd` quando disponível (defina
+ * `FVMG_DISABLE_SIMD` para forçar o caminho escalar). As operações são as
+ * mesmas do caminho escalar (soma, produto por 0.5, diferença), logo o
+ * resultado é idêntico bit a bit para qualquer largura SIMD e qualquer
+ * `ExecPolicy`.
+ *
+ * Convenção de saída (N células):
+ *  - xf (N+1), xc (N), dF[i] = xf[i+1]-xf[i] (N),
+ *  - dC (N+1) = { xc0-xf0, xc1-xc0, ..., xfN-xcN-1 }.
+ *
+ * Com `check = true`, cada bloco verifica dF > 0 e dC > 0 logo após
+ * escrevê-los (ainda na L1) e o kernel devolve a menor posição k em [0, N]
+ * com dF[k] <= 0 (k < N) ou dC[k] <= 0 — isto é, faces não crescentes,
+ * centros não crescentes ou centro fora da célula (NaN também falha).
+ */
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <span>
+
+#if !defined(FVMG_DISABLE_SIMD) && __has_include(<experimental/simd>)
+  #include <experimental/simd>
+  #ifndef FVMG_HAVE_EXPERIMENTAL_SIMD
+    #define FVMG_HAVE_EXPERIMENTAL_SIMD 1
+  #endif
+#endif
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/ParallelFor.hpp>
+#include <FVMGridMaker/Core/namespace.h>
+#include <FVMGridMaker/Core/type.h>
+
+FVMGRIDMAKER_NAMESPACE_OPEN
+GRID_NAMESPACE_OPEN
+GRID1D_NAMESPACE_OPEN
+PATTERNS_NAMESPACE_OPEN
+CENTERING_NAMESPACE_OPEN
+
+/// Células por bloco (4 vetores × 2048 × 8 B = 64 KiB por bloco).
+inline constexpr std::size_t kClosureBlock = 2048;
+
+DETAIL_NAMESPACE_OPEN
+
+using Real = FVMGridMaker::core::Real;
+
+/// out[i] = 0.5 * (a[i] + a[i+1]), i = 0..n-1
+inline void midpoints(const Real* a, Real* out, std::size_t n) noexcept {
+    std::size_t i = 0;
+#ifdef FVMG_HAVE_EXPERIMENTAL_SIMD
+    namespace stdx = std::experimental;
+    using V = stdx::native_simd<Real>;
+    const V half(Real(0.5));
+    for (; i + V::size() <= n; i += V::size()) {
+        V l(a + i,      stdx::element_aligned);
+        V r(a + i + 1u, stdx::element_aligned);
+        const V m = half * (l + r);
+        m.copy_to(out + i, stdx::element_aligned);
+    }
+#endif
+    for (; i < n; ++i) out[i] = Real(0.5) * (a[i] + a[i + 1u]);
+}
+
+/// out[i] = a[i+1] - a[i], i = 0..n-1
+inline void differences(const Real* a, Real* out, std::size_t n) noexcept {
+    std::size_t i = 0;
+#ifdef FVMG_HAVE_EXPERIMENTAL_SIMD
+    namespace stdx = std::experimental;
+    using V = stdx::native_simd<Real>;
+    for (; i + V::size() <= n; i += V::size()) {
+        V l(a + i,      stdx::element_aligned);
+        V r(a + i + 1u, stdx::element_aligned);
+        const V d = r - l;
+        d.copy_to(out + i, stdx::element_aligned);
+    }
+#endif
+    for (; i < n; ++i) out[i] = a[i + 1u] - a[i];
+}
+
+/// Menor k em [lo, hi) com !(dF[k] > 0) ou !(dC[k] > 0), publicado em @p first.
+/// dC é verificado a partir de g0 (dC[0] é escrito fora do laço paralelo).
+inline void check_block(const Real* w, const Real* g, std::size_t lo, std::size_t g0,
+                        std::size_t hi, std::atomic<std::size_t>& first) noexcept {
+    unsigned bad = 0u;
+    for (std::size_t i = lo; i < hi; ++i) bad |= static_cast<unsigned>(!(w[i] > Real(0)));
+    for (std::size_t i = g0; i < hi; ++i) bad |= static_cast<unsigned>(!(g[i] > Real(0)));
+    if (bad == 0u) return;
+
+    std::size_t k = lo;
+    while (w[k] > Real(0) && (k < g0 || g[k] > Real(0))) ++k;
+    std::size_t cur = first.load(std::memory_order_relaxed);
+    while (k < cur && !first.compare_exchange_weak(cur, k, std::memory_order_relaxed)) {}
+}
+
+/// Completa a verificação com dC[0] e dC[N] (escritos após o laço).
+inline std::optional<std::size_t> check_ends(const Real* g, std::size_t N,
+                                             const std::atomic<std::size_t>& first) noexcept {
+    if (!(g[0] > Real(0))) return std::size_t(0);
+    const std::size_t k = first.load(std::memory_order_relaxed);
+    if (k <= N) return k;
+    if (!(g[N] > Real(0))) return N;
+    return std::nullopt;
+}
+
+DETAIL_NAMESPACE_CLOSE
+
+/**
+ * @brief Faces (N+1) → centros, dF e dC.
+ *
+ * @param xf     faces (entrada, N+1)
+ * @param xc     centros (saída, N)
+ * @param dF     larguras (saída, N)
+ * @param dC     distâncias centradas (saída, N+1)
+ * @param policy política de execução (blocos contíguos por thread)
+ * @param check  verifica dF > 0 e dC > 0 durante a varredura
+ * @return com @p check, a menor posição inválida (ver @ref ClosureKernel1D.hpp).
+ */
+inline std::optional<std::size_t>
+close_from_faces(std::span<const FVMGridMaker::core::Real> xf,
+                 std::span<FVMGridMaker::core::Real>       xc,
+                 std::span<FVMGridMaker::core::Real>       dF,
+                 std::span<FVMGridMaker::core::Real>       dC,
+                 FVMGridMaker::core::ExecPolicy policy =
+                     FVMGridMaker::core::ExecPolicy::Serial,
+                 bool check = false)
+{
+    using detail::Real;
+    const std::size_t N = xc.size();
+    if (N == 0) return std::nullopt;
+
+    const Real* f = xf.data();
+    Real*       c = xc.data();
+    Real*       w = dF.data();
+    Real*       g = dC.data();
+    std::atomic<std::size_t> first{N + 1u};
+
+    core::parallel_for_chunks(N, policy, [=, &first](std::size_t b, std::size_t e) {
+        for (std::size_t lo = b; lo < e; lo += kClosureBlock) {
+            const std::size_t hi = std::min(lo + kClosureBlock, e);
+            const std::size_t n  = hi - lo;
+
+            detail::midpoints  (f + lo, c + lo, n);
+            detail::differences(f + lo, w + lo, n);
+
+            // dC[i] = xc[i] - xc[i-1], i em [max(lo,1), hi)
+            if (lo == 0) {
+                detail::differences(c, g + 1, n - 1u);
+            } else {
+                // início do bloco de um thread: o centro anterior pertence a
+                // outro bloco; recalcula (mesma expressão) em vez de ler.
+                const Real prev = (lo == b) ? Real(0.5) * (f[lo - 1u] + f[lo])
+                                            : c[lo - 1u];
+                g[lo] = c[lo] - prev;
+                detail::differences(c + lo, g + lo + 1u, n - 1u);
+            }
+            if (check) detail::check_block(w, g, lo, std::max<std::size_t>(lo, 1u), hi, first);
+        }
+    });
+
+    g[0] = c[0] - f[0];
+    g[N] = f[N] - c[N - 1u];
+    return check ? detail::check_ends(g, N, first) : std::nullopt;
+}
+
+/**
+ * @brief Centros (N) → faces, dF e dC, com faces de borda dadas.
+ *
+ * @param xc     centros (entrada, N)
+ * @param xL     face esquerda xf[0]
+ * @param xR     face direita  xf[N]
+ * @param xf     faces (saída, N+1); internas = média dos centros adjacentes
+ * @param dF     larguras (saída, N)
+ * @param dC     distâncias centradas (saída, N+1)
+ * @param policy política de execução (blocos contíguos por thread)
+ * @param check  verifica dF > 0 e dC > 0 durante a varredura
+ * @return com @p check, a menor posição inválida (ver @ref ClosureKernel1D.hpp).
+ */
+inline std::optional<std::size_t>
+close_from_centers(std::span<const FVMGridMaker::core::Real> xc,
+                   FVMGridMaker::core::Real                  xL,
+                   FVMGridMaker::core::Real                  xR,
+                   std::span<FVMGridMaker::core::Real>       xf,
+                   std::span<FVMGridMaker::core::Real>       dF,
+                   std::span<FVMGridMaker::core::Real>       dC,
+                   FVMGridMaker::core::ExecPolicy policy =
+                       FVMGridMaker::core::ExecPolicy::Serial,
+                   bool check = false)
+{
+    using detail::Real;
+    const std::size_t N = xc.size();
+    if (N == 0) return std::nullopt;
+
+    const Real* c = xc.data();
+    Real*       f = xf.data();
+    Real*       w = dF.data();
+    Real*       g = dC.data();
+    std::atomic<std::size_t> first{N + 1u};
+
+    core::parallel_for_chunks(N, policy, [=, &first](std::size_t b, std::size_t e) {
+        for (std::size_t lo = b; lo < e; lo += kClosureBlock) {
+            const std::size_t hi = std::min(lo + kClosureBlock, e);
+            const std::size_t i0 = std::max<std::size_t>(lo, 1u);
+
+            // faces xf[i], i em [lo, hi)
+            if (lo == 0) f[0] = xL;
+            detail::midpoints(c + i0 - 1u, f + i0, hi - i0);
+
+            // dF[i], i em [lo, hi-1): faces já escritas neste bloco
+            detail::differences(f + lo, w + lo, hi - lo - 1u);
+            // última largura do bloco: a face xf[hi] é do próximo bloco
+            const Real fhi = (hi == N) ? xR : Real(0.5) * (c[hi - 1u] + c[hi]);
+            w[hi - 1u] = fhi - f[hi - 1u];
+
+            // dC[i] = xc[i] - xc[i-1], i em [i0, hi)
+            detail::differences(c + i0 - 1u, g + i0, hi - i0);
+
+            if (check) detail::check_block(w, g, lo, i0, hi, first);
+        }
+    });
+
+    f[N] = xR;
+    g[0] = c[0] - xL;
+    g[N] = xR - c[N - 1u];
+    return check ? detail::check_ends(g, N, first) : std::nullopt;
+}
+
+CENTERING_NAMESPACE_CLOSE
+PATTERNS_NAMESPACE_CLOSE
+GRID1D_NAMESPACE_CLOSE
+GRID_NAMESPACE_CLOSE
+FVMGRIDMAKER_NAMESPACE_CLOSE
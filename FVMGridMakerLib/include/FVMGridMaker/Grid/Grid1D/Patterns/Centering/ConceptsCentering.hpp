@@ -1,8 +1,8 @@
 // ----------------------------------------------------------------------------
 // File: ConceptsCentering.hpp
 // Author: FVMGridMaker Team
-// Version: 1.0
-// Date: 2025-10-25
+// Version: 1.1
+// Date: 2025-10-27
 // Description: Concepts e detecções para functors de centralização 1D.
 // License: GNU GPL v3
 // ----------------------------------------------------------------------------
@@ -20,6 +20,7 @@
 // ----------------------------------------------------------------------------
 #include <FVMGridMaker/Core/namespace.h>
 #include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
 
 FVMGRIDMAKER_NAMESPACE_OPEN
 GRID_NAMESPACE_OPEN
@@ -68,6 +69,14 @@ concept CenteringFromCenters =
     { c(xc, xf, dF, dC) } -> std::same_as<void>;
 };
 
+// Concept: functor completo de centralização 1D.
+// As duas assinaturas acima são idênticas em tipos; a sequência base
+// (faces ou centros) é informada por `C::kTag` (CenteringTag).
+template<class C>
+concept Centering1D =
+    CenteringFromFaces<C> &&
+    requires { { C::kTag } -> std::convertible_to<FVMGridMaker::grid::CenteringTag>; };
+
 // Variáveis auxiliares (usadas pela CenteringLut.hpp)
 template<class C>
 inline constexpr bool kHasFromFaces   = CenteringFromFaces<C>;
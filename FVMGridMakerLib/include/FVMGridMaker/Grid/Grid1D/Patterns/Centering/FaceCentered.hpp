@@ -1,9 +1,10 @@
 // ----------------------------------------------------------------------------
 // File: FaceCentered.hpp
 // Author: FVMGridMaker Team
-// Version: 1.3
-// Date: 2025-10-25
-// Description: faces → centers, dF, dC (sem checks; STL com policy configurável).
+// Version: 1.5
+// Date: 2025-10-27
+// Description: faces → centers, dF, dC (sem checks; kernel fundido
+//              ClosureKernel1D com ExecPolicy configurável).
 // License: GNU GPL v3
 // ----------------------------------------------------------------------------
 #pragma once
@@ -11,9 +12,6 @@
 // ----------------------------------------------------------------------------
 // includes C++ 
 // ----------------------------------------------------------------------------
-#include <algorithm>
-#include <cstddef>    // std::ptrdiff_t
-#include <execution>
 #include <span>
 
 // ----------------------------------------------------------------------------
@@ -22,6 +20,8 @@
 #include <FVMGridMaker/Core/ExecPolicy.hpp>
 #include <FVMGridMaker/Core/namespace.h>
 #include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Centering/ClosureKernel1D.hpp>
 
 FVMGRIDMAKER_NAMESPACE_OPEN
 GRID_NAMESPACE_OPEN
@@ -33,40 +33,19 @@ struct FaceCentered {
     using Real = FVMGridMaker::core::Real;
     using Size = FVMGridMaker::core::Index;
 
+    /// Sequência base: faces.
+    static constexpr CenteringTag kTag = CenteringTag::FaceCentered;
+
+    /// Política de execução do kernel de fechamento.
+    FVMGridMaker::core::ExecPolicy exec{FVMGridMaker::core::ExecPolicy::Auto};
+
     void operator()(std::span<const Real> xf,
                     std::span<Real>       xc,
                     std::span<Real>       dF,
-                    std::span<Real>       dC) const noexcept
+                    std::span<Real>       dC) const
     {
-        const Size N  = static_cast<Size>(xc.size());
-        const auto pN = static_cast<std::ptrdiff_t>(N);
-
-        auto midpoint = [](Real a, Real b) noexcept { return (a + b) * Real(0.5); };
-        auto diff_ba  = [](Real a, Real b) noexcept { return b - a; };
-        auto diff_ab  = [](Real a, Real b) noexcept { return a - b; };
-
-        // centers
-        std::transform(FVMG_EXEC_POLICY,
-                       xf.begin(), xf.begin() + pN,
-                       xf.begin() + 1,
-                       xc.begin(),
-                       midpoint);
-
-        // dF
-        std::transform(FVMG_EXEC_POLICY,
-                       xf.begin(), xf.begin() + pN,
-                       xf.begin() + 1,
-                       dF.begin(),
-                       diff_ba);
-
-        // dC bordas + miolo
-        dC[0] = xc[0] - xf[0];
-        std::transform(FVMG_EXEC_POLICY,
-                       xc.begin() + 1, xc.begin() + pN,
-                       xc.begin(),
-                       dC.begin() + 1,
-                       diff_ab);
-        dC[N] = xf[N] - xc[N - 1];
+        // centros, dF e dC em uma varredura por blocos
+        close_from_faces(xf, xc, dF, dC, exec);
     }
 };
 
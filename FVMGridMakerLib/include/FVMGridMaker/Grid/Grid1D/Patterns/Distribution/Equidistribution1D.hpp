@@ -0,0 +1,286 @@
+// ----------------------------------------------------------------------------
+// File: Equidistribution1D.hpp
+// Author: FVMGridMaker Team
+// Version: 1.1
+// Date: 2025-10-27
+// Description: Distribuição Equidistribution1D (malha adaptativa): faces
+//              posicionadas de modo que cada célula contenha a mesma
+//              integral de uma função monitora w(x) ≥ 0 (função ou
+//              densidade amostrada).
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#pragma once
+
+/**
+ * @file   Equidistribution1D.hpp
+ * @brief  Malhas 1D por equidistribuição de uma função monitora.
+ *
+ * @details
+ * Com W(x) = ∫_A^x w e T = W(B), as faces satisfazem W(xf[i]) = i·T/N:
+ * células menores onde w é grande. O monitor é uma das fontes (nesta
+ * ordem de prioridade):
+ *   - `monitor`: função w(x), amostrada em `samples` pontos uniformes de
+ *     [A, B] (0 → 4N + 1). Chamada em paralelo conforme `exec`: deve ser
+ *     thread-safe (ou use ExecPolicy::Serial);
+ *   - `density`: amostras w_k em pontos uniformes de [A, B] ou, se
+ *     `positions` não estiver vazio, nos pontos x_k (estritamente
+ *     crescentes, dentro de [A, B]; ex.: centros da malha anterior). Fora
+ *     de [x_0, x_{M-1}] a densidade é estendida constante;
+ *   - nenhum: w = 1 (malha uniforme).
+ * Entre amostras w é linear por partes, logo W é quadrática por partes e
+ * a inversa é exata no segmento:
+ *     s = 2R / (w_k + sqrt(w_k² + 2·g_k·R)),   R = τ - W_k, g_k = Δw/Δx
+ * (forma estável, sem cancelamento, válida para g_k = 0).
+ *
+ * Custo O(N + M), paralelizável:
+ *   1. integral acumulada W_k por trapézios + `core::compensated_inclusive_scan`
+ *      (blocos fixos: mesmo resultado para qualquer ExecPolicy);
+ *   2. faces divididas em blocos contíguos; cada bloco faz UMA busca
+ *      binária pelo segmento da sua primeira face (partição tipo
+ *      merge-path: alvos i·T/N e W_k são ambos monótonos) e depois avança
+ *      o segmento junto com i (fusão linear).
+ * Cada face depende só do seu índice; xf[0] = A e xf[N] = B exatos;
+ * centros pelas médias das faces.
+ *
+ * Notas:
+ *   - Amostras finitas e ≥ 0 com integral total > 0; senão lança
+ *     `std::invalid_argument`. Regiões com w = 0 ficam dentro de uma única
+ *     célula.
+ *   - Os vetores das Options não são copiados a cada chamada (o payload
+ *     do registro é lido por ponteiro).
+ */
+
+#include <FVMGridMaker/Core/CompensatedScan.hpp>
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/ParallelFor.hpp>
+#include <FVMGridMaker/Core/namespace.h>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/FaceKernelDistribution1D.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+FVMGRIDMAKER_NAMESPACE_OPEN
+GRID_NAMESPACE_OPEN
+GRID1D_NAMESPACE_OPEN
+PATTERNS_NAMESPACE_OPEN
+DISTRIBUTION_NAMESPACE_OPEN
+
+struct Equidistribution1DOptions {
+    /// Função monitora w(x) ≥ 0 (tem prioridade sobre `density`).
+    std::function<core::Real(core::Real)> monitor{};
+
+    /// Amostras do monitor (0 → 4N + 1; senão ≥ 2).
+    core::Index samples { 0 };
+
+    /// Densidade amostrada w_k ≥ 0.
+    std::vector<core::Real> density{};
+
+    /// Posições x_k das amostras (vazio → uniformes em [A, B]).
+    std::vector<core::Real> positions{};
+
+    /// Amostragem do monitor, integral e inversa por blocos.
+    core::ExecPolicy exec { core::ExecPolicy::Auto };
+};
+
+class Equidistribution1D
+    : public detail::FaceKernelDistribution1D<Equidistribution1D, Equidistribution1DOptions> {
+    using Base = detail::FaceKernelDistribution1D<Equidistribution1D, Equidistribution1DOptions>;
+    friend Base;
+
+public:
+    using Options = Equidistribution1DOptions;
+
+    Equidistribution1D() = default;
+    explicit Equidistribution1D(Options opt) : Base(std::move(opt)) {}
+
+private:
+    static constexpr const char* kName = "Equidistribution1D";
+
+    // Amostras (x_k, w_k), k < M, cobrindo [A, B], e W_k = ∫_A^{x_k} w.
+    // x/w apontam para as Options quando não é preciso copiar.
+    struct Table {
+        std::vector<Real>     x_own, w_own, W;
+        std::span<const Real> x, w;
+    };
+
+    // ------------------------------------------------------------------------
+    // Integral acumulada
+    // ------------------------------------------------------------------------
+    static Table tabulate(Size N, Real A, Real B, const Options& o) {
+        Table t;
+        if (o.monitor) {
+            const Size M = o.samples ? static_cast<Size>(o.samples) : 4u * N + 1u;
+            if (M < 2u) {
+                throw std::invalid_argument("Equidistribution1D: samples deve ser >= 2.");
+            }
+            t.x_own = uniform_nodes(M, A, B, o.exec);
+            t.w_own.resize(M);
+            const Real* xs = t.x_own.data();
+            Real*       ws = t.w_own.data();
+            core::parallel_for_chunks(M, o.exec, [&o, xs, ws](std::size_t b, std::size_t e) {
+                for (std::size_t k = b; k < e; ++k) ws[k] = o.monitor(xs[k]);
+            });
+            t.x = t.x_own;
+            t.w = t.w_own;
+        } else if (!o.density.empty() && o.positions.empty()) {
+            if (o.density.size() < 2u) {
+                throw std::invalid_argument(
+                    "Equidistribution1D: densidade em pontos uniformes exige >= 2 amostras.");
+            }
+            t.x_own = uniform_nodes(o.density.size(), A, B, o.exec);
+            t.x     = t.x_own;
+            t.w     = o.density;
+        } else if (!o.density.empty()) {
+            extend_positions(t, A, B, o);
+        } else {
+            t.x_own = {A, B};
+            t.w_own = {Real(1), Real(1)};
+            t.x     = t.x_own;
+            t.w     = t.w_own;
+        }
+
+        const Size M  = t.w.size();
+        const Real* x = t.x.data();
+        const Real* w = t.w.data();
+        const bool bad = core::deterministic_reduce(M, o.exec, false,
+            [w](std::size_t b, std::size_t e) {
+                bool any = false;
+                for (std::size_t k = b; k < e; ++k) any = any || !(w[k] >= Real(0) && std::isfinite(w[k]));
+                return any;
+            },
+            [](bool a, bool b) { return a || b; });
+        if (bad) {
+            throw std::invalid_argument("Equidistribution1D: monitor deve ser finito e >= 0.");
+        }
+
+        // W_0 = 0, W_{k+1} = W_k + trapézio do segmento k
+        t.W.resize(M);
+        t.W[0] = Real(0);
+        Real* W = t.W.data();
+        core::parallel_for_chunks(M - 1u, o.exec, [x, w, W](std::size_t b, std::size_t e) {
+            for (std::size_t k = b; k < e; ++k) {
+                W[k + 1u] = Real(0.5) * (w[k] + w[k + 1u]) * (x[k + 1u] - x[k]);
+            }
+        });
+        core::compensated_inclusive_scan(std::span<Real>(W + 1, M - 1u), o.exec);
+
+        const Real total = t.W.back();
+        if (!(total > Real(0) && std::isfinite(total))) {
+            throw std::invalid_argument("Equidistribution1D: integral do monitor deve ser > 0.");
+        }
+        return t;
+    }
+
+    // x_k = lerp(A, B, k/(M-1)): extremos exatos
+    static std::vector<Real> uniform_nodes(Size M, Real A, Real B, core::ExecPolicy exec) {
+        std::vector<Real> x(M);
+        const Real inv = Real(1) / static_cast<Real>(M - 1u);
+        Real* p = x.data();
+        core::parallel_for_chunks(M, exec, [p, A, B, inv](std::size_t b, std::size_t e) {
+            for (std::size_t k = b; k < e; ++k) p[k] = std::lerp(A, B, static_cast<Real>(k) * inv);
+        });
+        p[M - 1u] = B;
+        return x;
+    }
+
+    // Amostras em posições dadas; extensão constante até A e B se preciso
+    static void extend_positions(Table& t, Real A, Real B, const Options& o) {
+        const auto& px = o.positions;
+        const auto& pw = o.density;
+        if (px.size() != pw.size()) {
+            throw std::invalid_argument(
+                "Equidistribution1D: positions e density devem ter o mesmo tamanho.");
+        }
+        if (!(px.front() >= A && px.back() <= B)) {
+            throw std::invalid_argument("Equidistribution1D: positions fora de [A, B].");
+        }
+        if (std::adjacent_find(px.begin(), px.end(), [](Real a, Real b) { return !(a < b); })
+            != px.end()) {
+            throw std::invalid_argument(
+                "Equidistribution1D: positions deve ser estritamente crescente.");
+        }
+
+        const bool head = px.front() > A;
+        const bool tail = px.back()  < B;
+        if (!head && !tail) {
+            t.x = px;
+            t.w = pw;
+            return;
+        }
+        const Size M = px.size() + (head ? 1u : 0u) + (tail ? 1u : 0u);
+        t.x_own.reserve(M);
+        t.w_own.reserve(M);
+        if (head) { t.x_own.push_back(A); t.w_own.push_back(pw.front()); }
+        t.x_own.insert(t.x_own.end(), px.begin(), px.end());
+        t.w_own.insert(t.w_own.end(), pw.begin(), pw.end());
+        if (tail) { t.x_own.push_back(B); t.w_own.push_back(pw.back()); }
+        t.x = t.x_own;
+        t.w = t.w_own;
+    }
+
+    // ------------------------------------------------------------------------
+    // Inversa: W(xf[i]) = i·T/N
+    // ------------------------------------------------------------------------
+    struct Inverse {
+        const Real* x;
+        const Real* w;
+        const Real* W;
+        Size        M;
+        Size        N;
+        Real        A, B, T;
+
+        Inverse(const Table& t, Size n, Real a, Real b) noexcept
+            : x(t.x.data()), w(t.w.data()), W(t.W.data()), M(t.W.size()), N(n),
+              A(a), B(b), T(t.W.back())
+        {}
+
+        Real target(Size i) const noexcept {
+            return T * (static_cast<Real>(i) / static_cast<Real>(N));
+        }
+
+        // Faces de índice first .. first+out.size()-1 (≤ N)
+        void faces(Size first, std::span<Real> out) const noexcept {
+            if (out.empty()) return;
+            const Size last = first + out.size();   // exclusivo
+
+            // Partição: maior k com W_k ≤ alvo da primeira face (k ≤ M-2)
+            Size k = static_cast<Size>(std::upper_bound(W, W + M, target(first)) - W);
+            k = std::min(k == 0u ? Size(0) : k - 1u, M - 2u);
+
+            for (Size i = first; i < last; ++i) {
+                const Real tau = target(i);
+                while (k + 2u < M && W[k + 1u] <= tau) ++k;   // fusão
+
+                const Real R    = tau - W[k];
+                const Real h    = x[k + 1u] - x[k];
+                const Real wk   = w[k];
+                const Real g    = (w[k + 1u] - wk) / h;
+                const Real den  = wk + std::sqrt(std::max(wk * wk + 2 * g * R, Real(0)));
+                const Real s    = den > Real(0) ? 2 * R / den : Real(0);
+                out[i - first]  = x[k] + std::min(s, h);
+            }
+            if (first == 0)     out[0] = A;
+            if (last == N + 1u) out[out.size() - 1u] = B;
+        }
+    };
+
+    // Tabela do monitor (W_k) viva durante run(k)
+    template <class Run>
+    static void with_kernel(Size n, Real A, Real B, const Options& cfg, Run&& run) {
+        const Table t = tabulate(n, A, B, cfg);
+        run(Inverse(t, n, A, B));
+    }
+};
+
+DISTRIBUTION_NAMESPACE_CLOSE
+PATTERNS_NAMESPACE_CLOSE
+GRID1D_NAMESPACE_CLOSE
+GRID_NAMESPACE_CLOSE
+FVMGRIDMAKER_NAMESPACE_CLOSE
@@ -0,0 +1,199 @@
+// ----------------------------------------------------------------------------
+// File: FaceKernelDistribution1D.hpp
+// Author: FVMGridMaker Team
+// Version: 1.0
+// Date: 2025-10-27
+// Description: Base CRTP das distribuições definidas por um kernel de faces
+//              em faixa (Geometric1D, Vinokur1D, Equidistribution1D):
+//              functor, faces/centers(_into), ponte std::any e validação.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#pragma once
+
+/**
+ * @file   FaceKernelDistribution1D.hpp
+ * @brief  Andaime comum das distribuições com kernel de faces em faixa.
+ *
+ * @details
+ * `Derived` fornece apenas:
+ *   - `kName` (prefixo das mensagens de erro);
+ *   - `with_kernel(N, A, B, cfg, run)`: valida `cfg`, monta o kernel e
+ *     chama `run(k)`, onde `k.faces(first, out)` escreve as faces
+ *     first .. first+out.size()-1, cada uma dependendo só do seu índice.
+ *
+ * A base escreve as faces em blocos de `core::parallel_for_chunks`
+ * conforme `Options::exec` (mesmo resultado para qualquer política) e os
+ * centros como médias das faces, gerando kCenterTile+1 faces por vez numa
+ * pilha local (sem vetor de faces). As opções são lidas por referência:
+ * nem a ponte std::any nem as sobrecargas com `Options*` as copiam.
+ */
+
+#include <FVMGridMaker/Core/ParallelFor.hpp>
+#include <FVMGridMaker/Core/namespace.h>
+#include <FVMGridMaker/Core/type.h>
+
+#include <algorithm>
+#include <any>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+FVMG_GRID1D_DIST_DETAIL_OPEN
+
+template <class Derived, class Options>
+class FaceKernelDistribution1D {
+public:
+    using Real  = FVMGridMaker::core::Real;
+    using Index = FVMGridMaker::core::Index;
+    using Size  = std::size_t;
+
+    // ------------------------------------------------------------------------
+    // Forma de functor (concept Distribution1D) — usada por Grid1DBuilderT
+    // ------------------------------------------------------------------------
+
+    /// Faces (N+1) em @p xf.
+    void makeFaces(Index N, Real A, Real B, std::span<Real> xf,
+                   std::uint64_t /*seed*/ = 0, Real /*dx_min*/ = Real(0)) const
+    {
+        faces_into(N, A, B, xf, &m_opt);
+    }
+
+    /// Centros (N) em @p xc.
+    void makeCenters(Index N, Real A, Real B, std::span<Real> xc,
+                     std::uint64_t /*seed*/ = 0, Real /*dx_min*/ = Real(0)) const
+    {
+        centers_into(N, A, B, xc, &m_opt);
+    }
+
+    [[nodiscard]] const Options& options() const noexcept { return m_opt; }
+
+    // ------------------------------------------------------------------------
+    // Interface principal
+    // ------------------------------------------------------------------------
+    static std::vector<Real> faces(Index n, Real A, Real B,
+                                   const Options* opt = nullptr)
+    {
+        std::vector<Real> xf(static_cast<std::size_t>(n + 1));
+        faces_into(n, A, B, xf, opt);
+        return xf;
+    }
+
+    static std::vector<Real> centers(Index n, Real A, Real B,
+                                     const Options* opt = nullptr)
+    {
+        std::vector<Real> xc(static_cast<std::size_t>(n));
+        centers_into(n, A, B, xc, opt);
+        return xc;
+    }
+
+    /// Escreve as N+1 faces em @p xf (memória do chamador).
+    static void faces_into(Index n, Real A, Real B, std::span<Real> xf,
+                           const Options* opt = nullptr)
+    {
+        ensure_inputs(n, A, B);
+        ensure_size(xf, static_cast<std::size_t>(n) + 1u);
+        const Options& cfg = opt ? *opt : default_options();
+
+        Derived::with_kernel(static_cast<Size>(n), A, B, cfg, [&cfg, xf](const auto& k) {
+            core::parallel_for_chunks(xf.size(), cfg.exec,
+                [&k, xf](std::size_t b, std::size_t e) {
+                    k.faces(b, xf.subspan(b, e - b));
+                });
+        });
+    }
+
+    /// Escreve os N centros em @p xc (médias das faces, sem vetor de faces).
+    static void centers_into(Index n, Real A, Real B, std::span<Real> xc,
+                             const Options* opt = nullptr)
+    {
+        ensure_inputs(n, A, B);
+        ensure_size(xc, static_cast<std::size_t>(n));
+        const Options& cfg = opt ? *opt : default_options();
+
+        Derived::with_kernel(static_cast<Size>(n), A, B, cfg, [&cfg, xc](const auto& k) {
+            core::parallel_for_chunks(xc.size(), cfg.exec,
+                [&k, xc](std::size_t b, std::size_t e) {
+                    std::array<Real, kCenterTile + 1u> f;
+                    for (std::size_t lo = b; lo < e; lo += kCenterTile) {
+                        const std::size_t cnt = std::min(kCenterTile, e - lo);
+                        k.faces(lo, std::span<Real>(f.data(), cnt + 1u));
+                        for (std::size_t t = 0; t < cnt; ++t) {
+                            xc[lo + t] = Real(0.5) * (f[t] + f[t + 1u]);
+                        }
+                    }
+                });
+        });
+    }
+
+    // ------------------------------------------------------------------------
+    // Ponte para o registro (std::any*): payload lido por ponteiro
+    // ------------------------------------------------------------------------
+    static std::vector<Real> faces(Index n, Real A, Real B, const std::any* any_opt)
+    {
+        return faces(n, A, B, options_from_any(any_opt));
+    }
+
+    static std::vector<Real> centers(Index n, Real A, Real B, const std::any* any_opt)
+    {
+        return centers(n, A, B, options_from_any(any_opt));
+    }
+
+    static void faces_into(Index n, Real A, Real B, std::span<Real> xf,
+                           const std::any* any_opt)
+    {
+        faces_into(n, A, B, xf, options_from_any(any_opt));
+    }
+
+    static void centers_into(Index n, Real A, Real B, std::span<Real> xc,
+                             const std::any* any_opt)
+    {
+        centers_into(n, A, B, xc, options_from_any(any_opt));
+    }
+
+protected:
+    FaceKernelDistribution1D() = default;
+    explicit FaceKernelDistribution1D(Options opt) : m_opt(std::move(opt)) {}
+
+    Options m_opt{};
+
+private:
+    static constexpr Size kCenterTile = 64;
+
+    static void ensure_inputs(Index n, Real A, Real B) {
+        if (n == 0) {
+            throw std::invalid_argument(
+                std::string(Derived::kName) + "::faces/centers(): N deve ser > 0.");
+        }
+        if (!(B > A)) {
+            throw std::invalid_argument(
+                std::string(Derived::kName) + "::faces/centers(): exige dominio com B > A.");
+        }
+    }
+
+    static void ensure_size(std::span<Real> out, std::size_t expected) {
+        if (out.size() != expected) {
+            throw std::invalid_argument(
+                std::string(Derived::kName) +
+                "::faces_into/centers_into(): tamanho do span inválido.");
+        }
+    }
+
+    static const Options& default_options() {
+        static const Options o{};
+        return o;
+    }
+
+    static const Options* options_from_any(const std::any* any_opt) {
+        if (any_opt && any_opt->has_value()) {
+            if (const auto* o = std::any_cast<Options>(any_opt)) return o;
+        }
+        return nullptr;
+    }
+};
+
+FVMG_GRID1D_DIST_DETAIL_CLOSE
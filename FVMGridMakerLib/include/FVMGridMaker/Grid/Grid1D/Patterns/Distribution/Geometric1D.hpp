@@ -0,0 +1,271 @@
+// ----------------------------------------------------------------------------
+// File: Geometric1D.hpp
+// Author: FVMGridMaker Team
+// Version: 1.2
+// Date: 2025-10-27
+// Description: Distribuição Geometric1D (malha esticada): larguras em
+//              progressão geométrica d_{i+1} = r·d_i, com faces em forma
+//              fechada xf[i] = A + L·(r^i - 1)/(r^N - 1).
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#pragma once
+
+/**
+ * @file   Geometric1D.hpp
+ * @brief  Malhas 1D com larguras em progressão geométrica (camada-limite).
+ *
+ * @details
+ * Com L = B - A e razão r = d_{i+1}/d_i:
+ *     xf[i] = A + L·(r^i - 1)/(r^N - 1),   d_0 = L·(r - 1)/(r^N - 1).
+ * r > 1 refina junto de A, r < 1 junto de B, r = 1 é a malha uniforme.
+ *
+ * Kernel (sem acumulação serial): com q = ln r e k = s + j, s múltiplo de
+ * kBlock e 0 ≤ j < kBlock,
+ *     r^k - 1 = e_s·p_j + m_j,   e_s = expm1(s·q), m_j = expm1(j·q), p_j = m_j + 1.
+ * As tabelas m_j, p_j são calculadas uma vez por chamada e e_s uma vez por
+ * bloco; o laço interno é um produto-soma sobre tabelas contíguas
+ * (vetorizável). Os dois termos têm o sinal de q, logo não há cancelamento
+ * (ao contrário de r^i - 1 perto de r = 1), e cada face depende só do seu
+ * índice: blocos paralelos dão o mesmo resultado para qualquer ExecPolicy.
+ *
+ * As frações são medidas a partir da extremidade com as células pequenas
+ * (A se r > 1, B se r < 1): as faces próximas dela não perdem dígitos para
+ * L. Se r^N estoura nessa orientação, usa-se a outra. xf[0] = A e
+ * xf[N] = B exatos; centros pelas médias das faces.
+ *
+ * Notas:
+ *   - Erro absoluto ~ (1 + N·|ln r|)·eps·L: vem de ln r arredondado (a
+ *     razão entre larguras vizinhas segue exata a poucos ulps).
+ *   - Razão em [kMinRatio, kMaxRatio]; fora disso (ou não finita) lança
+ *     `std::invalid_argument`.
+ *   - A menor célula, L·expm1(|q|)/expm1(N·|q|), precisa ficar acima da
+ *     resolução de A/B (eps·max(|A|,|B|)); abaixo disso haveria faces
+ *     repetidas e faces_into/centers_into lançam `std::invalid_argument`
+ *     (ex.: r = 1.1 com N = 1e5, r = 0.9 com N = 1000).
+ *   - `ratio_for_first_width(N, L, d0)` resolve r a partir da primeira
+ *     largura (uso típico em camada-limite).
+ */
+
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/namespace.h>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/FaceKernelDistribution1D.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+
+FVMGRIDMAKER_NAMESPACE_OPEN
+GRID_NAMESPACE_OPEN
+GRID1D_NAMESPACE_OPEN
+PATTERNS_NAMESPACE_OPEN
+DISTRIBUTION_NAMESPACE_OPEN
+
+struct Geometric1DOptions {
+    core::Real ratio { core::Real(1.1) };   ///< r = d_{i+1}/d_i (> 0)
+    core::ExecPolicy exec { core::ExecPolicy::Auto };   ///< blocos de faces
+};
+
+class Geometric1D
+    : public detail::FaceKernelDistribution1D<Geometric1D, Geometric1DOptions> {
+    using Base = detail::FaceKernelDistribution1D<Geometric1D, Geometric1DOptions>;
+    friend Base;
+
+public:
+    using Options = Geometric1DOptions;
+
+    static constexpr Real kMinRatio = Real(1e-4);
+    static constexpr Real kMaxRatio = Real(1e4);
+
+    Geometric1D() = default;
+    explicit Geometric1D(const Options& opt) : Base(opt) { ensure_ratio(opt.ratio); }
+
+    /**
+     * @brief Face xf[i] em forma fechada (AnalyticGrid1D).
+     *
+     * Mesmos bits de facesRange/faces_into; custa ~4 funções
+     * transcendentes por chamada (sem tabelas).
+     */
+    Real face(Size i, Size N, Real A, Real B) const noexcept
+    {
+        return Setup(N, A, B, m_opt.ratio).face(i);
+    }
+
+    /// Faces xf[first .. first+out.size()) de uma malha de N células.
+    void facesRange(Size N, Real A, Real B, Size first, std::span<Real> out) const noexcept
+    {
+        Kernel(N, A, B, m_opt.ratio).faces(first, out);
+    }
+
+    /**
+     * @brief Razão r cuja primeira célula de uma malha de N células em um
+     *        domínio de comprimento L tem largura @p d0 (0 < d0 < L).
+     *
+     * @details d0/L = expm1(q)/expm1(N·q), q = ln r, é decrescente em q:
+     * bissecção em q. d0 < L/N dá r > 1; d0 > L/N, r < 1.
+     */
+    static Real ratio_for_first_width(Index n, Real L, Real d0)
+    {
+        if (n == 0 || !(L > Real(0)) || !(d0 > Real(0)) || !(d0 < L)) {
+            throw std::invalid_argument(
+                "Geometric1D::ratio_for_first_width(): exige N > 0 e 0 < d0 < L.");
+        }
+        const Real N      = static_cast<Real>(n);
+        const Real target = d0 / L;
+        auto frac = [N](Real q) {
+            return q == Real(0) ? Real(1) / N : std::expm1(q) / std::expm1(N * q);
+        };
+
+        Real q_lo = std::log(kMinRatio);
+        Real q_hi = std::log(kMaxRatio);
+        for (int it = 0; it < 200 && q_lo < q_hi; ++it) {
+            const Real q = Real(0.5) * (q_lo + q_hi);
+            if (q == q_lo || q == q_hi) break;
+            if (frac(q) > target) q_lo = q;
+            else                  q_hi = q;
+        }
+        return std::clamp(std::exp(Real(0.5) * (q_lo + q_hi)), kMinRatio, kMaxRatio);
+    }
+
+private:
+    static constexpr const char* kName = "Geometric1D";
+    static constexpr Size kBlock = 64;
+
+    // Orientação e constantes da forma fechada (um log e um expm1):
+    //   from_a: xf[i] = A + c·F(i),   senão: xf[i] = B - c·F(N-i),
+    //   F(k) = expm1(k·q) pela decomposição em blocos, c = L/expm1(N·q).
+    struct Setup {
+        Size N;
+        Real A, B;
+        bool uniform;
+        bool from_a{true};
+        Real q{0};
+        Real c{0};
+
+        Setup(Size n, Real a, Real b, Real ratio) noexcept
+            : N(n), A(a), B(b), uniform(ratio == Real(1))
+        {
+            if (uniform) {
+                c = (B - A) / static_cast<Real>(N);
+                return;
+            }
+            const Real lr = std::log(ratio);
+            from_a = lr > Real(0);
+            q      = from_a ? lr : -lr;
+            Real den = std::expm1(static_cast<Real>(N) * q);
+            if (!std::isfinite(den)) {
+                from_a = !from_a;
+                q      = -q;
+                den    = std::expm1(static_cast<Real>(N) * q);
+            }
+            c = (B - A) / den;
+        }
+
+        /// Menor largura: L·expm1(|q|)/expm1(N·|q|) (0 se r^N estoura).
+        Real min_width() const noexcept {
+            if (uniform) return c;
+            const Real aq = std::abs(q);
+            return (B - A) * (std::expm1(aq) / std::expm1(static_cast<Real>(N) * aq));
+        }
+
+        Real face(Size i) const noexcept {
+            if (i == 0) return A;
+            if (i == N) return B;
+            if (uniform) return A + static_cast<Real>(i) * c;
+            const Size k = from_a ? i : N - i;
+            const Size j = k % kBlock;
+            const Real m = std::expm1(static_cast<Real>(j) * q);
+            const Real e = std::expm1(static_cast<Real>(k - j) * q);
+            const Real F = e * (m + Real(1)) + m;
+            return from_a ? A + c * F : B - c * F;
+        }
+    };
+
+    // Setup + tabelas m_j, p_j (j < kBlock) para o kernel em faixa
+    struct Kernel : Setup {
+        std::array<Real, kBlock> m{};
+        std::array<Real, kBlock> p{};
+
+        Kernel(Size n, Real a, Real b, Real ratio) noexcept
+            : Setup(n, a, b, ratio)
+        {
+            if (this->uniform) return;
+            const Size jn = std::min(kBlock, n + 1u);
+            for (Size j = 0; j < jn; ++j) {
+                m[j] = std::expm1(static_cast<Real>(j) * this->q);
+                p[j] = m[j] + Real(1);
+            }
+        }
+
+        // Faces de índice first .. first+out.size()-1 (≤ N)
+        void faces(Size first, std::span<Real> out) const noexcept {
+            if (out.empty()) return;
+            const Size last = first + out.size();   // exclusivo
+            const Real a = this->A, b = this->B, cc = this->c;
+            Real* const o = out.data();
+
+            if (this->uniform) {
+                for (Size i = first; i < last; ++i) o[i - first] = a + static_cast<Real>(i) * cc;
+            } else if (this->from_a) {
+                // k = i: blocos de kBlock em ordem crescente
+                for (Size s = first - first % kBlock; s < last; s += kBlock) {
+                    const Real e  = std::expm1(static_cast<Real>(s) * this->q);
+                    const Size j0 = std::max(s, first) - s;
+                    const Size j1 = std::min(s + kBlock, last) - s;
+                    Real* const d = o + (s - first);
+                    for (Size j = j0; j < j1; ++j) d[j] = a + cc * (e * p[j] + m[j]);
+                }
+            } else {
+                // k = N - i, k ∈ (N-last, N-first]: escrita de trás para frente
+                const Size k_lo = this->N + 1u - last;
+                const Size k_hi = this->N - first;   // inclusivo
+                for (Size s = k_lo - k_lo % kBlock; s <= k_hi; s += kBlock) {
+                    const Real e  = std::expm1(static_cast<Real>(s) * this->q);
+                    const Size j0 = std::max(s, k_lo) - s;
+                    const Size j1 = std::min(s + kBlock - 1u, k_hi) - s + 1u;
+                    const Size base = this->N - s - first;   // o[base-j] = face N-s-j
+                    for (Size j = j0; j < j1; ++j) o[base - j] = b - cc * (e * p[j] + m[j]);
+                }
+            }
+            if (first == 0)           o[0] = a;
+            if (last == this->N + 1u) o[out.size() - 1u] = b;
+        }
+    };
+
+    // Valida r e a resolução do domínio; run(k) escreve as faces
+    template <class Run>
+    static void with_kernel(Size n, Real A, Real B, const Options& cfg, Run&& run) {
+        ensure_ratio(cfg.ratio);
+        const Kernel k(n, A, B, cfg.ratio);
+        ensure_resolved(k);
+        run(k);
+    }
+
+    // ------------------------------------------------------------------------
+    // Utilitários
+    // ------------------------------------------------------------------------
+    static void ensure_ratio(Real r) {
+        if (!(r >= kMinRatio && r <= kMaxRatio)) {
+            throw std::invalid_argument("Geometric1D: razão fora de [1e-4, 1e4].");
+        }
+    }
+
+    // Menor célula acima da resolução de A/B (senão, faces repetidas)
+    static void ensure_resolved(const Setup& st) {
+        const Real scale = std::max(std::abs(st.A), std::abs(st.B));
+        if (!(st.min_width() > std::numeric_limits<Real>::epsilon() * scale)) {
+            throw std::invalid_argument(
+                "Geometric1D: menor célula abaixo da resolução do domínio (reduza N ou |ln r|).");
+        }
+    }
+};
+
+DISTRIBUTION_NAMESPACE_CLOSE
+PATTERNS_NAMESPACE_CLOSE
+GRID1D_NAMESPACE_CLOSE
+GRID_NAMESPACE_CLOSE
+FVMGRIDMAKER_NAMESPACE_CLOSE
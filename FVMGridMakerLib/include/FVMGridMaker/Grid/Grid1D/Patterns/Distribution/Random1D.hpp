@@ -1,8 +1,8 @@
 // ----------------------------------------------------------------------------
 // File: Random1D.hpp
 // Author: FVMGridMaker Team
-// Version: 2.1
-// Date: 2025-10-26
+// Version: 2.6
+// Date: 2025-10-27
 // Description: Distribuição Random1D para geração de malhas 1D aleatórias,
 //              respeitando limites inferiores/superiores de largura por célula.
 //              Implementa projeção no "simplex com cotas" para garantir
@@ -21,8 +21,28 @@
  *   - Projeta vetor r para x (em unidades de dx0) tal que:
  *        lo ≤ x_i ≤ hi  e  ∑ x_i = N,
  *     onde dx0 = (B-A)/N e lo=w_lo, hi=w_hi.
- *   - Define larguras d_i = dx0 * x_i.
- *   - Faces por soma prefixada exclusiva; centros pelas médias das faces.
+ *     A projeção é x_i = clamp(s·r_i, lo, hi), com a escala s raiz de
+ *     g(s) = ∑ clamp(s·r_i, lo, hi) = N (g é linear por partes e monótona).
+ *     s é obtido por busca nos pontos de quebra {lo/r_i, hi/r_i}: O(n) por
+ *     passada, número de passadas limitado, com fallback por ordenação
+ *     apenas dos pontos de quebra restantes (O(n log n) no pior caso).
+ *   - Faces por soma prefixada compensada (Neumaier, paralela por blocos
+ *     fixos) de x, normalizada pelo total: xf[i] = lerp(A, B, P_i / P_N).
+ *     P_N / P_N = 1 exatamente, logo xf[N] = B sem sobrescrita; centros
+ *     pelas médias das faces.
+ *   - Os pesos, x e as somas prefixadas são escritos direto no span de
+ *     saída: nenhum vetor temporário de tamanho N.
+ *   - Com `CounterBased`, @ref Random1D::PrefixStream gera as mesmas somas
+ *     prefixadas em ordem, sem nenhum array de tamanho N (geração em blocos
+ *     de malhas que não cabem na memória).
+ *
+ * Geradores (Options::policy):
+ *   - `BoundedProject`: r_i sorteados em sequência por um `std::mt19937_64`
+ *     (padrão; saída histórica).
+ *   - `CounterBased`: r_i = U(seed, i) via SplitMix64 indexado por contador.
+ *     Cada peso depende só de (seed, i), então a geração é dividida em
+ *     blocos paralelos (Options::exec) e o resultado é o mesmo para qualquer
+ *     número de threads.
  *
  * Notas:
  *   - Determinismo quando seed é fixada no Options.
@@ -31,16 +51,21 @@
  *       w_lo' = std::min(w_lo, Real(1)), w_hi' = std::max(w_hi, Real(1)).
  */
 
+#include <FVMGridMaker/Core/CompensatedScan.hpp>
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/ParallelFor.hpp>
 #include <FVMGridMaker/Core/namespace.h>
 #include <FVMGridMaker/Core/type.h>
 
 #include <any>
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <numeric>
+#include <limits>
 #include <optional>
 #include <random>
+#include <span>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
@@ -62,45 +87,220 @@ public:
         Real    w_hi { Real(1.5) };   ///< limite superior relativo (≥ w_lo)
         std::optional<std::uint64_t> seed {}; ///< semente opcional (determinismo)
 
-        // Futuro: políticas alternativas (ex.: distribuição dos pesos).
-        enum class Policy : std::uint8_t { BoundedProject = 0 };
+        /// Gerador dos pesos brutos (a projeção com cotas é a mesma).
+        enum class Policy : std::uint8_t {
+            BoundedProject = 0,   ///< mt19937_64 sequencial (padrão)
+            CounterBased   = 1    ///< SplitMix64 por (seed, i); paralelizável
+        };
         Policy policy { Policy::BoundedProject };
+
+        /// Execução dos laços elemento a elemento (não altera o resultado).
+        core::ExecPolicy exec { core::ExecPolicy::Auto };
     };
 
+    /**
+     * @brief Peso unitário U(seed, i) ∈ [0,1) do gerador por contador.
+     *
+     * @details Saída i de um SplitMix64 cuja semente é derivada de @p seed:
+     *          z = mix(key + (i+1)·γ), com 53 bits mais altos → double.
+     */
+    [[nodiscard]] static constexpr Real
+    counter_uniform(std::uint64_t seed, std::uint64_t i) noexcept {
+        const std::uint64_t key = splitmix64_mix(seed);
+        const std::uint64_t z   = splitmix64_mix(key + (i + 1u) * kGolden);
+        return static_cast<Real>(z >> 11) * Real(0x1.0p-53);
+    }
+
+    // ------------------------------------------------------------------------
+    // Forma de functor (concept Distribution1D) — usada por Grid1DBuilderT
+    // ------------------------------------------------------------------------
+    Random1D() = default;
+    explicit Random1D(const Options& opt) : m_opt(opt) {}
+
+    /// Faces (N+1) em @p xf. Se Options::seed não foi fixada, usa @p seed (≠0).
+    void makeFaces(Index N, Real A, Real B, std::span<Real> xf,
+                   std::uint64_t seed = 0, Real /*dx_min*/ = Real(0)) const
+    {
+        const Options cfg = with_seed(seed);
+        faces_into(N, A, B, xf, &cfg);
+    }
+
+    /// Centros (N) em @p xc. Mesma regra de semente de makeFaces.
+    void makeCenters(Index N, Real A, Real B, std::span<Real> xc,
+                     std::uint64_t seed = 0, Real /*dx_min*/ = Real(0)) const
+    {
+        const Options cfg = with_seed(seed);
+        centers_into(N, A, B, xc, &cfg);
+    }
+
+    [[nodiscard]] const Options& options() const noexcept { return m_opt; }
+
     // ------------------------------------------------------------------------
     // Interface principal
     // ------------------------------------------------------------------------
     static std::vector<Real> faces(Index n, Real A, Real B,
                                    const Options* opt = nullptr)
     {
-        ensure_inputs(n, A, B);
-        const auto cfg = sanitize_opts(opt);
-        const auto widths = make_widths(n, A, B, cfg);
         std::vector<Real> xf(static_cast<std::size_t>(n + 1));
-        xf[0] = A;
-
-        // soma prefixada exclusiva para faces internas
-        for (Index i = 1; i <= n; ++i) {
-            xf[static_cast<std::size_t>(i)] =
-                xf[static_cast<std::size_t>(i-1)] + widths[static_cast<std::size_t>(i-1)];
-        }
-        // Por construção da projeção: soma(widths) = (B-A) ⇒ xf[n] = B
-        xf.back() = B;
+        faces_into(n, A, B, xf, opt);
         return xf;
     }
 
     static std::vector<Real> centers(Index n, Real A, Real B,
                                      const Options* opt = nullptr)
     {
-        auto xf = faces(n, A, B, opt);
         std::vector<Real> xc(static_cast<std::size_t>(n));
-        for (Index i = 0; i < n; ++i) {
-            const auto i0 = static_cast<std::size_t>(i);
-            xc[i0] = Real(0.5) * (xf[i0] + xf[i0 + 1]);
-        }
+        centers_into(n, A, B, xc, opt);
         return xc;
     }
 
+    /// Escreve as N+1 faces em @p xf (memória do chamador).
+    static void faces_into(Index n, Real A, Real B, std::span<Real> xf,
+                           const Options* opt = nullptr)
+    {
+        ensure_inputs(n, A, B);
+        ensure_size(xf, static_cast<std::size_t>(n) + 1u);
+        const auto cfg = sanitize_opts(opt);
+
+        // xf[1..n] ← x (larguras em unidades de dx0) ← somas prefixadas P_i
+        const std::span<Real> P = xf.subspan(1);
+        make_unit_widths(P, cfg);
+        core::compensated_inclusive_scan(P, cfg.exec);
+
+        // xf[i] = lerp(A, B, P_i / P_n): xf[0] = A e xf[n] = B exatos
+        const Real total = P.back();
+        xf[0] = A;
+        core::parallel_for_chunks(P.size(), cfg.exec,
+            [P, A, B, total](std::size_t b, std::size_t e) {
+                for (std::size_t i = b; i < e; ++i) P[i] = std::lerp(A, B, P[i] / total);
+            });
+    }
+
+    /// Escreve os N centros em @p xc (médias das faces, sem vetor de faces).
+    static void centers_into(Index n, Real A, Real B, std::span<Real> xc,
+                             const Options* opt = nullptr)
+    {
+        ensure_inputs(n, A, B);
+        ensure_size(xc, static_cast<std::size_t>(n));
+        const auto cfg = sanitize_opts(opt);
+
+        // xc[i] ← P_{i+1} (face i+1 não normalizada)
+        make_unit_widths(xc, cfg);
+        core::compensated_inclusive_scan(xc, cfg.exec);
+
+        const Real total = xc.back();
+        auto face = [A, B, total](Real p) { return std::lerp(A, B, p / total); };
+
+        // xc[i] = (face(P_i) + face(P_{i+1}))/2 in-place: cada bloco fixo
+        // varre de trás para frente; a face à esquerda do bloco é lida antes.
+        const std::size_t N     = xc.size();
+        const std::size_t blk   = core::kReduceBlock;
+        const std::size_t nb    = (N + blk - 1u) / blk;
+        std::vector<Real> left(nb, Real(0));
+        for (std::size_t k = 1; k < nb; ++k) left[k] = xc[k * blk - 1u];
+
+        core::parallel_for_chunks(nb, cfg.exec,
+            [&left, &face, xc, N, blk](std::size_t b, std::size_t e) {
+                for (std::size_t k = b; k < e; ++k) {
+                    const std::size_t lo = k * blk;
+                    const std::size_t hi = std::min(N, lo + blk);
+                    for (std::size_t i = hi - 1u; i > lo; --i) {
+                        xc[i] = Real(0.5) * (face(xc[i - 1u]) + face(xc[i]));
+                    }
+                    xc[lo] = Real(0.5) * (face(left[k]) + face(xc[lo]));
+                }
+            }, std::max<std::size_t>(core::kParallelGrain / blk, 1u));
+    }
+
+    /**
+     * @brief Somas prefixadas P_1..P_n das larguras x_i, geradas em ordem com
+     *        memória O(kReduceBlock). Exige `Policy::CounterBased`.
+     *
+     * @details Mesmos bits do scan de faces_into/centers_into: os pesos são
+     * recalculados por (seed, i); a escala s e o total P_n são resolvidos no
+     * construtor (passadas sobre os pesos, sem guardar x) e o scan compensado
+     * refaz os blocos fixos de core::kReduceBlock na mesma ordem. Cada bloco
+     * é lido duas vezes (soma do bloco e scan).
+     */
+    class PrefixStream {
+    public:
+        PrefixStream(Index n, const Options* opt)
+        {
+            if (n == 0) {
+                throw std::invalid_argument("Random1D::PrefixStream: N deve ser > 0.");
+            }
+            const Options cfg = sanitize_opts(opt);
+            if (cfg.policy != Options::Policy::CounterBased) {
+                throw std::invalid_argument(
+                    "Random1D::PrefixStream: exige Options::Policy::CounterBased.");
+            }
+            m_n    = static_cast<std::size_t>(n);
+            m_lo   = cfg.w_lo;
+            m_hi   = cfg.w_hi;
+            m_span = cfg.w_hi - cfg.w_lo;
+            m_seed = cfg.seed ? *cfg.seed : kDefaultSeed;
+
+            const Real lo = m_lo, span_w = m_span;
+            const std::uint64_t seed = m_seed;
+            auto r = [seed, lo, span_w](std::size_t i) {
+                return lo + span_w * counter_uniform(seed, i);
+            };
+            m_s = solve_scale(m_n, r, m_lo, m_hi, static_cast<Real>(m_n), cfg.exec);
+
+            // P_n: deslocamento do último bloco (fusão em ordem das somas
+            // dos blocos anteriores) + scan do último bloco.
+            const std::size_t blk  = core::kReduceBlock;
+            const std::size_t last = (m_n - 1u) / blk * blk;
+            core::CompensatedSum off = core::deterministic_reduce(
+                last, cfg.exec, core::CompensatedSum{},
+                [this](std::size_t b, std::size_t e) { return sum_range(b, e); },
+                [](core::CompensatedSum a, const core::CompensatedSum& o) {
+                    a.add(o);
+                    return a;
+                }, blk);
+            off.add(sum_range(last, m_n));
+            m_total = off.value();
+        }
+
+        /// P_n (normalização das faces: xf[i] = lerp(A, B, P_i / P_n)).
+        [[nodiscard]] Real total() const noexcept { return m_total; }
+
+        /// Próximos out.size() valores P_{k+1}, k = emitidos até aqui.
+        void next(std::span<Real> out) noexcept
+        {
+            const std::size_t blk = core::kReduceBlock;
+            for (auto& v : out) {
+                if (m_pos % blk == 0u) {
+                    m_cur = m_run;
+                    m_run.add(sum_range(m_pos, std::min(m_n, m_pos + blk)));
+                }
+                m_cur.add(width(m_pos++));
+                v = m_cur.value();
+            }
+        }
+
+    private:
+        // x_i = clamp(s·r_i, lo, hi): mesma expressão de make_unit_widths
+        Real width(std::size_t i) const noexcept {
+            return std::clamp(m_s * positive_weight(m_lo + m_span * counter_uniform(m_seed, i)),
+                              m_lo, m_hi);
+        }
+
+        core::CompensatedSum sum_range(std::size_t b, std::size_t e) const noexcept {
+            core::CompensatedSum s{};
+            for (std::size_t i = b; i < e; ++i) s.add(width(i));
+            return s;
+        }
+
+        std::size_t          m_n    {0};
+        std::size_t          m_pos  {0};
+        Real                 m_lo   {0}, m_hi{0}, m_span{0}, m_s{1};
+        std::uint64_t        m_seed {0};
+        Real                 m_total{0};
+        core::CompensatedSum m_run  {};   // deslocamento do próximo bloco
+        core::CompensatedSum m_cur  {};   // scan dentro do bloco corrente
+    };
+
     // ------------------------------------------------------------------------
     // Ponte para o registro (std::any*)
     // ------------------------------------------------------------------------
@@ -116,7 +316,39 @@ public:
         return centers(n, A, B, &cfg);
     }
 
+    static void faces_into(Index n, Real A, Real B, std::span<Real> xf,
+                           const std::any* any_opt)
+    {
+        Options cfg = options_from_any(any_opt);
+        faces_into(n, A, B, xf, &cfg);
+    }
+
+    static void centers_into(Index n, Real A, Real B, std::span<Real> xc,
+                             const std::any* any_opt)
+    {
+        Options cfg = options_from_any(any_opt);
+        centers_into(n, A, B, xc, &cfg);
+    }
+
 private:
+    Options m_opt{};
+
+    static constexpr std::uint64_t kGolden      = 0x9E3779B97F4A7C15ULL;
+    static constexpr std::uint64_t kDefaultSeed = 0x9E3779B97F4A7C15ULL;
+
+    // Finalizador do SplitMix64 (Steele, Lea & Flood, 2014)
+    static constexpr std::uint64_t splitmix64_mix(std::uint64_t z) noexcept {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    Options with_seed(std::uint64_t seed) const {
+        Options cfg = m_opt;
+        if (!cfg.seed && seed != 0) cfg.seed = seed;
+        return cfg;
+    }
+
     // ------------------------------------------------------------------------
     // Utilitários
     // ------------------------------------------------------------------------
@@ -129,6 +361,12 @@ private:
         }
     }
 
+    static void ensure_size(std::span<Real> out, std::size_t expected) {
+        if (out.size() != expected) {
+            throw std::invalid_argument("Random1D::faces_into/centers_into(): tamanho do span inválido.");
+        }
+    }
+
     static Options sanitize_opts(const Options* opt_in) {
         Options cfg = opt_in ? *opt_in : Options{};
         if (cfg.w_lo < Real(0)) cfg.w_lo = Real(0);
@@ -149,168 +387,195 @@ private:
         return Options{};
     }
 
-    // Gera larguras d_i, garantindo:
-    //   lo*dx0 ≤ d_i ≤ hi*dx0 e ∑ d_i = (B-A)
-    static std::vector<Real> make_widths(Index n, Real A, Real B, const Options& cfg)
+    // Escreve em @p x (N) as larguras em unidades de dx0, garantindo:
+    //   lo ≤ x_i ≤ hi e ∑ x_i = N (a menos de arredondamento)
+    static void make_unit_widths(std::span<Real> x, const Options& cfg)
     {
-        const Real N   = static_cast<Real>(n);
-        const Real len = (B - A);
-        const Real dx0 = len / N;
-        const Real lo  = cfg.w_lo;  // limites em unidades relativas a dx0
-        const Real hi  = cfg.w_hi;
-
-        // 1) Pesos brutos r_i ~ U[lo, hi]
-        std::mt19937_64 rng;
-        if (cfg.seed) rng.seed(*cfg.seed);
-        else {
-            // fallback determinístico por padrão (semente fixa) p/ reprodutibilidade
-            rng.seed(0x9E3779B97F4A7C15ULL);
+        const std::size_t n = x.size();
+        const Real lo = cfg.w_lo;  // limites em unidades relativas a dx0
+        const Real hi = cfg.w_hi;
+        const Real N  = static_cast<Real>(n);
+        const std::uint64_t seed = cfg.seed ? *cfg.seed : kDefaultSeed;
+
+        if (cfg.policy == Options::Policy::CounterBased) {
+            // r_i = lo + (hi-lo)·U(seed, i) é recalculado em cada passada:
+            // nenhum vetor de pesos é armazenado.
+            const Real span_w = hi - lo;
+            auto r = [seed, lo, span_w](std::size_t i) {
+                return lo + span_w * counter_uniform(seed, i);
+            };
+            const Real s = solve_scale(n, r, lo, hi, N, cfg.exec);
+            core::parallel_for_chunks(n, cfg.exec,
+                [x, &r, s, lo, hi](std::size_t b, std::size_t e) {
+                    for (std::size_t i = b; i < e; ++i) {
+                        x[i] = std::clamp(s * positive_weight(r(i)), lo, hi);
+                    }
+                });
+        } else {
+            // fallback determinístico por padrão (semente fixa) p/ reprodutibilidade;
+            // os pesos brutos ocupam o próprio span de saída.
+            std::mt19937_64 rng(seed);
+            std::uniform_real_distribution<Real> dist(lo, hi);
+            for (auto& v : x) v = dist(rng);
+
+            auto r = [x](std::size_t i) { return x[i]; };
+            const Real s = solve_scale(n, r, lo, hi, N, cfg.exec);
+            core::parallel_for_chunks(n, cfg.exec,
+                [x, s, lo, hi](std::size_t b, std::size_t e) {
+                    for (std::size_t i = b; i < e; ++i) {
+                        x[i] = std::clamp(s * positive_weight(x[i]), lo, hi);
+                    }
+                });
         }
-        std::uniform_real_distribution<Real> dist(lo, hi);
+    }
 
-        std::vector<Real> r(static_cast<std::size_t>(n));
-        for (auto& v : r) v = dist(rng);
+    // ------------------------------------------------------------------------
+    // Projeção proporcional com cotas: x_i = clamp(s·r_i, lo, hi), ∑ x_i = T
+    // ------------------------------------------------------------------------
 
-        // 2) Projeção em { x : lo ≤ x_i ≤ hi, ∑ x_i = N }
-        std::vector<Real> x = bounded_simplex_project(r, lo, hi, N);
+    // Resumo de uma passada em s: classificação das entradas e pontos de
+    // quebra vizinhos (o segmento linear de g que contém s).
+    struct ScalePass {
+        std::size_t n_lo     {0};            // s·r_i < lo  → fixo em lo
+        std::size_t n_hi     {0};            // s·r_i > hi  → fixo em hi
+        Real        r_free   {Real(0)};      // ∑ r_i dos livres
+        Real        bp_below {Real(0)};      // maior quebra ≤ s
+        Real        bp_above {std::numeric_limits<Real>::infinity()}; // menor quebra > s
+        Real        r_min    {std::numeric_limits<Real>::infinity()};
+        Real        r_max    {Real(0)};
+    };
 
-        // 3) Converte para larguras reais
-        std::vector<Real> d(static_cast<std::size_t>(n));
-        for (std::size_t i = 0; i < d.size(); ++i) d[i] = dx0 * x[i];
-        return d;
+    // Peso efetivo (evita divisão por zero; mesmo tratamento do método antigo)
+    static Real positive_weight(Real v) noexcept {
+        return v > Real(0) ? v : std::numeric_limits<Real>::min();
     }
 
-    // Projeção proporcional com cotas, iterativa:
-    // - Parte dos "pesos" r_i (positivos).
-    // - Em cada passo, escala o subconjunto livre por um fator s para atingir a soma
-    //   restante; quem violar cotas é "fixado" na cota e removido do conjunto livre.
-    // - Termina quando ninguém viola.
-    static std::vector<Real>
-    bounded_simplex_project(const std::vector<Real>& r, Real lo, Real hi, Real target_sum)
+    // Uma passada O(n) sobre w(i), i em [0,n). Redução determinística.
+    template <class WeightFn>
+    static ScalePass scale_pass(std::size_t n, const WeightFn& w, Real s,
+                                Real lo, Real hi, core::ExecPolicy exec)
     {
-        const std::size_t n = r.size();
-        std::vector<Real> x(n, Real(0));
-        if (n == 0) return x;
-
-        // Estados
-        std::vector<char> fixed(n, 0);  // 0=livre, 1=fixed
-        std::vector<Real> cur = r;      // pesos correntes dos livres
-
-        // Sanidade dos pesos (evita divisão por zero)
-        Real sum_pos = Real(0);
-        for (Real v : cur) sum_pos += (v > Real(0) ? v : Real(0));
-        if (!(sum_pos > Real(0))) {
-            // Se todos não-positivos, distribui igualmente no interior das cotas
-            const Real mid = std::clamp(target_sum / static_cast<Real>(n), lo, hi);
-            std::fill(x.begin(), x.end(), mid);
-            // Ajuste final pequeno para somar exatamente (distribui o resíduo)
-            adjust_residual(x, target_sum, lo, hi);
-            return x;
-        }
-        for (auto& v : cur) if (v <= Real(0)) v = std::numeric_limits<Real>::min();
-
-        Real sum_fixed = Real(0);
-        std::size_t n_free = n;
-
-        // Itera no máximo n vezes (cada passo fixa >= 1 elemento)
-        for (std::size_t iter = 0; iter < n; ++iter) {
-            // Soma dos pesos livres
-            Real sum_r_free = Real(0);
-            for (std::size_t i = 0; i < n; ++i) if (!fixed[i]) sum_r_free += cur[i];
-
-            // Se não há livres, encerra
-            if (n_free == 0 || !(sum_r_free > Real(0))) break;
-
-            const Real remain = target_sum - sum_fixed;
-            const Real s = remain / sum_r_free;
-
-            bool clamped_any = false;
-
-            // Primeiro passe: calcula valores escalados e marca violações
-            for (std::size_t i = 0; i < n; ++i) {
-                if (fixed[i]) continue;
-                const Real v = cur[i] * s;
-                if (v < lo) {
-                    x[i] = lo;
-                    fixed[i] = 1;
-                    sum_fixed += lo;
-                    --n_free;
-                    clamped_any = true;
-                } else if (v > hi) {
-                    x[i] = hi;
-                    fixed[i] = 1;
-                    sum_fixed += hi;
-                    --n_free;
-                    clamped_any = true;
+        auto block = [&w, s, lo, hi](std::size_t b, std::size_t e) {
+            ScalePass p{};
+            for (std::size_t i = b; i < e; ++i) {
+                const Real ri = positive_weight(w(i));
+                const Real a  = lo / ri;     // abaixo de a: fixo em lo
+                const Real c  = hi / ri;     // acima de c: fixo em hi
+                p.r_min = std::min(p.r_min, ri);
+                p.r_max = std::max(p.r_max, ri);
+                if (s < a) {
+                    ++p.n_lo;
+                    p.bp_above = std::min(p.bp_above, a);
+                } else if (s > c) {
+                    ++p.n_hi;
+                    p.bp_below = std::max(p.bp_below, c);
                 } else {
-                    x[i] = v; // candidato válido (ainda livre, mas já no intervalo)
+                    p.r_free  += ri;
+                    p.bp_below = std::max(p.bp_below, a);
+                    p.bp_above = std::min(p.bp_above, c);
                 }
             }
+            return p;
+        };
+        auto join = [](const ScalePass& x, const ScalePass& y) {
+            ScalePass p{};
+            p.n_lo     = x.n_lo + y.n_lo;
+            p.n_hi     = x.n_hi + y.n_hi;
+            p.r_free   = x.r_free + y.r_free;
+            p.bp_below = std::max(x.bp_below, y.bp_below);
+            p.bp_above = std::min(x.bp_above, y.bp_above);
+            p.r_min    = std::min(x.r_min, y.r_min);
+            p.r_max    = std::max(x.r_max, y.r_max);
+            return p;
+        };
+        return core::deterministic_reduce(n, exec, ScalePass{}, block, join);
+    }
 
-            if (!clamped_any) {
-                // Todos dentro das cotas — terminamos com soma correta
-                // Pequeno ajuste numérico (se necessário)
-                adjust_residual(x, target_sum, lo, hi);
-                break;
-            }
-
-            // Atualiza pesos dos livres para próxima iteração:
-            // Mantém cur[i] proporcional ao x[i] atual (somente livres).
-            for (std::size_t i = 0; i < n; ++i) {
-                if (!fixed[i]) {
-                    // usar x[i] como novo "peso" para próxima redistribuição
-                    cur[i] = x[i];
-                }
+    // Resolve g(s) = T no intervalo [s_lo, s_hi] ordenando só os pontos de
+    // quebra internos ao intervalo (fallback: O(m log m), m ≤ 2n).
+    template <class WeightFn>
+    static Real solve_scale_sorted(std::size_t n, const WeightFn& w,
+                                   Real lo, Real hi, Real T,
+                                   Real s_lo, Real s_hi)
+    {
+        struct Event { Real at; Real dr; int dlo; int dhi; };
+        std::vector<Event> ev;
+        std::size_t n_lo = 0, n_hi = 0;
+        Real r_free = Real(0);
+        for (std::size_t i = 0; i < n; ++i) {
+            const Real ri = positive_weight(w(i));
+            const Real a = lo / ri, c = hi / ri;
+            if (s_lo < a)       { ++n_lo; if (a <= s_hi) ev.push_back({a,  ri, -1, 0}); }
+            else if (s_lo > c)  { ++n_hi; }
+            else                { r_free += ri; }
+            if (s_lo <= c && c <= s_hi) ev.push_back({c, -ri, 0, +1});
+        }
+        std::sort(ev.begin(), ev.end(),
+                  [](const Event& x, const Event& y) { return x.at < y.at; });
+
+        Real s_prev = s_lo;
+        for (const Event& e : ev) {
+            const Real fixed = lo * static_cast<Real>(n_lo) + hi * static_cast<Real>(n_hi);
+            if (r_free > Real(0)) {
+                const Real s_star = (T - fixed) / r_free;
+                if (s_star <= e.at) return std::max(s_star, s_prev);
             }
+            r_free += e.dr;
+            n_lo = static_cast<std::size_t>(static_cast<long long>(n_lo) + e.dlo);
+            n_hi = static_cast<std::size_t>(static_cast<long long>(n_hi) + e.dhi);
+            s_prev = e.at;
         }
-
-        return x;
+        const Real fixed = lo * static_cast<Real>(n_lo) + hi * static_cast<Real>(n_hi);
+        if (r_free > Real(0)) return std::clamp((T - fixed) / r_free, s_prev, s_hi);
+        return s_prev;
     }
 
-    // Corrige minúsculo resíduo numérico para fechar a soma exatamente,
-    // respeitando as cotas. Distribui o resíduo pelos elementos com margem.
-    static void adjust_residual(std::vector<Real>& x, Real target_sum, Real lo, Real hi)
+    /**
+     * Escala s tal que ∑ clamp(s·w(i), lo, hi) = T (lo·n ≤ T ≤ hi·n).
+     *
+     * Cada passada classifica as entradas em s e devolve o segmento linear
+     * [bp_below, bp_above] de g que contém s; a raiz do segmento é exata.
+     * Se ela cair fora, o colchete [s_lo, s_hi] avança até o ponto de quebra
+     * e o próximo s alterna entre a extrapolação do segmento e a bissecção.
+     * Após kMaxScalePasses passadas, resolve por ordenação dos pontos de
+     * quebra que restam no colchete.
+     */
+    template <class WeightFn>
+    static Real solve_scale(std::size_t n, const WeightFn& w,
+                            Real lo, Real hi, Real T, core::ExecPolicy exec)
     {
-        Real sum_x = std::accumulate(x.begin(), x.end(), Real(0));
-        Real resid = target_sum - sum_x;
-
-        if (std::abs(resid) <= Real(1e-14) * std::max(Real(1), std::abs(target_sum))) {
-            return; // nada a ajustar
-        }
-
-        // Tenta distribuir o resíduo positivamente em quem tem espaço até hi
-        if (resid > Real(0)) {
-            for (std::size_t i = 0; i < x.size() && resid > Real(0); ++i) {
-                const Real room = hi - x[i];
-                if (room > Real(0)) {
-                    const Real delta = std::min(room, resid);
-                    x[i] += delta;
-                    resid -= delta;
-                }
+        constexpr int kMaxScalePasses = 64;
+
+        Real s    = Real(1);
+        Real s_lo = Real(0);
+        Real s_hi = std::numeric_limits<Real>::infinity();
+
+        for (int it = 0; it < kMaxScalePasses; ++it) {
+            const ScalePass p = scale_pass(n, w, s, lo, hi, exec);
+            if (it == 0) {
+                // em s ≤ lo/r_max tudo fixa em lo; em s ≥ hi/r_min tudo em hi
+                s_lo = lo / p.r_max;
+                s_hi = hi / p.r_min;
             }
-        } else { // resid < 0 — remove de quem tem acima de lo
-            resid = -resid;
-            for (std::size_t i = 0; i < x.size() && resid > Real(0); ++i) {
-                const Real room = x[i] - lo;
-                if (room > Real(0)) {
-                    const Real delta = std::min(room, resid);
-                    x[i] -= delta;
-                    resid -= delta;
-                }
-            }
-        }
-        // Se ainda restar resíduo por erros extremos, faz um ajuste final no primeiro índice com margem:
-        if (std::abs(resid) > Real(1e-14)) {
-            for (std::size_t i = 0; i < x.size(); ++i) {
-                if (resid > Real(0)) {
-                    const Real room = hi - x[i];
-                    if (room > Real(0)) { x[i] += std::min(room, resid); break; }
-                } else {
-                    const Real room = x[i] - lo;
-                    if (room > Real(0)) { x[i] -= std::min(room, -resid); break; }
-                }
+
+            const Real fixed = lo * static_cast<Real>(p.n_lo) + hi * static_cast<Real>(p.n_hi);
+            const Real g     = fixed + s * p.r_free;
+            Real s_star      = std::numeric_limits<Real>::quiet_NaN();
+            if (p.r_free > Real(0)) {
+                s_star = (T - fixed) / p.r_free;
+                if (s_star >= p.bp_below && s_star <= p.bp_above) return s_star;
+            } else if (g == T) {
+                return s;
             }
+
+            if (g < T) s_lo = std::max(s_lo, p.bp_above);
+            else       s_hi = std::min(s_hi, p.bp_below);
+            if (!(s_lo < s_hi)) return std::min(s_lo, s_hi);
+
+            const bool use_star = (it % 2 == 0) && s_star > s_lo && s_star < s_hi;
+            s = use_star ? s_star : s_lo + Real(0.5) * (s_hi - s_lo);
         }
+        return solve_scale_sorted(n, w, lo, hi, T, s_lo, s_hi);
     }
 };
 
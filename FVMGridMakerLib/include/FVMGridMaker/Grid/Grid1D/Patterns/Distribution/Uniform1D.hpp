@@ -22,10 +22,7 @@ struct Uniform1D {
                    Real /*dx_min*/ = Real(0)) const
     {
         assert(xf.size() == N + Size(1));
-        const Real dx = (B - A) / static_cast<Real>(N);
-        for (Size i = 0; i <= N; ++i) {
-            xf[i] = A + static_cast<Real>(i) * dx;
-        }
+        facesRange(N, A, B, 0, xf);
     }
 
     // Centros: xc[i] = A + (i+0.5)*dx, i=0..N-1
@@ -35,9 +32,35 @@ struct Uniform1D {
                      Real /*dx_min*/ = Real(0)) const
     {
         assert(xc.size() == N);
+        centersRange(N, A, B, 0, xc);
+    }
+
+    // Face xf[i] em forma fechada (malha analítica; mesma expressão de
+    // facesRange, logo os mesmos bits)
+    static Real face(Size i, Size N, Real A, Real B) noexcept
+    {
+        const Real dx = (B - A) / static_cast<Real>(N);
+        return A + static_cast<Real>(i) * dx;
+    }
+
+    // Faces xf[first .. first+out.size()) de uma malha de N células
+    // (geração em blocos; mesmos valores de makeFaces)
+    static void facesRange(Size N, Real A, Real B, Size first, std::span<Real> out)
+    {
+        assert(first + out.size() <= N + Size(1));
+        const Real dx = (B - A) / static_cast<Real>(N);
+        for (Size k = 0; k < out.size(); ++k) {
+            out[k] = A + static_cast<Real>(first + k) * dx;
+        }
+    }
+
+    // Centros xc[first .. first+out.size()) (mesmos valores de makeCenters)
+    static void centersRange(Size N, Real A, Real B, Size first, std::span<Real> out)
+    {
+        assert(first + out.size() <= N);
         const Real dx = (B - A) / static_cast<Real>(N);
-        for (Size i = 0; i < N; ++i) {
-            xc[i] = A + (static_cast<Real>(i) + Real(0.5)) * dx;
+        for (Size k = 0; k < out.size(); ++k) {
+            out[k] = A + (static_cast<Real>(first + k) + Real(0.5)) * dx;
         }
     }
 };
@@ -0,0 +1,389 @@
+// ----------------------------------------------------------------------------
+// File: Vinokur1D.hpp
+// Author: FVMGridMaker Team
+// Version: 1.2
+// Date: 2025-10-27
+// Description: Distribuição Vinokur1D (agrupamento nas duas extremidades):
+//              estiramento de Vinokur (sinh/sin) controlado pelas larguras
+//              da primeira e da última célula.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#pragma once
+
+/**
+ * @file   Vinokur1D.hpp
+ * @brief  Malhas 1D com agrupamento controlado nas duas extremidades.
+ *
+ * @details
+ * Estiramento de Vinokur (1983). Com L = B - A, q = δ/N e
+ *     S(k) = sinh(k·q)  (hiperbólico),  sin(k·q)  (trigonométrico),  k  (linear),
+ * as faces são
+ *     xf[i] = A + L·S(i) / (S(i) + α·S(N-i)).
+ * A forma tanh clássica, t = ½[1 + tanh(δ(ξ-½))/tanh(δ/2)] com
+ * u = t/(α + (1-α)·t), é a mesma função escrita assim (sem cancelamento).
+ * Derivadas nas pontas: du/dξ = τ/α em A e τ·α em B, τ = δ/sinh δ
+ * (ou δ/sin δ); α controla a assimetria e δ a intensidade.
+ *
+ * `Options` dá as larguras alvo da primeira e da última célula como
+ * frações de L. `stretching()` encontra (δ, α) de modo que as larguras
+ * *discretas* xf[1]-xf[0] e xf[N]-xf[N-1] coincidam com os alvos:
+ *   - interno: δ por Newton salvaguardado (bissecção se sair do intervalo)
+ *     em φ(δ) = ln(sinh δ/δ) ou -ln(sin δ/δ) = |ln √(S0·S1)|;
+ *   - externo: Newton 2×2 em (ln S0, ln S1), jacobiano por diferenças
+ *     finitas e passo amortecido; o ponto inicial são as inclinações
+ *     S = N·d/L da aproximação contínua. Converge em 2 a 10 iterações
+ *     (custo O(1), independente de N).
+ * √(S0·S1) < 1 dá o ramo hiperbólico (células pequenas nas pontas), > 1 o
+ * trigonométrico (células grandes nas pontas, δ < π) e = 1 o linear.
+ *
+ * Kernel sem desvios no laço interno: S(k) em blocos de kBlock índices
+ * com tabelas por chamada e um par de funções transcendentes por bloco:
+ *   - hiperbólico: E = expm1(k·q) = e_s·p_j + m_j (como em Geometric1D),
+ *     S = ½·E·(1 + 1/(1 + E));
+ *   - trigonométrico: sin((s+j)·q) = sin(s·q)·cos(j·q) + cos(s·q)·sin(j·q).
+ * S(i) e S(N-i) são ambos medidos a partir da extremidade mais próxima
+ * (k pequeno exato), e cada face é escrita a partir da ponta mais próxima
+ * (A + L·u até N/2, B - L·(1-u) depois), em dois laços separados: as
+ * células junto de A e de B mantêm precisão relativa. Cada face depende
+ * só do seu índice (mesmo resultado para qualquer ExecPolicy); xf[0] = A e
+ * xf[N] = B exatos; centros pelas médias das faces.
+ *
+ * Notas:
+ *   - Larguras finitas, > 0 e com soma < 1 (N >= 3); alvos que exigiriam
+ *     δ > kMaxDelta (células ~e^{-600}·L) lançam `std::invalid_argument`.
+ *   - N = 1 não tem alvo atingível (a única célula mede L) e lança.
+ *     N = 2 só é atingível com d_first + d_last = 1 (α = d_last/d_first);
+ *     essa soma é aceita apenas para N = 2.
+ */
+
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/namespace.h>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/FaceKernelDistribution1D.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+
+FVMGRIDMAKER_NAMESPACE_OPEN
+GRID_NAMESPACE_OPEN
+GRID1D_NAMESPACE_OPEN
+PATTERNS_NAMESPACE_OPEN
+DISTRIBUTION_NAMESPACE_OPEN
+
+struct Vinokur1DOptions {
+    core::Real first_width { core::Real(0.01) };   ///< (xf[1] - xf[0]) / L
+    core::Real last_width  { core::Real(0.01) };   ///< (xf[N] - xf[N-1]) / L
+    core::ExecPolicy exec { core::ExecPolicy::Auto };   ///< kernel de faces (o Newton é O(1), serial)
+};
+
+class Vinokur1D
+    : public detail::FaceKernelDistribution1D<Vinokur1D, Vinokur1DOptions> {
+    using Base = detail::FaceKernelDistribution1D<Vinokur1D, Vinokur1DOptions>;
+    friend Base;
+
+public:
+    using Options = Vinokur1DOptions;
+
+    enum class Kind : std::uint8_t { Linear, Hyperbolic, Trigonometric };
+
+    /// Parâmetros da família: xf[i] = A + L·S(i)/(S(i) + alpha·S(N-i)).
+    struct Stretching {
+        Kind kind  { Kind::Linear };
+        Real delta { Real(0) };
+        Real alpha { Real(1) };
+    };
+
+    static constexpr Real kMaxDelta = Real(600);
+
+    Vinokur1D() = default;
+    explicit Vinokur1D(const Options& opt) : Base(opt) { ensure_widths(opt); }
+
+    /**
+     * @brief (δ, α) cujas larguras discretas da primeira e da última célula
+     *        de uma malha de N células são @p first e @p last (frações de L).
+     *
+     * @throws std::invalid_argument larguras inválidas ou inatingíveis
+     *         (sempre para N = 1; para N = 2 se first + last != 1).
+     */
+    static Stretching stretching(Index n, Real first, Real last)
+    {
+        ensure_widths(first, last);
+        if (n == 0) {
+            throw std::invalid_argument("Vinokur1D::stretching(): N deve ser > 0.");
+        }
+        Stretching s{};
+        if (n == 1) throw_unreachable();
+        if (n == 2) {
+            // xf[1] = L/(1 + α): as duas larguras só coincidem se somam L
+            if (!(std::abs((first + last) - Real(1)) <= kSumTol)) throw_unreachable();
+            s.alpha = last / first;
+            return s;
+        }
+        if (!(first + last < Real(1))) throw_unreachable();
+
+        const Size N  = static_cast<Size>(n);
+        const Real l0 = std::log(first), l1 = std::log(last);
+
+        // Resíduo r = ln(w/alvo) nas duas pontas, em x = (ln S0, ln S1)
+        auto residual = [&](Real x0, Real x1, Stretching& st, Real (&r)[2]) {
+            st = from_slopes(x0, x1, s.delta);
+            if (!(st.delta <= kMaxDelta)) return false;
+            Real w0 = 0, w1 = 0;
+            end_widths(N, st, w0, w1);
+            r[0] = std::log(w0) - l0;
+            r[1] = std::log(w1) - l1;
+            return std::isfinite(r[0]) && std::isfinite(r[1]);
+        };
+        auto norm = [](const Real (&r)[2]) { return std::max(std::abs(r[0]), std::abs(r[1])); };
+
+        const Real ln_n = std::log(static_cast<Real>(N));
+        Real x0 = ln_n + l0, x1 = ln_n + l1;
+        Real r[2];
+        if (!residual(x0, x1, s, r)) throw_unreachable();
+
+        constexpr Real h = Real(1e-7);
+        for (int it = 0; it < 50 && norm(r) > kWidthTol; ++it) {
+            Stretching tmp{};
+            Real ra[2], rb[2];
+            if (!residual(x0 + h, x1, tmp, ra) || !residual(x0, x1 + h, tmp, rb)) break;
+            const Real j00 = (ra[0] - r[0]) / h, j01 = (rb[0] - r[0]) / h;
+            const Real j10 = (ra[1] - r[1]) / h, j11 = (rb[1] - r[1]) / h;
+            const Real det = j00 * j11 - j01 * j10;
+            if (!(std::abs(det) > Real(0))) break;
+            const Real dx0 = ( j11 * r[0] - j01 * r[1]) / det;
+            const Real dx1 = (-j10 * r[0] + j00 * r[1]) / det;
+
+            // Passo amortecido: aceita o primeiro λ que reduz o resíduo (perto
+            // do arredondamento, só o passo inteiro é tentado)
+            const Real lam_min = norm(r) < kNearTol ? Real(1) : Real(1e-3);
+            bool accepted = false;
+            for (Real lam = 1; lam >= lam_min; lam *= Real(0.5)) {
+                Real rn[2];
+                if (residual(x0 - lam * dx0, x1 - lam * dx1, tmp, rn) && norm(rn) < norm(r)) {
+                    x0 -= lam * dx0;
+                    x1 -= lam * dx1;
+                    s = tmp;
+                    r[0] = rn[0];
+                    r[1] = rn[1];
+                    accepted = true;
+                    break;
+                }
+            }
+            if (!accepted) break;
+        }
+        if (!(norm(r) <= kAcceptTol)) throw_unreachable();
+        return s;
+    }
+
+private:
+    static constexpr const char* kName = "Vinokur1D";
+    static constexpr Size kBlock     = 64;
+    static constexpr Real kWidthTol  = Real(1e-14);   // parada do Newton externo
+    static constexpr Real kNearTol   = Real(1e-12);   // sem amortecimento abaixo disso
+    static constexpr Real kAcceptTol = Real(1e-10);   // abaixo disso: inatingível
+    static constexpr Real kLinearTol = Real(1e-13);   // |ln √(S0·S1)| tratado como 0
+    static constexpr Real kSumTol    = 4 * std::numeric_limits<Real>::epsilon();   // N = 2
+
+    // ------------------------------------------------------------------------
+    // Solver
+    // ------------------------------------------------------------------------
+
+    // φ(δ) = ln(sinh δ/δ) ou -ln(sin δ/δ): crescente, φ(0) = 0, φ' > 0
+    static Real phi(Real d, bool trig) noexcept {
+        if (d < Real(1e-3)) {
+            const Real d2 = d * d;
+            return d2 / 6 + (trig ? d2 * d2 / 180 : -d2 * d2 / 180);
+        }
+        return trig ? -std::log(std::sin(d) / d) : std::log(std::sinh(d) / d);
+    }
+
+    static Real dphi(Real d, bool trig) noexcept {
+        if (d < Real(1e-3)) {
+            return d / 3 + (trig ? d * d * d / 45 : -d * d * d / 45);
+        }
+        return trig ? Real(1) / d - Real(1) / std::tan(d)
+                    : Real(1) / std::tanh(d) - Real(1) / d;
+    }
+
+    // δ com φ(δ) = target > 0; Newton salvaguardado em [0, π) ou [0, kMaxDelta],
+    // partindo de @p hint (δ do ponto vizinho no Newton externo) se válido.
+    // Devolve > kMaxDelta se o alvo exige estiramento maior.
+    static Real solve_delta(Real target, bool trig, Real hint) noexcept {
+        constexpr Real eps = std::numeric_limits<Real>::epsilon();
+        Real lo = 0;
+        Real hi = trig ? std::numbers::pi_v<Real> : kMaxDelta;
+        if (!trig && target > Real(500) && target >= phi(hi, false)) return 2 * kMaxDelta;
+
+        Real d = (hint > lo && hint < hi) ? hint
+               : target < Real(1)         ? std::sqrt(6 * target)
+               : trig                     ? hi * -std::expm1(-target)
+                                          : target + std::log(2 * target);
+        if (!(d > lo && d < hi)) d = Real(0.5) * (lo + hi);
+
+        for (int it = 0; it < 100; ++it) {
+            const Real f = phi(d, trig) - target;
+            if (std::abs(f) <= 2 * eps * target) return d;
+            if (f > 0) hi = d;
+            else       lo = d;
+            Real dn = d - f / dphi(d, trig);
+            if (!(dn > lo && dn < hi)) dn = Real(0.5) * (lo + hi);
+            if (std::abs(dn - d) <= 4 * eps * d) return dn;
+            d = dn;
+        }
+        return d;
+    }
+
+    // Inclinações contínuas (ln S0, ln S1) → (δ, α): √(S0·S1) = τ, α = √(S1/S0)
+    static Stretching from_slopes(Real x0, Real x1, Real hint) noexcept {
+        Stretching s{};
+        s.alpha       = std::exp(Real(0.5) * (x1 - x0));
+        const Real lb = Real(0.5) * (x0 + x1);
+        if (std::abs(lb) < kLinearTol) return s;
+        const bool trig = lb > 0;
+        s.kind  = trig ? Kind::Trigonometric : Kind::Hyperbolic;
+        s.delta = solve_delta(std::abs(lb), trig, hint);
+        return s;
+    }
+
+    // Larguras discretas (frações de L) da primeira e da última célula
+    static void end_widths(Size N, const Stretching& s, Real& w0, Real& w1) noexcept {
+        const Real q = s.delta / static_cast<Real>(N);
+        auto S = [&](Size k) {
+            const Real x = static_cast<Real>(k);
+            switch (s.kind) {
+                case Kind::Hyperbolic:    return std::sinh(x * q);
+                case Kind::Trigonometric: return std::sin(x * q);
+                default:                  return x;
+            }
+        };
+        const Real s1 = S(1), sn = S(N - 1u);
+        w0 = s1 / (s1 + s.alpha * sn);
+        w1 = s.alpha * s1 / (sn + s.alpha * s1);
+    }
+
+    // ------------------------------------------------------------------------
+    // Kernel
+    // ------------------------------------------------------------------------
+
+    // Tabelas por chamada (j < kBlock):
+    //   hiperbólico:    m_j = expm1(j·q), p_j = m_j + 1
+    //   trigonométrico: m_j = sin(j·q),   p_j = cos(j·q)
+    struct Kernel {
+        Size N;
+        Real A, B, L;
+        Kind kind;
+        Real q, alpha;
+        std::array<Real, kBlock> m{};
+        std::array<Real, kBlock> p{};
+
+        Kernel(Size n, Real a, Real b, const Stretching& s) noexcept
+            : N(n), A(a), B(b), L(b - a), kind(s.kind),
+              q(s.delta / static_cast<Real>(n)), alpha(s.alpha)
+        {
+            const Size jn = std::min(kBlock, n + 1u);
+            for (Size j = 0; j < jn; ++j) {
+                const Real x = static_cast<Real>(j) * q;
+                if (kind == Kind::Hyperbolic) {
+                    m[j] = std::expm1(x);
+                    p[j] = m[j] + Real(1);
+                } else if (kind == Kind::Trigonometric) {
+                    m[j] = std::sin(x);
+                    p[j] = std::cos(x);
+                }
+            }
+        }
+
+        // dst[t] = S(k0 + t), t < cnt; blocos ancorados em múltiplos de kBlock
+        void fill_s(Size k0, Size cnt, Real* dst) const noexcept {
+            const Size k1 = k0 + cnt;
+            if (kind == Kind::Linear) {
+                for (Size t = 0; t < cnt; ++t) dst[t] = static_cast<Real>(k0 + t);
+                return;
+            }
+            for (Size s = k0 - k0 % kBlock; s < k1; s += kBlock) {
+                const Real x  = static_cast<Real>(s) * q;
+                const Size j0 = std::max(s, k0) - s;
+                const Size j1 = std::min(s + kBlock, k1) - s;
+                Real* const d = dst + (s + j0 - k0);   // d[j - j0] = S(s + j)
+                if (kind == Kind::Hyperbolic) {
+                    const Real e = std::expm1(x);
+                    for (Size j = j0; j < j1; ++j) {
+                        const Real E = e * p[j] + m[j];
+                        d[j - j0] = Real(0.5) * E * (Real(1) + Real(1) / (Real(1) + E));
+                    }
+                } else {
+                    const Real sn = std::sin(x), cs = std::cos(x);
+                    for (Size j = j0; j < j1; ++j) d[j - j0] = sn * p[j] + cs * m[j];
+                }
+            }
+        }
+
+        // Faces de índice first .. first+out.size()-1 (≤ N)
+        void faces(Size first, std::span<Real> out) const noexcept {
+            if (out.empty()) return;
+            const Size last = first + out.size();   // exclusivo
+            const Size mid  = N / 2u + 1u;          // i < mid: medida a partir de A
+            const Real a = A, b = B, l = L, al = alpha;
+            Real* const o = out.data();
+
+            std::array<Real, kBlock> sa, sb;
+            for (Size lo = first; lo < last; lo += kBlock) {
+                const Size cnt = std::min(kBlock, last - lo);
+                fill_s(lo, cnt, sa.data());                 // sa[t] = S(lo + t)
+                fill_s(N + 1u - lo - cnt, cnt, sb.data());  // sb[cnt-1-t] = S(N - lo - t)
+
+                const Size split = std::clamp(mid, lo, lo + cnt) - lo;
+                Real* const d = o + (lo - first);
+                for (Size t = 0; t < split; ++t) {
+                    const Real sv = sa[t], rv = al * sb[cnt - 1u - t];
+                    d[t] = a + l * (sv / (sv + rv));
+                }
+                for (Size t = split; t < cnt; ++t) {
+                    const Real sv = sa[t], rv = al * sb[cnt - 1u - t];
+                    d[t] = b - l * (rv / (sv + rv));
+                }
+            }
+            if (first == 0)     o[0] = a;
+            if (last == N + 1u) o[out.size() - 1u] = b;
+        }
+    };
+
+    // (δ, α) pelo Newton; run(k) escreve as faces
+    template <class Run>
+    static void with_kernel(Size n, Real A, Real B, const Options& cfg, Run&& run) {
+        run(Kernel(n, A, B,
+                   stretching(static_cast<Index>(n), cfg.first_width, cfg.last_width)));
+    }
+
+    // ------------------------------------------------------------------------
+    // Utilitários
+    // ------------------------------------------------------------------------
+
+    // Soma até 1 aceita aqui (N = 2); stretching() exige < 1 para N >= 3.
+    static void ensure_widths(Real first, Real last) {
+        if (!(first > Real(0) && last > Real(0) && first + last <= Real(1) + kSumTol)) {
+            throw std::invalid_argument(
+                "Vinokur1D: larguras (frações de L) devem ser > 0 com soma <= 1.");
+        }
+    }
+
+    static void ensure_widths(const Options& o) { ensure_widths(o.first_width, o.last_width); }
+
+    [[noreturn]] static void throw_unreachable() {
+        throw std::invalid_argument(
+            "Vinokur1D: larguras inatingíveis para este N (estiramento excessivo).");
+    }
+};
+
+DISTRIBUTION_NAMESPACE_CLOSE
+PATTERNS_NAMESPACE_CLOSE
+GRID1D_NAMESPACE_CLOSE
+GRID_NAMESPACE_CLOSE
+FVMGRIDMAKER_NAMESPACE_CLOSE
@@ -0,0 +1,350 @@
+// ----------------------------------------------------------------------------
+// File: Grid1DAdapt.hpp
+// Author: FVMGridMaker Team
+// Version: 1.1
+// Date: 2025-10-27
+// Description: Refinamento e desrefinamento incrementais de malhas 1D:
+//              divide ou funde células selecionadas (lista de índices ou
+//              predicado) sem reconstruir pelo builder, em uma passada de
+//              compactação que devolve o mapa antigo → novo.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#pragma once
+
+/**
+ * @file  Grid1DAdapt.hpp
+ * @brief `adapt::refine` / `adapt::coarsen` (e variantes `_if`).
+ *
+ * @details
+ * - `refine`: cada célula selecionada é dividida em `parts` células iguais
+ *   (faces por `std::lerp`, extremos exatos).
+ * - `coarsen`: cada grupo de `parts` células consecutivas, identificado
+ *   pela sua primeira célula, vira uma célula só.
+ * - Células novas recebem centro no ponto médio das faces (convenção
+ *   FaceCentered); células intocadas mantêm face, centro, dF e dC
+ *   originais. dC é recalculado só nas fronteiras com células novas.
+ *
+ * As listas são ordenadas (validadas em O(alterações)). A nova malha é
+ * escrita em UMA passada sobre as células antigas, dividida em trechos
+ * contíguos conforme a `ExecPolicy`: cada trecho acha seu deslocamento
+ * por busca binária na lista (nº de alterações antes dele) e escreve
+ * faces, centros, dF, dC e o mapa de forma independente. Custo
+ * O(N + alterações·parts); resultado idêntico para qualquer ExecPolicy.
+ *
+ * Mapa antigo → novo (N+1 entradas): `map[i]` é a nova célula que contém
+ * o início da célula antiga i e `map[N]` = novo N. No refinamento as
+ * filhas de i são [map[i], map[i+1]); no desrefinamento as células de um
+ * grupo compartilham o mesmo `map[i]`.
+ *
+ * Lista ou `parts` inválidos → FVMG_ERROR; sem exceção (Policy::Status)
+ * a malha é devolvida intocada, com o mapa identidade.
+ */
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/ParallelFor.hpp>
+#include <FVMGridMaker/Core/namespace.h>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/ErrorHandling/ErrorHandling.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1DStorage.h>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+FVMG_GRID1D_UTILS_OPEN
+namespace adapt {
+
+/// Malha adaptada e mapa antigo → novo (N+1 entradas).
+struct Adapted {
+    api::Grid1D              grid;
+    std::vector<core::Index> map;
+};
+
+namespace detail {
+
+using Real = core::Real;
+
+// Face q (0..k) das k filhas de [a, b]
+inline Real child_face(Real a, Real b, std::size_t q, std::size_t k) noexcept {
+    return std::lerp(a, b, static_cast<Real>(q) / static_cast<Real>(k));
+}
+
+// Lista ordenada; cada entrada cobre [c, c + len) dentro de [0, n), sem sobreposição.
+// false após FVMG_ERROR sem exceção (Policy::Status).
+inline bool check_list(std::span<const core::Index> cells, std::size_t n,
+                       std::size_t len, std::size_t parts, const char* where) {
+    if (parts < 2u) {
+        FVMG_ERROR(error::CoreErr::InvalidArgument, {
+            {"where", where},
+            {"what",  "parts must be >= 2"}
+        });
+        return false;
+    }
+    for (std::size_t m = 0; m < cells.size(); ++m) {
+        if (cells[m] >= n || n - cells[m] < len) {
+            FVMG_ERROR(error::CoreErr::OutOfRange, {
+                {"where", where},
+                {"i",     std::to_string(cells[m])},
+                {"n",     std::to_string(n)}
+            });
+            return false;
+        }
+        if (m > 0 && cells[m] < cells[m - 1u] + len) {
+            FVMG_ERROR(error::CoreErr::InvalidArgument, {
+                {"where", where},
+                {"what",  "cell list must be sorted and non-overlapping"},
+                {"i",     std::to_string(cells[m])}
+            });
+            return false;
+        }
+    }
+    return true;
+}
+
+// Malha intocada e mapa identidade (0..N)
+inline Adapted unchanged(const api::Grid1D& g) {
+    std::vector<core::Index> map(static_cast<std::size_t>(g.nVolumes()) + 1u);
+    for (std::size_t i = 0; i < map.size(); ++i) map[i] = static_cast<core::Index>(i);
+    return {g, std::move(map)};
+}
+
+// Sequências antigas (x*) e novas (y*): faces, centros, dF, dC + mapa
+struct Arrays {
+    const Real*  xf;
+    const Real*  xc;
+    const Real*  xw;
+    const Real*  xg;
+    Real*        yf;
+    Real*        yc;
+    Real*        yw;
+    Real*        yg;
+    core::Index* map;
+
+    Arrays(const api::Grid1D& g, api::Grid1DStorage& s, std::vector<core::Index>& m) noexcept
+        : xf(g.faces().data()), xc(g.centers().data()),
+          xw(g.deltasFaces().data()), xg(g.deltasCenters().data()),
+          yf(s.faces().data()), yc(s.centers().data()),
+          yw(s.deltasFaces().data()), yg(s.deltasCenters().data()),
+          map(m.data())
+    {}
+
+    // Células intocadas [i, end) → novas a partir de j (cópias em bloco; só o
+    // dC da primeira depende do centro anterior). Devolve o próximo j.
+    std::size_t copy_run(std::size_t i, std::size_t end, std::size_t j,
+                         Real prev, bool kept) const noexcept {
+        const std::size_t len = end - i;
+        std::copy_n(xf + i, len, yf + j);
+        std::copy_n(xc + i, len, yc + j);
+        std::copy_n(xw + i, len, yw + j);
+        yg[j] = kept ? xg[i] : xc[i] - prev;
+        std::copy_n(xg + i + 1u, len - 1u, yg + j + 1u);
+        for (std::size_t q = 0; q < len; ++q) map[i + q] = j + q;
+        return j + len;
+    }
+
+    // Célula nova j com faces [a, c]; devolve o centro
+    Real put(std::size_t j, Real a, Real c, Real prev) const noexcept {
+        const Real cc = Real(0.5) * (a + c);
+        yf[j] = a;
+        yc[j] = cc;
+        yw[j] = c - a;
+        yg[j] = cc - prev;
+        return cc;
+    }
+
+    // Última face e último dC
+    void close(std::size_t N, std::size_t N2, bool last_new) const noexcept {
+        map[N] = N2;
+        yf[N2] = xf[N];
+        yg[N2] = last_new ? xf[N] - yc[N2 - 1u] : xg[N];
+    }
+};
+
+inline Adapted refine_sorted(const api::Grid1D& g, std::span<const core::Index> cells,
+                             std::size_t k, core::ExecPolicy exec) {
+    const std::size_t N  = static_cast<std::size_t>(g.nVolumes());
+    const std::size_t nc = cells.size();
+    const std::size_t N2 = N + nc * (k - 1u);
+
+    Adapted out{api::Grid1D{}, std::vector<core::Index>(N + 1u)};
+    api::Grid1DStorage s(static_cast<core::Index>(N2));
+    const Arrays       v(g, s, out.map);
+    const core::Index* cl = cells.data();
+
+    core::parallel_for_chunks(N, exec, [v, cl, nc, k](std::size_t b, std::size_t e) {
+        // refinadas antes de b → primeira célula nova do trecho
+        std::size_t p = static_cast<std::size_t>(std::lower_bound(cl, cl + nc, b) - cl);
+        std::size_t j = b + p * (k - 1u);
+
+        // centro anterior (para dC) e se ele é de célula intocada
+        const bool left_new = p > 0 && cl[p - 1u] == b - 1u;
+        Real prev = b == 0 ? v.xf[0]
+                  : left_new ? Real(0.5) * (child_face(v.xf[b - 1u], v.xf[b], k - 1u, k) + v.xf[b])
+                             : v.xc[b - 1u];
+        bool kept = !left_new;
+
+        std::size_t i = b;
+        while (i < e) {
+            const std::size_t next = p < nc ? std::min<std::size_t>(cl[p], e) : e;
+            if (next > i) {
+                j    = v.copy_run(i, next, j, prev, kept);
+                prev = v.xc[next - 1u];
+                kept = true;
+                i    = next;
+                continue;
+            }
+            // célula i → k filhas
+            v.map[i] = j;
+            const Real a = v.xf[i];
+            const Real c = v.xf[i + 1u];
+            Real fl = a;
+            for (std::size_t q = 1; q <= k; ++q, ++j) {
+                const Real fr = q == k ? c : child_face(a, c, q, k);
+                prev = v.put(j, fl, fr, prev);
+                fl   = fr;
+            }
+            kept = false;
+            ++p;
+            ++i;
+        }
+    });
+
+    v.close(N, N2, nc > 0 && cl[nc - 1u] == N - 1u);
+    out.grid = api::Grid1D(std::move(s));
+    return out;
+}
+
+inline Adapted coarsen_sorted(const api::Grid1D& g, std::span<const core::Index> starts,
+                              std::size_t k, core::ExecPolicy exec) {
+    const std::size_t N  = static_cast<std::size_t>(g.nVolumes());
+    const std::size_t nc = starts.size();
+    const std::size_t N2 = N - nc * (k - 1u);
+
+    Adapted out{api::Grid1D{}, std::vector<core::Index>(N + 1u)};
+    api::Grid1DStorage s(static_cast<core::Index>(N2));
+    const Arrays       v(g, s, out.map);
+    const core::Index* cl = starts.data();
+
+    core::parallel_for_chunks(N, exec, [v, cl, nc, k](std::size_t b, std::size_t e) {
+        // grupos iniciados antes de b
+        std::size_t p = static_cast<std::size_t>(std::lower_bound(cl, cl + nc, b) - cl);
+        std::size_t i = b;
+
+        // cauda de um grupo iniciado em outro trecho: só o mapa
+        if (p > 0 && cl[p - 1u] + k > b) {
+            const std::size_t jg  = cl[p - 1u] - (p - 1u) * (k - 1u);
+            const std::size_t end = std::min(cl[p - 1u] + k, e);
+            for (; i < end; ++i) v.map[i] = jg;
+        }
+        if (i >= e) return;
+
+        std::size_t j = i - p * (k - 1u);
+        const bool left_new = p > 0 && cl[p - 1u] + k == i;
+        Real prev = i == 0 ? v.xf[0]
+                  : left_new ? Real(0.5) * (v.xf[cl[p - 1u]] + v.xf[i])
+                             : v.xc[i - 1u];
+        bool kept = !left_new;
+
+        while (i < e) {
+            const std::size_t next = p < nc ? std::min<std::size_t>(cl[p], e) : e;
+            if (next > i) {
+                j    = v.copy_run(i, next, j, prev, kept);
+                prev = v.xc[next - 1u];
+                kept = true;
+                i    = next;
+                continue;
+            }
+            // grupo [i, i + k) → célula j
+            prev = v.put(j, v.xf[i], v.xf[i + k], prev);
+            kept = false;
+            const std::size_t stop = std::min(i + k, e);
+            for (; i < stop; ++i) v.map[i] = j;
+            ++p;
+            ++j;
+        }
+    });
+
+    v.close(N, N2, nc > 0 && cl[nc - 1u] + k == N);
+    out.grid = api::Grid1D(std::move(s));
+    return out;
+}
+
+} // namespace detail
+
+/**
+ * @brief Divide as células @p cells (ordenadas, sem repetição) em @p parts
+ *        células iguais cada.
+ * @return malha nova e mapa antigo → novo (filhas de i: [map[i], map[i+1])).
+ */
+[[nodiscard]] inline Adapted refine(const api::Grid1D& g, std::span<const core::Index> cells,
+                                    core::Index parts = 2,
+                                    core::ExecPolicy exec = core::ExecPolicy::Auto) {
+    const std::size_t N = static_cast<std::size_t>(g.nVolumes());
+    if (!detail::check_list(cells, N, 1u, parts, "adapt::refine") || N == 0) {
+        return detail::unchanged(g);
+    }
+    return detail::refine_sorted(g, cells, parts, exec);
+}
+
+/// Refina as células i com `pred(i) == true` (predicado avaliado uma vez por célula).
+template <class Pred>
+[[nodiscard]] Adapted refine_if(const api::Grid1D& g, Pred&& pred, core::Index parts = 2,
+                                core::ExecPolicy exec = core::ExecPolicy::Auto) {
+    const std::size_t N = static_cast<std::size_t>(g.nVolumes());
+    std::vector<core::Index> cells;
+    for (std::size_t i = 0; i < N; ++i) {
+        if (pred(static_cast<core::Index>(i))) cells.push_back(i);
+    }
+    return refine(g, cells, parts, exec);
+}
+
+/**
+ * @brief Funde, para cada s em @p starts (ordenada), as células
+ *        [s, s + parts) em uma só. Grupos não podem se sobrepor.
+ * @return malha nova e mapa antigo → novo (células do grupo → mesma célula).
+ */
+[[nodiscard]] inline Adapted coarsen(const api::Grid1D& g, std::span<const core::Index> starts,
+                                     core::Index parts = 2,
+                                     core::ExecPolicy exec = core::ExecPolicy::Auto) {
+    const std::size_t N = static_cast<std::size_t>(g.nVolumes());
+    if (!detail::check_list(starts, N, parts, parts, "adapt::coarsen") || N == 0) {
+        return detail::unchanged(g);
+    }
+    return detail::coarsen_sorted(g, starts, parts, exec);
+}
+
+/**
+ * @brief Funde células marcadas por `pred(i)`: cada sequência de células
+ *        marcadas consecutivas é dividida em grupos de @p parts a partir
+ *        da esquerda; a sobra (< parts) fica intocada.
+ */
+template <class Pred>
+[[nodiscard]] Adapted coarsen_if(const api::Grid1D& g, Pred&& pred, core::Index parts = 2,
+                                 core::ExecPolicy exec = core::ExecPolicy::Auto) {
+    const std::size_t N = static_cast<std::size_t>(g.nVolumes());
+    std::vector<core::Index> starts;
+    std::size_t run = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        if (!pred(static_cast<core::Index>(i))) {
+            run = 0;
+        } else if (++run == parts) {
+            starts.push_back(i + 1u - parts);
+            run = 0;
+        }
+    }
+    return coarsen(g, starts, parts, exec);
+}
+
+} // namespace adapt
+FVMG_GRID1D_UTILS_CLOSE
@@ -1,12 +1,16 @@
 // ----------------------------------------------------------------------------
 // File: Grid1DStats.hpp
 // Author: FVMGridMaker Team
-// Version: 2.1
-// Date: 2025-10-25
+// Version: 2.6
+// Date: 2025-10-27
 // Description: Utilitário (SRP) para estatísticas de malhas 1D.
 //              Calcula métricas de qualidade sobre spans (sem cópias).
 //              • Padrão: STL sequencial (minmax_element/accumulate)
 //              • Opcional: paralelismo com transform_reduce (defina FVMG_STATS_PARALLEL)
+//              • all(): todas as métricas em uma única varredura fundida
+//              • histogram_into(): histograma paralelo/SIMD, classes
+//                lineares ou logarítmicas, em buffer do chamador
+//              • basic(L, exec): variância por momentos de Chan (estável)
 // License: GNU GPL v3
 // ----------------------------------------------------------------------------
 #pragma once
@@ -17,7 +21,9 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <array>
 #include <limits>
+#include <mutex>
 #include <numeric>
 #include <optional>
 #include <span>
@@ -29,9 +35,18 @@
   #include <execution> 
 #endif
 
+#if !defined(FVMG_DISABLE_SIMD) && __has_include(<experimental/simd>)
+  #include <experimental/simd>
+  #ifndef FVMG_HAVE_EXPERIMENTAL_SIMD
+    #define FVMG_HAVE_EXPERIMENTAL_SIMD 1
+  #endif
+#endif
+
 // ----------------------------------------------------------------------------
 // includes FVMGridMaker
 // ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/ParallelFor.hpp>
 #include <FVMGridMaker/Core/namespace.h>
 #include <FVMGridMaker/Core/type.h>
 #include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
@@ -94,6 +109,21 @@ struct Grid1DStats {
         Real cv{0};       // stddev/mean
     };
 
+    /// Momentos (n, média, M2) com fusão de Chan et al.: var = M2 / n.
+    struct Moments {
+        Real n{0}, mean{0}, m2{0};
+
+        void merge(const Moments& o) noexcept {
+            if (o.n == Real(0)) return;
+            if (n == Real(0)) { *this = o; return; }
+            const Real nt = n + o.n;
+            const Real d  = o.mean - mean;
+            mean += d * (o.n / nt);
+            m2   += o.m2 + d * d * (n * o.n / nt);
+            n     = nt;
+        }
+    };
+
     static inline Basic basic(std::span<const Real> L) {
         Basic out{};
         if (L.empty()) return out;
@@ -113,6 +143,101 @@ struct Grid1DStats {
         return out;
     }
 
+    /// Parcial de basic() sobre um trecho contíguo: extremos + momentos.
+    struct BasicAcc {
+        Real    min{std::numeric_limits<Real>::infinity()};
+        Real    max{-std::numeric_limits<Real>::infinity()};
+        Moments len{};
+
+        void merge(const BasicAcc& o) noexcept {
+            min = std::min(min, o.min);
+            max = std::max(max, o.max);
+            len.merge(o.len);
+        }
+    };
+
+    /**
+     * @brief Extremos e momentos de um trecho (tipicamente um bloco em cache).
+     *
+     * @details Duas passadas: soma/extremos e depois M2 em torno da média do
+     * próprio trecho (sem cancelamento de ss/n - média²). Cada passada usa
+     * kBasicLanes acumuladores independentes, o que permite vetorizar sem
+     * reassociação de ponto flutuante.
+     */
+    static inline BasicAcc basic_block(std::span<const Real> L) noexcept {
+        BasicAcc a{};
+        const std::size_t n = L.size();
+        if (n == 0) return a;
+        const Real* x = L.data();
+        const std::size_t nv = n - n % kBasicLanes;
+
+        std::array<Real, kBasicLanes> lo{}, hi{}, sum{};
+        lo.fill(a.min); hi.fill(a.max);
+        for (std::size_t i = 0; i < nv; i += kBasicLanes) {
+            for (std::size_t k = 0; k < kBasicLanes; ++k) {
+                lo[k]   = std::min(lo[k], x[i + k]);
+                hi[k]   = std::max(hi[k], x[i + k]);
+                sum[k] += x[i + k];
+            }
+        }
+        Real s = 0;
+        for (std::size_t k = 0; k < kBasicLanes; ++k) {
+            a.min = std::min(a.min, lo[k]);
+            a.max = std::max(a.max, hi[k]);
+            s += sum[k];
+        }
+        for (std::size_t i = nv; i < n; ++i) {
+            a.min = std::min(a.min, x[i]);
+            a.max = std::max(a.max, x[i]);
+            s += x[i];
+        }
+
+        a.len.n    = static_cast<Real>(n);
+        a.len.mean = s / a.len.n;
+
+        std::array<Real, kBasicLanes> m2{};
+        for (std::size_t i = 0; i < nv; i += kBasicLanes) {
+            for (std::size_t k = 0; k < kBasicLanes; ++k) {
+                const Real d = x[i + k] - a.len.mean;
+                m2[k] += d * d;
+            }
+        }
+        for (std::size_t k = 0; k < kBasicLanes; ++k) a.len.m2 += m2[k];
+        for (std::size_t i = nv; i < n; ++i) {
+            const Real d = x[i] - a.len.mean;
+            a.len.m2 += d * d;
+        }
+        return a;
+    }
+
+    /// Converte o acumulador fundido em Basic (mesmas convenções de basic()).
+    static inline Basic basic_from(const BasicAcc& a) noexcept {
+        Basic out{};
+        if (a.len.n == Real(0)) return out;
+        out.min    = a.min;
+        out.max    = a.max;
+        out.mean   = a.len.mean;
+        out.stddev = std::sqrt(a.len.m2 / a.len.n);
+        out.aspect = (out.min > Real(0)) ? (out.max / out.min)
+                                         : std::numeric_limits<Real>::infinity();
+        out.cv     = (out.mean > Real(0)) ? (out.stddev / out.mean) : Real(0);
+        return out;
+    }
+
+    /**
+     * @brief basic() com política de execução.
+     *
+     * Blocos fixos de core::kReduceBlock (basic_block) fundidos em ordem por
+     * Moments::merge: o resultado é idêntico bit a bit em qualquer política.
+     */
+    static inline Basic basic(std::span<const Real> L, core::ExecPolicy exec) {
+        const BasicAcc r = core::deterministic_reduce(
+            L.size(), exec, BasicAcc{},
+            [L](std::size_t b, std::size_t e) { return basic_block(L.subspan(b, e - b)); },
+            [](BasicAcc a, const BasicAcc& o) { a.merge(o); return a; });
+        return basic_from(r);
+    }
+
     template <class GridLike>
     static inline Basic basicFaces(const GridLike& g) { return basic(g.deltasFaces()); }
 
@@ -132,35 +257,116 @@ struct Grid1DStats {
     template <class GridLike>
     static inline Real uniformidadeFaces(const GridLike& g) { return uniformidade_relativa(g.deltasFaces()); }
 
+    /// Espaçamento das classes do histograma.
+    enum class BinScale : std::uint8_t {
+        Linear = 0,   ///< classes de largura constante em x
+        Log    = 1    ///< classes de largura constante em log(x) (exige lo > 0)
+    };
+
     struct Histogram {
-        Real bin_min{0}, bin_max{0}, bin_width{0};
+        Real bin_min{0}, bin_max{0}, bin_width{0}; // Log: bin_width em log(x)
         std::vector<std::size_t> counts; // size == bins
+        BinScale scale{BinScale::Linear};
+    };
+
+    struct HistogramOptions {
+        BinScale scale{BinScale::Linear};
+        std::optional<std::pair<Real,Real>> range{};     ///< padrão: [min, max] de L
+        core::ExecPolicy exec{core::ExecPolicy::Auto};   ///< não altera o resultado
     };
 
     static inline Histogram histogram(std::span<const Real> L,
                                       std::size_t bins,
                                       std::optional<std::pair<Real,Real>> range = std::nullopt)
+    {
+        HistogramOptions opt{};
+        opt.range = range;
+        return histogram(L, bins, opt);
+    }
+
+    static inline Histogram histogram(std::span<const Real> L,
+                                      std::size_t bins,
+                                      const HistogramOptions& opt)
     {
         Histogram H{};
         if (L.empty() || bins == 0) return H;
 
-        Real lo = range ? range->first  : *std::min_element(L.begin(), L.end());
-        Real hi = range ? range->second : *std::max_element(L.begin(), L.end());
+        Real lo = opt.range ? opt.range->first  : *std::min_element(L.begin(), L.end());
+        Real hi = opt.range ? opt.range->second : *std::max_element(L.begin(), L.end());
+        if (opt.scale == BinScale::Log) lo = std::max(lo, std::numeric_limits<Real>::min());
         if (!(hi > lo)) { hi = lo + Real(1); } // evita divisão zero
 
-        H.bin_min = lo; H.bin_max = hi;
-        H.bin_width = (hi - lo) / static_cast<Real>(bins);
-        H.counts.assign(bins, 0);
+        H.bin_min = lo; H.bin_max = hi; H.scale = opt.scale;
+        H.bin_width = (opt.scale == BinScale::Log)
+                    ? (std::log(hi) - std::log(lo)) / static_cast<Real>(bins)
+                    : (hi - lo) / static_cast<Real>(bins);
+        H.counts.resize(bins);
+        histogram_into(L, H.counts, lo, hi, opt.scale, opt.exec);
+        return H;
+    }
 
-        for (Real x : L) {
-            if (x <= lo) { H.counts[0]++; continue; }
-            if (x >= hi) { H.counts[bins-1]++; continue; }
-            const Real pos = (x - lo) / (hi - lo);
-            std::size_t k = static_cast<std::size_t>(pos * static_cast<Real>(bins)); // evita -Wconversion
-            if (k >= bins) k = bins - 1;
-            H.counts[k]++;
+    /**
+     * @brief Conta @p L em counts.size() classes sobre [lo, hi], escrevendo
+     *        em @p counts (buffer do chamador; sobrescrito, sem alocação).
+     *
+     * @details
+     * Cada thread mantém contadores privados replicados por lane
+     * (kHistLanes cópias por classe, elemento j → cópia j % kHistLanes), de
+     * modo que elementos vizinhos na mesma classe não serializam no mesmo
+     * contador. As posições das classes são calculadas por ladrilhos de
+     * kHistTile elementos com `std::experimental::simd` (quando disponível)
+     * e as cópias são somadas ao final. Contagens inteiras: o resultado não
+     * depende da ExecPolicy. Valores fora de [lo, hi] saturam nas classes
+     * extremas; em BinScale::Log, x ≤ 0 cai na classe 0. NaN cai na
+     * classe 0.
+     */
+    static inline void histogram_into(std::span<const Real> L,
+                                      std::span<std::size_t> counts,
+                                      Real lo, Real hi,
+                                      BinScale scale = BinScale::Linear,
+                                      core::ExecPolicy exec = core::ExecPolicy::Auto)
+    {
+        const std::size_t bins = counts.size();
+        std::fill(counts.begin(), counts.end(), std::size_t(0));
+        if (L.empty() || bins == 0) return;
+
+        const bool log_scale = (scale == BinScale::Log);
+        Real a = lo, b = hi;
+        if (log_scale) {
+            a = std::log(std::max(lo, std::numeric_limits<Real>::min()));
+            b = std::log(hi);
         }
-        return H;
+        if (!(b > a)) b = a + Real(1);
+
+        std::mutex merge_mutex;
+        core::parallel_for_chunks(L.size(), exec, [&](std::size_t beg, std::size_t end) {
+            std::vector<std::size_t> lanes(bins * kHistLanes, 0);
+            std::array<Real, kHistTile> pos;
+            for (std::size_t i0 = beg; i0 < end; i0 += kHistTile) {
+                const std::size_t m = std::min(kHistTile, end - i0);
+                hist_positions(L.data() + i0, pos.data(), m, a, b, bins, log_scale);
+                for (std::size_t j = 0; j < m; ++j) {
+                    const auto k = static_cast<std::size_t>(pos[j]);
+                    lanes[k * kHistLanes + (j % kHistLanes)]++;
+                }
+            }
+            const std::lock_guard<std::mutex> lock(merge_mutex);
+            for (std::size_t k = 0; k < bins; ++k) {
+                std::size_t c = 0;
+                for (std::size_t l = 0; l < kHistLanes; ++l) c += lanes[k * kHistLanes + l];
+                counts[k] += c;
+            }
+        });
+    }
+
+    /// Classe de @p x em [lo, hi] com @p bins classes (extremos saturam; NaN → 0).
+    static inline std::size_t bin_index(Real x, Real lo, Real hi, std::size_t bins) noexcept {
+        if (!(x > lo)) return 0;
+        if (x >= hi) return bins - 1;
+        const Real pos = (x - lo) / (hi - lo);
+        std::size_t k = static_cast<std::size_t>(pos * static_cast<Real>(bins)); // evita -Wconversion
+        if (k >= bins) k = bins - 1;
+        return k;
     }
 
     // ------------------------------------------------------------------------
@@ -348,6 +554,161 @@ struct Grid1DStats {
         return region_by_predicate(xcenters, lengths, [&](Real x){ return x >= x0 && x <= x1; });
     }
 
+    // ------------------------------------------------------------------------
+    // 9) Todas as métricas em uma varredura (all)
+    // ------------------------------------------------------------------------
+
+    struct AllOptions {
+        std::size_t bins{0};                              ///< 0 → sem histograma
+        std::optional<std::pair<Real,Real>> range{};      ///< faixa do histograma
+        Real geom_tol{Real(1e-6)};                        ///< tol. de geometric_progression
+        core::ExecPolicy exec{core::ExecPolicy::Auto};    ///< não altera o resultado
+    };
+
+    struct Summary {
+        Basic           basic{};
+        AdjacentRatios  adjacent{};   ///< apenas max_ratio/worst_sym_ratio (R vazio)
+        Smoothness      smooth{};
+        EdgeVsInterior  edges{};
+        Symmetry        symmetry{};
+        GeomProgression geom{};
+        Histogram       histogram{};  ///< vazio se AllOptions::bins == 0
+    };
+
+    /**
+     * @brief basic, adjacent_ratios, smoothness, edges_vs_interior, symmetry,
+     *        geometric_progression e histogram em uma única leitura de @p L.
+     *
+     * @details
+     * L é percorrido em blocos fixos de core::kReduceBlock; o bloco k trata
+     * ao mesmo tempo [b,e) e o seu espelho [n-e, n-b), de modo que os pares
+     * de simetria (i, n-1-i) também estão em cache. Médias/variâncias são
+     * calculadas em duas passadas dentro do bloco (em L1) e fundidas entre
+     * blocos por Chan; max|r - r_est| vem de min/max de r (r_est é escalar).
+     * Os termos por par (razões, gradiente, log r) são calculados em
+     * ladrilhos de kPairTile em L1, sem desvios (`std::experimental::simd`
+     * quando disponível, como em hist_positions), e reduzidos com
+     * kBasicLanes acumuladores; o log fica num laço elemento a elemento
+     * próprio sobre o ladrilho.
+     * A ordem de fusão é fixa: resultado idêntico para qualquer ExecPolicy,
+     * e igual às funções separadas a menos de arredondamento.
+     *
+     * O histograma precisa de [lo, hi]: com AllOptions::range ele é montado
+     * na mesma varredura (contagens por thread, somadas ao final); sem range,
+     * [min, max] só é conhecido ao fim e uma segunda leitura é feita.
+     *
+     * AdjacentRatios::R não é materializado (use adjacent_ratios()).
+     */
+    static inline Summary all(std::span<const Real> L, const AllOptions& opt) {
+        Summary out{};
+        const std::size_t n = L.size();
+        if (n == 0) {
+            out.histogram = histogram(L, opt.bins, opt.range);
+            return out;
+        }
+
+        const bool fused_hist = opt.bins > 0 && opt.range.has_value();
+        Real h_lo = Real(0), h_hi = Real(0);
+        if (fused_hist) {
+            h_lo = opt.range->first;
+            h_hi = opt.range->second;
+            if (!(h_hi > h_lo)) h_hi = h_lo + Real(1); // evita divisão zero
+            out.histogram.bin_min   = h_lo;
+            out.histogram.bin_max   = h_hi;
+            out.histogram.bin_width = (h_hi - h_lo) / static_cast<Real>(opt.bins);
+            out.histogram.counts.assign(opt.bins, 0);
+        }
+
+        // Blocos espelhados sobre a primeira metade + elemento central (n ímpar)
+        const std::size_t h     = n / 2;
+        const std::size_t blk   = core::kReduceBlock;
+        const std::size_t nb    = (h + blk - 1) / blk;
+        const bool        mid   = (n % 2) != 0;
+        const std::size_t parts = nb + (mid ? 1 : 0);
+        std::vector<FusedAcc> partial(parts);
+        std::mutex hist_mutex;
+
+        core::parallel_for_chunks(parts, opt.exec, [&](std::size_t kb, std::size_t ke) {
+            std::vector<std::size_t> local(fused_hist ? opt.bins : 0, 0);
+            HistCtx hc{local.data(), h_lo, h_hi, opt.bins};
+            const HistCtx* hp = fused_hist ? &hc : nullptr;
+
+            for (std::size_t k = kb; k < ke; ++k) {
+                FusedAcc acc{};
+                if (k < nb) {
+                    const std::size_t b = k * blk;
+                    const std::size_t e = std::min(h, b + blk);
+                    fused_segment(L, b, e, acc, hp);
+                    fused_segment(L, n - e, n - b, acc, hp);
+                    fused_symmetry(L, b, e, acc);
+                } else {
+                    fused_segment(L, h, h + 1, acc, hp);
+                }
+                partial[k] = acc;
+            }
+            if (fused_hist) {
+                const std::lock_guard<std::mutex> lock(hist_mutex);
+                for (std::size_t j = 0; j < opt.bins; ++j) out.histogram.counts[j] += local[j];
+            }
+        }, std::max<std::size_t>(core::kParallelGrain / blk, 1));
+
+        FusedAcc r{};
+        for (const auto& p : partial) r.merge(p);
+
+        const Real N = static_cast<Real>(n);
+
+        // 1) básicas
+        out.basic.min    = r.min;
+        out.basic.max    = r.max;
+        out.basic.mean   = r.len.mean;
+        out.basic.stddev = std::sqrt(r.len.m2 / N);
+        out.basic.aspect = (r.min > Real(0)) ? (r.max / r.min)
+                                             : std::numeric_limits<Real>::infinity();
+        out.basic.cv     = (out.basic.mean > Real(0)) ? (out.basic.stddev / out.basic.mean) : Real(0);
+
+        // 3) razões adjacentes
+        out.adjacent.max_ratio       = r.max_ratio;
+        out.adjacent.worst_sym_ratio = r.worst_sym;
+
+        // 4) suavidade
+        if (n >= 2) {
+            out.smooth.mean_grad = r.grad_sum / static_cast<Real>(n - 1);
+            out.smooth.max_grad  = r.grad_max;
+        }
+
+        // 5) bordas vs. interior (soma interior = total - extremos)
+        if (n > 2) {
+            const Real interior = r.len.mean * N - L.front() - L.back();
+            out.edges.mean_interior = interior / static_cast<Real>(n - 2);
+            if (out.edges.mean_interior > Real(0)) {
+                out.edges.left_over_interior  = L.front() / out.edges.mean_interior;
+                out.edges.right_over_interior = L.back()  / out.edges.mean_interior;
+            }
+        }
+
+        // 6) simetria
+        out.symmetry.max_rel_diff   = r.sym_max;
+        out.symmetry.symmetry_score = (r.sym_den > Real(0)) ? (Real(1) - r.sym_num / r.sym_den) : Real(1);
+        out.symmetry.symmetry_score = std::clamp(out.symmetry.symmetry_score, Real(0), Real(1));
+
+        // 7) progressão geométrica
+        if (n >= 2) {
+            out.geom.std_log_r   = std::sqrt(r.log_r.m2 / r.log_r.n);
+            out.geom.r_est       = std::exp(r.log_r.mean);
+            out.geom.max_dev_abs = std::max(r.r_max - out.geom.r_est, out.geom.r_est - r.r_min);
+            out.geom.within_tolerance = (out.geom.max_dev_abs <= opt.geom_tol);
+        }
+
+        // histograma sem faixa: [min, max] só agora é conhecido
+        if (opt.bins > 0 && !fused_hist) {
+            out.histogram = histogram(L, opt.bins, std::make_pair(r.min, r.max));
+        }
+        return out;
+    }
+
+    // (AllOptions ainda é incompleta em argumentos padrão dentro da classe)
+    static inline Summary all(std::span<const Real> L) { return all(L, AllOptions{}); }
+
     // ------------------------------------------------------------------------
     // Atalhos baseados em GridLike (usa deltasFaces como L_i)
     // ------------------------------------------------------------------------
@@ -375,6 +736,234 @@ struct Grid1DStats {
     static inline RegionStats region(const GridLike& g, Real x0, Real x1) {
         return region_interval(g.centers(), g.deltasFaces(), x0, x1);
     }
+
+    template <class GridLike>
+    static inline Summary all(const GridLike& g, const AllOptions& opt) {
+        return all(g.deltasFaces(), opt);
+    }
+
+    template <class GridLike>
+    static inline Summary all(const GridLike& g) { return all(g.deltasFaces(), AllOptions{}); }
+
+private:
+    // ------------------------------------------------------------------------
+    // Internos de all()
+    // ------------------------------------------------------------------------
+    struct FusedAcc {
+        Real    min{std::numeric_limits<Real>::infinity()};
+        Real    max{-std::numeric_limits<Real>::infinity()};
+        Moments len{};
+        Real    max_ratio{1}, worst_sym{1};                  // adjacent_ratios
+        Real    grad_sum{0}, grad_max{0};                    // smoothness
+        Real    sym_num{0}, sym_den{0}, sym_max{0};          // symmetry
+        Moments log_r{};                                     // geometric_progression
+        Real    r_min{std::numeric_limits<Real>::infinity()};
+        Real    r_max{-std::numeric_limits<Real>::infinity()};
+
+        void merge(const FusedAcc& o) noexcept {
+            min       = std::min(min, o.min);
+            max       = std::max(max, o.max);
+            len.merge(o.len);
+            max_ratio = std::max(max_ratio, o.max_ratio);
+            worst_sym = std::max(worst_sym, o.worst_sym);
+            grad_sum += o.grad_sum;
+            grad_max  = std::max(grad_max, o.grad_max);
+            sym_num  += o.sym_num;
+            sym_den  += o.sym_den;
+            sym_max   = std::max(sym_max, o.sym_max);
+            log_r.merge(o.log_r);
+            r_min     = std::min(r_min, o.r_min);
+            r_max     = std::max(r_max, o.r_max);
+        }
+    };
+
+    static constexpr std::size_t kHistLanes = 4;    // cópias de contador por classe
+    static constexpr std::size_t kBasicLanes = 4;   // acumuladores de basic_block
+    static constexpr std::size_t kHistTile  = 256;  // elementos por ladrilho
+    static constexpr std::size_t kPairTile  = 256;  // pares por ladrilho (all)
+
+    // pos[j] = classe de x[j] (como Real inteiro em [0, bins-1]); mesma
+    // aritmética de bin_index: (u - a)/(b - a)·bins, truncado e saturado.
+    // !(t >= 0) (abaixo de a ou NaN) → 0 antes de qualquer conversão: NaN
+    // convertido para inteiro é UB.
+    static inline void hist_positions(const Real* x, Real* pos, std::size_t m,
+                                      Real a, Real b, std::size_t bins,
+                                      bool log_scale) noexcept {
+        const Real* u = x;
+        if (log_scale) {
+            for (std::size_t j = 0; j < m; ++j) pos[j] = std::log(std::max(x[j], Real(0)));
+            u = pos;
+        }
+        const Real span = b - a;
+        const Real nb   = static_cast<Real>(bins);
+        const Real top  = nb - Real(1);
+        std::size_t j = 0;
+#ifdef FVMG_HAVE_EXPERIMENTAL_SIMD
+        namespace stdx = std::experimental;
+        using V = stdx::native_simd<Real>;
+        const V va(a), vspan(span), vnb(nb), vzero(Real(0)), vtop(top);
+        for (; j + V::size() <= m; j += V::size()) {
+            V t(u + j, stdx::element_aligned);
+            t = (t - va) / vspan * vnb;
+            stdx::where(!(t >= vzero), t) = vzero;
+            t = stdx::min(t, vtop);
+            t.copy_to(pos + j, stdx::element_aligned);
+        }
+#endif
+        for (; j < m; ++j) {
+            const Real t = (u[j] - a) / span * nb;
+            pos[j] = (t >= Real(0)) ? std::min(t, top) : Real(0);
+        }
+    }
+
+    struct HistCtx {
+        std::size_t* counts;
+        Real lo, hi;
+        std::size_t bins;
+    };
+
+    // Por par (i, i+1), j em [0, m): razão ra, razão simétrica sym,
+    // gradiente g, razão r de geometric_progression e lg = max(r, 1e-300)
+    // (o log é tomado depois, em laço próprio). Sem desvios: as seleções
+    // reproduzem std::min/std::max e os ternários do caminho escalar, NaN
+    // incluído. @p x aponta para m+1 larguras.
+    static inline void pair_terms(const Real* x, std::size_t m,
+                                  Real* ra, Real* sym, Real* g, Real* r,
+                                  Real* lg) noexcept {
+        constexpr Real inf  = std::numeric_limits<Real>::infinity();
+        constexpr Real tiny = Real(1e-300);
+        std::size_t j = 0;
+#ifdef FVMG_HAVE_EXPERIMENTAL_SIMD
+        namespace stdx = std::experimental;
+        using V = stdx::native_simd<Real>;
+        const V vzero(Real(0)), vone(Real(1)), vinf(inf), vtiny(tiny);
+        for (; j + V::size() <= m; j += V::size()) {
+            const V vx(x + j, stdx::element_aligned);
+            const V vy(x + j + 1, stdx::element_aligned);
+            const V q = vy / vx;
+
+            V vra = q;
+            stdx::where(vx == vzero, vra) = vinf;
+            V vsym = vone / vra;
+            stdx::where(vra >= vone, vsym) = vra;
+            stdx::where(!(vra > vzero), vsym) = vinf;
+
+            V denom = vx;
+            stdx::where(vy < vx, denom) = vy;
+            V vg = stdx::abs(vy - vx) / denom;
+            stdx::where(!(denom > vzero), vg) = vzero;
+
+            V vr = q;
+            stdx::where(!(vx > vzero), vr) = vone;
+            V vlg = vr;
+            stdx::where(vr < vtiny, vlg) = vtiny;
+
+            vra.copy_to(ra + j, stdx::element_aligned);
+            vsym.copy_to(sym + j, stdx::element_aligned);
+            vg.copy_to(g + j, stdx::element_aligned);
+            vr.copy_to(r + j, stdx::element_aligned);
+            vlg.copy_to(lg + j, stdx::element_aligned);
+        }
+#endif
+        for (; j < m; ++j) {
+            const Real a = x[j];
+            const Real c = x[j + 1];
+            ra[j]  = (a != Real(0)) ? (c / a) : inf;
+            sym[j] = (ra[j] > Real(0)) ? ((ra[j] >= Real(1)) ? ra[j] : (Real(1) / ra[j])) : inf;
+            const Real denom = std::min(a, c);
+            g[j]   = (denom > Real(0)) ? (std::abs(c - a) / denom) : Real(0);
+            r[j]   = (a > Real(0)) ? (c / a) : Real(1);
+            lg[j]  = std::max(r[j], tiny);
+        }
+    }
+
+    // Métricas por elemento e por par (i, i+1) de [b, e) — e ≤ kReduceBlock.
+    // Elementos: basic_block e hist_positions. Pares: ladrilhos de
+    // kPairTile termos (pair_terms, em L1) reduzidos com kBasicLanes
+    // acumuladores; os logs ficam no bloco para o M2 em duas passadas.
+    static inline void fused_segment(std::span<const Real> L, std::size_t b, std::size_t e,
+                                     FusedAcc& acc, const HistCtx* hist) noexcept {
+        if (b >= e) return;
+        const std::size_t n = L.size();
+
+        const BasicAcc el = basic_block(L.subspan(b, e - b));
+        acc.min = std::min(acc.min, el.min);
+        acc.max = std::max(acc.max, el.max);
+        acc.len.merge(el.len);
+
+        if (hist) {
+            std::array<Real, kHistTile> pos;
+            for (std::size_t i0 = b; i0 < e; i0 += kHistTile) {
+                const std::size_t m = std::min(kHistTile, e - i0);
+                hist_positions(L.data() + i0, pos.data(), m, hist->lo, hist->hi,
+                               hist->bins, false);
+                for (std::size_t j = 0; j < m; ++j) {
+                    hist->counts[static_cast<std::size_t>(pos[j])]++;
+                }
+            }
+        }
+
+        const std::size_t pe = std::min(e, n - 1);   // pares (i, i+1) com i < pe
+        if (pe <= b) return;
+        const std::size_t nl = pe - b;
+
+        std::array<Real, core::kReduceBlock> logs;
+        std::array<Real, kPairTile> ra, sym, g, r;
+        std::array<Real, kBasicLanes> mx_ra, mx_sym, g_sum, g_max, r_lo, r_hi, lg_sum;
+        mx_ra.fill(acc.max_ratio);  mx_sym.fill(acc.worst_sym);
+        g_sum.fill(Real(0));        g_max.fill(acc.grad_max);
+        r_lo.fill(acc.r_min);       r_hi.fill(acc.r_max);
+        lg_sum.fill(Real(0));
+
+        for (std::size_t t0 = 0; t0 < nl; t0 += kPairTile) {
+            const std::size_t m  = std::min(kPairTile, nl - t0);
+            Real* lg = logs.data() + t0;
+            pair_terms(L.data() + b + t0, m, ra.data(), sym.data(), g.data(), r.data(), lg);
+            for (std::size_t j = 0; j < m; ++j) lg[j] = std::log(lg[j]);
+
+            for (std::size_t j = 0; j < m; ++j) {
+                const std::size_t k = j % kBasicLanes;
+                mx_ra[k]   = std::max(mx_ra[k], ra[j]);
+                mx_sym[k]  = std::max(mx_sym[k], sym[j]);
+                g_sum[k]  += g[j];
+                g_max[k]   = std::max(g_max[k], g[j]);
+                r_lo[k]    = std::min(r_lo[k], r[j]);
+                r_hi[k]    = std::max(r_hi[k], r[j]);
+                lg_sum[k] += lg[j];
+            }
+        }
+
+        Real sum_log = 0;
+        for (std::size_t k = 0; k < kBasicLanes; ++k) {
+            acc.max_ratio = std::max(acc.max_ratio, mx_ra[k]);
+            acc.worst_sym = std::max(acc.worst_sym, mx_sym[k]);
+            acc.grad_sum += g_sum[k];
+            acc.grad_max  = std::max(acc.grad_max, g_max[k]);
+            acc.r_min     = std::min(acc.r_min, r_lo[k]);
+            acc.r_max     = std::max(acc.r_max, r_hi[k]);
+            sum_log      += lg_sum[k];
+        }
+
+        // segunda passada em cache: M2 dos logs em torno da média do segmento
+        Moments ml{static_cast<Real>(nl), sum_log / static_cast<Real>(nl), Real(0)};
+        for (std::size_t j = 0; j < nl; ++j) { const Real d = logs[j] - ml.mean; ml.m2 += d * d; }
+        acc.log_r.merge(ml);
+    }
+
+    // Pares de simetria (i, n-1-i), i em [b, e) ⊂ [0, n/2)
+    static inline void fused_symmetry(std::span<const Real> L, std::size_t b, std::size_t e,
+                                      FusedAcc& acc) noexcept {
+        const std::size_t n = L.size();
+        for (std::size_t i = b; i < e; ++i) {
+            const Real a = L[i];
+            const Real c = L[n - 1 - i];
+            const Real diff  = std::abs(a - c);
+            const Real denom = std::max(a, c);
+            acc.sym_num += diff;
+            acc.sym_den += denom;
+            acc.sym_max  = std::max(acc.sym_max, (denom > Real(0)) ? (diff / denom) : Real(0));
+        }
+    }
 };
 
 UTILS_NAMESPACE_CLOSE
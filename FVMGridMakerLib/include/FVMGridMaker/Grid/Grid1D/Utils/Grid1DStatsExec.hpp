@@ -5,56 +5,52 @@
 // Módulo    : Grid / Grid1D / Utils
 // Descrição : Estatísticas "básicas" com política de execução SERIAL/PARALELA,
 //             com fallback automático e uma única fonte de verdade.
-// Versão    : 1.2
-// Data      : 2025-10-26
+// Versão    : 1.7
+// Data      : 2025-10-27
 //
 // Leia antes de usar:
 //
 // ► O que este utilitário faz
 //   Expõe uma função única (`basic_exec`) para calcular as estatísticas
-//   básicas de dXFace (min, max, mean, std, aspect, CV). Quando houver
-//   suporte a Parallel STL (PSTL) e backend (ex.: oneTBB) o cálculo
-//   "básico" pode rodar em paralelo. Caso contrário, cai no caminho
-//   SERIAL chamando `Grid1DStats::basic(...)`.
+//   básicas de dXFace (min, max, mean, std, aspect, CV). O cálculo pode
+//   rodar em paralelo via `Grid1DStats::basic(dF, exec)` (std::thread,
+//   Core/ParallelFor.hpp); caso contrário, cai no caminho SERIAL chamando
+//   `Grid1DStats::basic(...)`.
 //
 // ► Como escolho SERIAL ou PARALELO?
-//   - Em compilação: a presença do macro `FVMG_HAVE_PSTL_EXEC` indica
-//     que este TU pode compilar a via paralela. Um .cpp pode "forçar
-//     serial" localmente com `#undef FVMG_HAVE_PSTL_EXEC` (ex.: usando
-//     o controle `FVMG_EX_ENABLE_PAR=0` mostrado no exemplo).
+//   - A via paralela é sempre compilada (só exige std::thread; nenhum
+//     backend PSTL/TBB). O macro `FVMG_HAVE_PSTL_EXEC` não é mais lido.
 //   - Em execução: o chamador escolhe a política via `ExecPolicy`
-//     (`Auto`, `Serial` ou `Parallel`). Em `Auto`, usa paralelo se
-//     disponível; caso contrário, serial. Em `Parallel`, solicita PSTL;
-//     se indisponível, faz fallback para serial.
-//
-// ► Pré-requisitos para paralelismo real
-//   - Instalar e linkar um backend PSTL (ex.: oneTBB).
-//     * Ubuntu/WSL: `sudo apt install libtbb-dev`
-//     * CMake do projeto: habilitar o link (ex.: `-DFVMG_ENABLE_TBB=ON`),
-//       e `target_link_libraries(... TBB::tbb)` em quem usar.
+//     (`Auto`, `Serial` ou `Parallel`). A divisão segue
+//     `core::parallel_chunks`, como nos builders: `Auto` só paraleliza
+//     acima de `core::kParallelGrain` elementos por thread e vale serial
+//     dentro de um laço já paralelo; `Parallel` usa todos os threads de
+//     hardware. Com um único bloco, a redução roda no thread chamador.
 //
 // ► Observações
-//   - Apenas o "núcleo" básico entra em PSTL (reduções min/max/somas).
+//   - Apenas o "núcleo" básico é paralelizado (reduções min/max/somas).
 //     As demais métricas (uniformidade, adjacência, etc.) continuam
 //     disponíveis via `Grid1DStats` como antes (normalmente seriais).
+//   - A variância paralela funde momentos por bloco (Chan et al.) em vez
+//     de `ss/n - média²`: sem cancelamento catastrófico em malhas quase
+//     uniformes e sem aritmética `long double`.
 // ============================================================================
 
 // ----------------------------------------------------------------------------
 // includes FVMGridMaker (ordem alfabética por caminho)
 // ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/ParallelFor.hpp>
 #include <FVMGridMaker/Core/type.h>
 #include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1DView.h>
 #include <FVMGridMaker/Grid/Grid1D/Utils/Grid1DStats.hpp>
 
 // ----------------------------------------------------------------------------
 // includes C++ (ordem alfabética)
 // ----------------------------------------------------------------------------
-#include <cmath>
-#ifdef FVMG_HAVE_PSTL_EXEC
-  #include <execution>
-#endif
-#include <limits>
-#include <numeric>
+#include <algorithm>
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
@@ -64,34 +60,23 @@ namespace FVMGridMaker::grid::grid1d::utils {
  * @brief Políticas de execução para as estatísticas básicas.
  *
  * - `Serial`   : força caminho serial.
- * - `Parallel` : solicita PSTL; se indisponível neste TU, cai p/ serial.
- * - `Auto`     : usa PSTL se disponível; senão serial.
+ * - `Parallel` : divide a redução entre os threads de hardware.
+ * - `Auto`     : paraleliza só se houver trabalho suficiente
+ *                (`core::parallel_chunks`); senão serial.
+ *
+ * @note Definida em `Core/ExecPolicy.hpp` (compartilhada com os builders).
  */
-enum class ExecPolicy { Auto, Serial, Parallel };
+using ExecPolicy = ::FVMGridMaker::core::ExecPolicy;
 
 /**
- * @brief Informa se *este TU* foi compilado com suporte a PSTL.
+ * @brief Informa se a via paralela de `basic_exec` está compilada.
  *
  * @details
- * O valor reflete a visibilidade do macro `FVMG_HAVE_PSTL_EXEC` **neste**
- * ponto de compilação (TU). Um `.cpp` pode "desligar" PSTL localmente,
- * por exemplo via:
- *
- * @code
- * #if !FVMG_EX_ENABLE_PAR
- *   #undef FVMG_HAVE_PSTL_EXEC
- * #endif
- * @endcode
- *
- * @return `true` se PSTL está disponível neste TU; `false` caso contrário.
+ * Sempre `true`: a via paralela usa apenas `std::thread`. Mantida por
+ * compatibilidade; se ela roda de fato depende da política e do hardware
+ * (ver `used_parallel_out` em `basic_exec`).
  */
-[[nodiscard]] constexpr bool has_parallel() noexcept {
-#ifdef FVMG_HAVE_PSTL_EXEC
-  return true;
-#else
-  return false;
-#endif
-}
+[[nodiscard]] constexpr bool has_parallel() noexcept { return true; }
 
 /**
  * @brief Tipo de retorno igual ao de `Grid1DStats::basic(grid)`.
@@ -104,27 +89,26 @@ using BasicReturnT =
 /**
  * @brief Estatísticas básicas com política de execução e fallback automático.
  *
- * @param grid               Instância de malha 1D.
+ * @param grid               Malha 1D (Grid1D ou visão sobre memória externa).
  * @param policy             `ExecPolicy::Auto` (padrão), `Serial` ou `Parallel`.
- * @param used_parallel_out  (opcional) devolve `true` se PSTL foi usado.
+ * @param used_parallel_out  (opcional) devolve `true` se a redução rodou
+ *                           em mais de um thread.
  *
  * @details
  * - Se `policy == Serial`, usa o caminho serial da biblioteca
  *   (`Grid1DStats::basic(grid)`).
- * - Se `policy == Parallel` e o TU tem PSTL (`has_parallel()`), usa
- *   transform_reduce paralelo; caso contrário, faz fallback para serial.
- * - Se `policy == Auto`, usa PSTL quando disponível; senão serial.
+ * - Senão, usa `Grid1DStats::basic(dF, policy)`: os blocos de
+ *   `core::deterministic_reduce` são divididos conforme
+ *   `core::parallel_chunks` (resultado idêntico com 1 ou T threads).
  *
  * @warning Apenas o "núcleo" de min/max/somas é paralelizado; demais
  * métricas continuam disponíveis nas funções auxiliares de `Grid1DStats`.
  *
  * @return Estrutura com {min, max, mean, stddev, aspect, cv}.
  */
-inline BasicReturnT basic_exec(const api::Grid1D& grid,
-                               ExecPolicy policy [[maybe_unused]] = ExecPolicy::Auto,
+inline BasicReturnT basic_exec(api::Grid1DView grid,
+                               ExecPolicy policy = ExecPolicy::Auto,
                                bool* used_parallel_out = nullptr) {
-  using core::Real;
-
   // Entrada vazia → delega ao caminho serial (comportamento consistente).
   const auto dF = grid.deltasFaces();
   if (dF.empty()) {
@@ -132,67 +116,28 @@ inline BasicReturnT basic_exec(const api::Grid1D& grid,
     return Grid1DStats::basic(grid);
   }
 
-#ifdef FVMG_HAVE_PSTL_EXEC
-  const bool want_par =
-      (policy == ExecPolicy::Parallel) ||
-      (policy == ExecPolicy::Auto && has_parallel());
-  if (want_par) {
-    // --- Núcleo paralelo: min/max/soma/soma2 com PSTL ----------------------
-    struct Acc {
-      Real        minv = std::numeric_limits<Real>::infinity();
-      Real        maxv = -std::numeric_limits<Real>::infinity();
-      long double sum  = 0.0L;
-      long double ss   = 0.0L;
-    };
-    auto unary = [](Real x) -> Acc {
-      Acc a;
-      a.minv = x;
-      a.maxv = x;
-      a.sum  = static_cast<long double>(x);
-      a.ss   = static_cast<long double>(x) * static_cast<long double>(x);
-      return a;
-    };
-    auto join = [](const Acc& a, const Acc& b) -> Acc {
-      Acc r;
-      r.minv = std::min(a.minv, b.minv);
-      r.maxv = std::max(a.maxv, b.maxv);
-      r.sum  = a.sum + b.sum;
-      r.ss   = a.ss  + b.ss;
-      return r;
-    };
-
-    const std::size_t n = dF.size();
-    Acc init{};
-    const Acc r = std::transform_reduce(std::execution::par,
-                                        dF.begin(), dF.end(),
-                                        init, join, unary);
-
-    const Real mean   =
-        static_cast<Real>(r.sum / static_cast<long double>(n));
-    const Real var    =
-        static_cast<Real>(r.ss  / static_cast<long double>(n)
-                          - static_cast<long double>(mean) *
-                            static_cast<long double>(mean));
-    const Real stddev = (var > Real(0)) ? std::sqrt(var) : Real(0);
-    const Real aspect = (r.minv > Real(0)) ? (r.maxv / r.minv) : Real(0);
-    const Real cv     = (mean  > Real(0)) ? (stddev / mean)    : Real(0);
-
-    if (used_parallel_out) *used_parallel_out = true;
-
-    BasicReturnT out{};
-    out.min    = r.minv;
-    out.max    = r.maxv;
-    out.mean   = mean;
-    out.stddev = stddev;
-    out.aspect = aspect;
-    out.cv     = cv;
-    return out;
+  if (policy != ExecPolicy::Serial) {
+    // --- Redução por blocos da biblioteca: mesmo resultado com 1 ou T threads.
+    // used_parallel_out reflete a divisão que deterministic_reduce fará.
+    const std::size_t blocks =
+        (dF.size() + core::kReduceBlock - 1u) / core::kReduceBlock;
+    const std::size_t chunks = core::parallel_chunks(
+        blocks, policy,
+        std::max<std::size_t>(core::kParallelGrain / core::kReduceBlock, 1u));
+    if (used_parallel_out) *used_parallel_out = (chunks > 1u);
+    return Grid1DStats::basic(dF, policy);
   }
-#endif // FVMG_HAVE_PSTL_EXEC
 
   // --- Serial (fonte única de verdade na biblioteca) -----------------------
   if (used_parallel_out) *used_parallel_out = false;
   return Grid1DStats::basic(grid);
 }
 
+/// Sobrecarga para Grid1D (aceita também temporários).
+inline BasicReturnT basic_exec(const api::Grid1D& grid,
+                               ExecPolicy policy = ExecPolicy::Auto,
+                               bool* used_parallel_out = nullptr) {
+  return basic_exec(grid.view(), policy, used_parallel_out);
+}
+
 } // namespace FVMGridMaker::grid::grid1d::utils
@@ -1,36 +1,56 @@
 // ----------------------------------------------------------------------------
 // File: Grid1DValidation.hpp
 // Author: FVMGridMaker Team
-// Version: 1.0
+// Version: 1.2
 // Date: 2025-10-26
-// Description: Valida invariantes de malhas 1D (faces/centros crescentes e
-//              larguras positivas), com opção serial/paralela (PSTL).
+// Description: Valida invariantes de malhas 1D (faces/centros crescentes,
+//              larguras positivas e centros dentro das células), com
+//              varredura paralela por blocos e parada antecipada.
 // License: GNU GPL v3
 // ----------------------------------------------------------------------------
 #pragma once
 
+/**
+ * @file  Grid1DValidation.hpp
+ * @brief Validações de malhas 1D que localizam a PRIMEIRA violação.
+ *
+ * @details
+ * Cada thread percorre um trecho contíguo em sub-blocos de
+ * @ref validation::kValidationBlock elementos. Dentro do sub-bloco o
+ * predicado é reduzido sem desvios (laço vetorizável); só um sub-bloco
+ * inválido é revarrido para achar o índice. O menor índice inválido já
+ * encontrado é publicado em um atômico: threads cujo próximo sub-bloco
+ * começa depois dele param. O índice devolvido é sempre o menor índice
+ * inválido do array, independentemente da `ExecPolicy`.
+ *
+ * `first_violation` funde em uma passada as três verificações por célula:
+ * faces crescentes, largura positiva e centro contido na célula.
+ */
+
 // ----------------------------------------------------------------------------
 // includes FVMGridMaker
 // ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/ParallelFor.hpp>
 #include <FVMGridMaker/Core/type.h>
 #include <FVMGridMaker/ErrorHandling/ErrorHandling.h>
-#include <FVMGridMaker/Grid/Grid1D/Errors/GridErrors.h>   // define GridErr
+#include <FVMGridMaker/ErrorHandling/GridErrors.h>        // define GridErr
 #include <FVMGridMaker/Core/namespace.h>                  // macros de namespace
 
 // ----------------------------------------------------------------------------
 // includes C++
 // ----------------------------------------------------------------------------
 #include <algorithm>
-#include <iterator>
+#include <atomic>
+#include <cstddef>
+#include <optional>
 #include <span>
-#if defined(FVMG_HAVE_PSTL_EXEC)
-  #include <execution>
-#endif
+#include <string>
 
 // ----------------------------------------------------------------------------
 // Configuração por macro
 //   FVMG_GRID_RUNTIME_CHECKS : liga/desliga validações (1 padrão)
-//   FVMG_GRID_PAR_MIN_N      : limiar para usar PSTL (se disponível)
+//   FVMG_GRID_PAR_MIN_N      : elementos mínimos por thread em ExecPolicy::Auto
 // ----------------------------------------------------------------------------
 #ifndef FVMG_GRID_RUNTIME_CHECKS
   #define FVMG_GRID_RUNTIME_CHECKS 1
@@ -42,108 +62,143 @@
 FVMG_GRID1D_UTILS_OPEN
 namespace validation {
 
-// faces estritamente crescentes
-inline void strictly_increasing_faces(std::span<const core::Real> xf) {
-#if FVMG_GRID_RUNTIME_CHECKS
-    using Real = core::Real;
-    if (xf.size() < 2) return;
+/// Elementos por sub-bloco entre consultas ao índice inválido já publicado.
+inline constexpr std::size_t kValidationBlock = 4096;
 
-#if defined(FVMG_HAVE_PSTL_EXEC)
-    auto exec = (xf.size() >= FVMG_GRID_PAR_MIN_N) ? std::execution::par : std::execution::seq;
-    bool ok = std::transform_reduce(
-        exec,
-        xf.begin(), xf.end() - 1,
-        xf.begin() + 1,
-        true,
-        std::logical_and<bool>{},
-        std::less<Real>{}
-    );
-    if (!ok) {
-        auto it = std::adjacent_find(xf.begin(), xf.end(),
-                                     [](Real a, Real b){ return !(b > a); });
-        const auto i = static_cast<std::ptrdiff_t>(std::distance(xf.begin(), it));
-        FVMG_ERROR(error::GridErr::NonIncreasingFaces, {{"i", std::to_string(i)}});
+/// Primeira violação encontrada por `first_violation`.
+struct Violation {
+    error::GridErr code;   ///< NonIncreasingFaces, DegenerateMesh ou CenterOutsideCell
+    std::size_t    index;  ///< célula i (faces i/i+1, centro i)
+};
+
+/**
+ * @brief Menor i em [0, n) com `ok(i) == false`, ou n se não houver.
+ *
+ * @param n      Tamanho do intervalo.
+ * @param policy Política de execução (não altera o resultado).
+ * @param ok     Predicado `bool(std::size_t)` sem efeitos colaterais.
+ */
+template <class Pred>
+[[nodiscard]] std::size_t first_failing(std::size_t n, core::ExecPolicy policy, Pred ok) {
+    std::atomic<std::size_t> best{n};
+
+    core::parallel_for_chunks(n, policy, [&best, &ok](std::size_t b, std::size_t e) {
+        for (std::size_t lo = b; lo < e; lo += kValidationBlock) {
+            if (best.load(std::memory_order_relaxed) <= lo) return;
+            const std::size_t hi = std::min(e, lo + kValidationBlock);
+
+            // redução em inteiro: o GCC não vetoriza o mesmo laço em bool
+            unsigned bad = 0u;
+            for (std::size_t i = lo; i < hi; ++i) bad |= static_cast<unsigned>(!ok(i));
+            if (bad == 0u) continue;
+
+            std::size_t i = lo;
+            while (ok(i)) ++i;
+            std::size_t cur = best.load(std::memory_order_relaxed);
+            while (i < cur &&
+                   !best.compare_exchange_weak(cur, i, std::memory_order_relaxed)) {}
+            return;
+        }
+    }, FVMG_GRID_PAR_MIN_N);
+
+    return best.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Primeira célula que viola alguma invariante, em uma única passada.
+ *
+ * Para cada célula i verifica, nesta ordem: xf[i] < xf[i+1]
+ * (NonIncreasingFaces), xf[i+1] - xf[i] > 0 (DegenerateMesh) e
+ * xf[i] <= xc[i] <= xf[i+1] (CenterOutsideCell). NaN falha em todas.
+ *
+ * @param xf     faces (N+1)
+ * @param xc     centros (N)
+ * @param policy política de execução (não altera o resultado)
+ * @return violação da menor célula inválida; vazio se a malha é válida.
+ */
+[[nodiscard]] inline std::optional<Violation>
+first_violation(std::span<const core::Real> xf, std::span<const core::Real> xc,
+                core::ExecPolicy policy = core::ExecPolicy::Auto) {
+    if (xf.empty()) return std::nullopt;
+    const std::size_t n = std::min(xc.size(), xf.size() - 1u);
+    const core::Real* f = xf.data();
+    const core::Real* c = xc.data();
+
+    // '&' (não '&&'): sem desvios, o laço do sub-bloco vetoriza
+    const std::size_t i = first_failing(n, policy, [f, c](std::size_t k) -> bool {
+        return (f[k] < f[k + 1u]) & (f[k + 1u] - f[k] > core::Real(0))
+             & (f[k] <= c[k]) & (c[k] <= f[k + 1u]);
+    });
+    if (i == n) return std::nullopt;
+
+    if (!(f[i] < f[i + 1u]))                 return Violation{error::GridErr::NonIncreasingFaces, i};
+    if (!(f[i + 1u] - f[i] > core::Real(0))) return Violation{error::GridErr::DegenerateMesh, i};
+    return Violation{error::GridErr::CenterOutsideCell, i};
+}
+
+// faces, larguras e centros em uma passada; reporta a primeira violação
+inline void cells(std::span<const core::Real> xf, std::span<const core::Real> xc,
+                  core::ExecPolicy policy = core::ExecPolicy::Auto) {
+#if FVMG_GRID_RUNTIME_CHECKS
+    if (const auto v = first_violation(xf, xc, policy)) {
+        FVMG_ERROR(v->code, {{"i", std::to_string(v->index)}});
     }
 #else
-    auto it = std::adjacent_find(xf.begin(), xf.end(),
-                                 [](Real a, Real b){ return !(b > a); });
-    if (it != xf.end()) {
-        const auto i = static_cast<std::ptrdiff_t>(std::distance(xf.begin(), it));
+    (void)xf; (void)xc; (void)policy;
+#endif
+}
+
+// faces estritamente crescentes
+inline void strictly_increasing_faces(std::span<const core::Real> xf,
+                                      core::ExecPolicy policy = core::ExecPolicy::Auto) {
+#if FVMG_GRID_RUNTIME_CHECKS
+    if (xf.size() < 2) return;
+    const core::Real* f = xf.data();
+    const std::size_t n = xf.size() - 1u;
+    const std::size_t i = first_failing(n, policy, [f](std::size_t k) {
+        return f[k] < f[k + 1u];
+    });
+    if (i != n) {
         FVMG_ERROR(error::GridErr::NonIncreasingFaces, {{"i", std::to_string(i)}});
     }
-#endif
 #else
-    (void)xf;
+    (void)xf; (void)policy;
 #endif
 }
 
 // centros estritamente crescentes
-inline void strictly_increasing_centers(std::span<const core::Real> xc) {
+inline void strictly_increasing_centers(std::span<const core::Real> xc,
+                                        core::ExecPolicy policy = core::ExecPolicy::Auto) {
 #if FVMG_GRID_RUNTIME_CHECKS
-    using Real = core::Real;
     if (xc.size() < 2) return;
-
-#if defined(FVMG_HAVE_PSTL_EXEC)
-    auto exec = (xc.size() >= FVMG_GRID_PAR_MIN_N) ? std::execution::par : std::execution::seq;
-    bool ok = std::transform_reduce(
-        exec,
-        xc.begin(), xc.end() - 1,
-        xc.begin() + 1,
-        true,
-        std::logical_and<bool>{},
-        std::less<Real>{}
-    );
-    if (!ok) {
-        auto it = std::adjacent_find(xc.begin(), xc.end(),
-                                     [](Real a, Real b){ return !(b > a); });
-        const auto i = static_cast<std::ptrdiff_t>(std::distance(xc.begin(), it));
+    const core::Real* c = xc.data();
+    const std::size_t n = xc.size() - 1u;
+    const std::size_t i = first_failing(n, policy, [c](std::size_t k) {
+        return c[k] < c[k + 1u];
+    });
+    if (i != n) {
         FVMG_ERROR(error::GridErr::NonIncreasingCenters, {{"i", std::to_string(i)}});
     }
 #else
-    auto it = std::adjacent_find(xc.begin(), xc.end(),
-                                 [](Real a, Real b){ return !(b > a); });
-    if (it != xc.end()) {
-        const auto i = static_cast<std::ptrdiff_t>(std::distance(xc.begin(), it));
-        FVMG_ERROR(error::GridErr::NonIncreasingCenters, {{"i", std::to_string(i)}});
-    }
-#endif
-#else
-    (void)xc;
+    (void)xc; (void)policy;
 #endif
 }
 
 // larguras entre faces estritamente positivas
-inline void positive_face_lengths(std::span<const core::Real> xf) {
+inline void positive_face_lengths(std::span<const core::Real> xf,
+                                  core::ExecPolicy policy = core::ExecPolicy::Auto) {
 #if FVMG_GRID_RUNTIME_CHECKS
-    using Real = core::Real;
     if (xf.size() < 2) return;
-
-#if defined(FVMG_HAVE_PSTL_EXEC)
-    auto exec = (xf.size() >= FVMG_GRID_PAR_MIN_N) ? std::execution::par : std::execution::seq;
-    bool ok = std::transform_reduce(
-        exec,
-        xf.begin(), xf.end() - 1,
-        xf.begin() + 1,
-        true,
-        std::logical_and<bool>{},
-        [](Real a, Real b){ return b - a > Real(0); }
-    );
-    if (!ok) {
-        auto it = std::adjacent_find(xf.begin(), xf.end(),
-                                     [](Real a, Real b){ return !(b - a > Real(0)); });
-        const auto i = static_cast<std::ptrdiff_t>(std::distance(xf.begin(), it));
-        FVMG_ERROR(error::GridErr::NonPositiveDxFace, {{"i", std::to_string(i)}});
-    }
-#else
-    auto it = std::adjacent_find(xf.begin(), xf.end(),
-                                 [](Real a, Real b){ return !(b - a > Real(0)); });
-    if (it != xf.end()) {
-        const auto i = static_cast<std::ptrdiff_t>(std::distance(xf.begin(), it));
-        FVMG_ERROR(error::GridErr::NonPositiveDxFace, {{"i", std::to_string(i)}});
+    const core::Real* f = xf.data();
+    const std::size_t n = xf.size() - 1u;
+    const std::size_t i = first_failing(n, policy, [f](std::size_t k) {
+        return f[k + 1u] - f[k] > core::Real(0);
+    });
+    if (i != n) {
+        FVMG_ERROR(error::GridErr::DegenerateMesh, {{"i", std::to_string(i)}});
     }
-#endif
 #else
-    (void)xf;
+    (void)xf; (void)policy;
 #endif
 }
 
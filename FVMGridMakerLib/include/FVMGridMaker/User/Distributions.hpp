@@ -1,7 +1,7 @@
 // ----------------------------------------------------------------------------
 // File: Distributions.hpp  (USER-SIDE EXTENSION POINT)
 // Author: You / Your Team
-// Version: 1.0
+// Version: 1.1
 // Date: 2025-10-25
 // Description: Registro de distribuições customizadas do usuário.
 //              Inclua aqui os headers dos SEUS functors e liste-os na macro
@@ -26,8 +26,7 @@
 // 1) INCLUA os headers dos seus functors de distribuição (se houver):
 // -----------------------------------------------------------------------------
 
-// Exemplo (substitua pelos seus caminhos):
-// #include <MyProject/Grids/Geometric1D.hpp>
+// Exemplo (substitua pelos seus caminhos; Geometric1D já vem na biblioteca):
 // #include <MyProject/Grids/Clustered1D.hpp>
 
 // -----------------------------------------------------------------------------
@@ -41,7 +40,6 @@
 
 #ifndef FVMG_DISTRIBUTIONS_EXTRA
 #define FVMG_DISTRIBUTIONS_EXTRA(X) \
-    /* X(Geometric1D) */            \
     /* X(Clustered1D) */            \
     /* acrescente os seus aqui... */
 #endif
@@ -1,22 +1,27 @@
 // ----------------------------------------------------------------------------
 // File: DistOptions.cpp
 // Author: FVMGridMaker Team
-// Version: 2.0
+// Version: 2.3
 // Date: 2025-10-26
-// Description: Implementação das fábricas de DistOptions para Random1D.
+// Description: Implementação das fábricas de DistOptions (Random1D,
+//              Geometric1D, Vinokur1D, Equidistribution1D).
 // License: GNU GPL v3
 // ----------------------------------------------------------------------------
 
 /**
  * @file DistOptions.cpp
- * @brief Implementação de @ref DistOptions (fábricas para Random1D).
+ * @brief Implementação de @ref DistOptions (fábricas para Random1D, Geometric1D, Vinokur1D e
+ *        Equidistribution1D).
  */
 
 #include <FVMGridMaker/Core/namespace.h>
 #include <FVMGridMaker/Grid/Grid1D/Builders/DistOptions.hpp>
 
 // Precisamos conhecer o tipo do payload ao construir o std::any:
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Equidistribution1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Geometric1D.hpp>
 #include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Random1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Vinokur1D.hpp>
 
 FVMGRIDMAKER_NAMESPACE_OPEN
 GRID_NAMESPACE_OPEN
@@ -56,6 +61,59 @@ DistOptions DistOptions::Random1D_Clock(core::Real w_lo,
     return out;
 }
 
+DistOptions DistOptions::Geometric1D_Ratio(core::Real ratio)
+{
+    DistOptions out;
+    out.tag = grid::DistributionTag::Geometric1D;
+
+    patterns::distribution::Geometric1D::Options opt{};
+    opt.ratio = ratio;
+    out.any = opt;
+
+    return out;
+}
+
+DistOptions DistOptions::Vinokur1D_Widths(core::Real first_width, core::Real last_width)
+{
+    DistOptions out;
+    out.tag = grid::DistributionTag::Vinokur1D;
+
+    patterns::distribution::Vinokur1D::Options opt{};
+    opt.first_width = first_width;
+    opt.last_width  = last_width;
+    out.any = opt;
+
+    return out;
+}
+
+DistOptions DistOptions::Equidistribution1D_Density(std::vector<core::Real> density,
+                                                    std::vector<core::Real> positions)
+{
+    DistOptions out;
+    out.tag = grid::DistributionTag::Equidistribution1D;
+
+    patterns::distribution::Equidistribution1D::Options opt{};
+    opt.density   = std::move(density);
+    opt.positions = std::move(positions);
+    out.any = std::move(opt);
+
+    return out;
+}
+
+DistOptions DistOptions::Equidistribution1D_Monitor(std::function<core::Real(core::Real)> monitor,
+                                                    core::Index samples)
+{
+    DistOptions out;
+    out.tag = grid::DistributionTag::Equidistribution1D;
+
+    patterns::distribution::Equidistribution1D::Options opt{};
+    opt.monitor = std::move(monitor);
+    opt.samples = samples;
+    out.any = std::move(opt);
+
+    return out;
+}
+
 BUILDERS_NAMESPACE_CLOSE
 GRID1D_NAMESPACE_CLOSE
 GRID_NAMESPACE_CLOSE
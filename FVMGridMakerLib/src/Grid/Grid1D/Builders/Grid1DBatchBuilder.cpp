@@ -0,0 +1,162 @@
+// ----------------------------------------------------------------------------
+/* File: Grid1DBatchBuilder.cpp
+ * Author: FVMGridMaker Team
+ * Version: 1.2
+ * Date: 2025-10-27
+ * Description: Implementação do Grid1DBatchBuilder.
+ *   - Validação de todas as especificações antes de gerar
+ *   - Uma entrada do registro por DistributionTag distinto
+ *   - Arena única (sem inicialização) com as malhas em sequência,
+ *     reaproveitada por buildInto() quando comporta o lote
+ *   - Malhas divididas entre threads; cada uma gerada por
+ *     detail::fill_grid1d (mesmo caminho de Grid1DBuilder::build())
+ *   - Exceções de uma malha relançadas com o índice do spec na mensagem
+ * License: GNU GPL v3
+ */
+// ----------------------------------------------------------------------------
+
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBatchBuilder.hpp>
+
+#include <FVMGridMaker/Core/ParallelFor.hpp>
+#include <FVMGridMaker/ErrorHandling/ErrorHandling.h>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DDistributionRegistry.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DFill.hpp>
+
+// C++
+#include <algorithm>
+#include <any>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+FVMG_GRID1D_BUILDERS_OPEN
+
+using core::Index;
+using core::Real;
+using Entry = Grid1DDistributionRegistry::Entry;
+
+namespace {
+
+// Relança a exceção corrente com " [spec i]" na mensagem (mesmo tipo e
+// código): o erro de um worker identifica a malha do lote.
+[[noreturn]] void rethrow_with_spec(std::size_t i) {
+    const std::string tag = " [spec " + std::to_string(i) + "]";
+    try {
+        throw;
+    } catch (const error::FVMGException& e) {
+        auto r = e.record();
+        r.message += tag;
+        throw error::FVMGException(std::move(r));
+    } catch (const std::invalid_argument& e) {
+        throw std::invalid_argument(e.what() + tag);
+    } catch (const std::runtime_error& e) {
+        throw std::runtime_error(e.what() + tag);
+    }
+}
+
+} // namespace
+
+Grid1DBatchBuilder& Grid1DBatchBuilder::setExecPolicy(core::ExecPolicy policy) {
+    this->exec_ = policy;
+    return *this;
+}
+
+Grid1DBatchBuilder& Grid1DBatchBuilder::setValidation(bool enabled) {
+    this->check_ = enabled;
+    return *this;
+}
+
+Grid1DBatch Grid1DBatchBuilder::build(std::span<const Grid1DSpec> specs) const {
+    Grid1DBatch batch;
+    this->buildInto(specs, batch);
+    return batch;
+}
+
+void Grid1DBatchBuilder::buildInto(std::span<const Grid1DSpec> specs, Grid1DBatch& batch) const {
+    // 1) Validação (antes de tocar no lote; sem exceção, com Policy::Status,
+    //    o lote anterior fica intacto)
+    for (std::size_t i = 0; i < specs.size(); ++i) {
+        const auto& s = specs[i];
+        if (s.n == 0) {
+            FVMG_ERROR(error::CoreErr::InvalidArgument, {
+                {"where", "Grid1DBatchBuilder::build"},
+                {"what",  "N must be > 0"},
+                {"i",     std::to_string(i)}
+            });
+            return;
+        }
+        if (!(s.b > s.a)) {
+            FVMG_ERROR(error::CoreErr::InvalidArgument, {
+                {"where", "Grid1DBatchBuilder::build"},
+                {"what",  "requires B > A"},
+                {"i",     std::to_string(i)}
+            });
+            return;
+        }
+    }
+
+    // Layout: malha i ocupa [off[i], off[i+1]) = 4N+2 reais
+    batch.m_offsets.clear();
+    if (specs.empty()) return;
+    batch.m_offsets.resize(specs.size() + 1u);
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < specs.size(); ++i) {
+        batch.m_offsets[i] = total;
+        total += 4u * static_cast<std::size_t>(specs[i].n) + 2u;
+    }
+    batch.m_offsets.back() = total;
+
+    // 2) Uma entrada do registro por tag (cópias em nós estáveis do map
+    //    quando o registro não está congelado)
+    std::map<grid::DistributionTag, std::optional<Entry>> copies;
+    std::map<grid::DistributionTag, const Entry*>         resolved;
+    std::vector<const Entry*> entries(specs.size());
+    for (std::size_t i = 0; i < specs.size(); ++i) {
+        const auto tag = specs[i].dist.tag;
+        auto [it, inserted] = resolved.try_emplace(tag, nullptr);
+        if (inserted) it->second = detail::resolve_entry(tag, copies[tag]);
+        entries[i] = it->second;
+    }
+
+    // 3) Geração: malhas divididas entre threads; com uma só fatia, o
+    //    fechamento de cada malha usa a ExecPolicy do lote. Com o lote
+    //    dividido, geradores em Auto (Options::exec) rodam serial em cada
+    //    worker (regra de aninhamento de parallel_for_chunks)
+    if (batch.m_capacity < total) {
+        batch.m_data     = std::make_unique_for_overwrite<Real[]>(total);
+        batch.m_capacity = total;
+    }
+    Real* const data = batch.m_data.get();
+
+    const std::size_t grain = std::max<std::size_t>(
+        core::kParallelGrain / std::max<std::size_t>(total / specs.size(), 1u), 1u);
+    const bool split = core::parallel_chunks(specs.size(), this->exec_, grain) > 1u;
+    const core::ExecPolicy inner = split ? core::ExecPolicy::Serial : this->exec_;
+
+    core::parallel_for_chunks(specs.size(), this->exec_, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t i = lo; i < hi; ++i) {
+            const auto&       s = specs[i];
+            const std::size_t n = static_cast<std::size_t>(s.n);
+            Real* p = data + batch.m_offsets[i];
+
+            const std::any* options = s.dist.any.has_value() ? &s.dist.any : nullptr;
+            try {
+                detail::fill_grid1d(*entries[i], s.a, s.b, s.centering, options, inner,
+                                    this->check_,
+                                    std::span<Real>(p,                n + 1u),
+                                    std::span<Real>(p + n + 1u,       n),
+                                    std::span<Real>(p + 2u * n + 1u,  n),
+                                    std::span<Real>(p + 3u * n + 1u,  n + 1u));
+            } catch (...) {
+                rethrow_with_spec(i);
+            }
+        }
+    }, grain);
+}
+
+FVMG_GRID1D_BUILDERS_CLOSE
@@ -1,33 +1,60 @@
 // ----------------------------------------------------------------------------
 /* File: Grid1DBuilder.cpp
  * Author: FVMGridMaker Team
- * Version: 2.4
- * Date: 2025-10-26
+ * Version: 3.8
+ * Date: 2025-10-27
  * Description: Implementação do Grid1DBuilder.
- *   - Obtém geradores via Grid1DDistributionRegistry (faces/centers)
- *   - Fecha a malha conforme o centering (Face/Cell)
+ *   - Obtém geradores via Grid1DDistributionRegistry (faces/centers);
+ *     com o registro congelado, acesso O(1) sem lock (entryForTag)
+ *   - Escreve faces/centros/dF/dC direto na arena única (Grid1DStorage)
+ *   - buildInto(): mesma malha em buffers do chamador (sem alocação)
+ *   - Fecha a malha conforme o centering (Face/Cell) com o kernel fundido
+ *     ClosureKernel1D: xc/xf, dF e dC em uma varredura por blocos (SIMD),
+ *     paralela conforme a ExecPolicy (resultado idêntico ao serial)
  *   - Validações integram com ErrorHandling (FVMGException)
+ *   - setValidation(true): dF > 0 e dC > 0 verificados dentro do kernel
+ *     de fechamento; a primeira violação vira FVMG_ERROR(GridErr::...)
+ *   - Opções (Random1D/Geometric1D/Vinokur1D/Equidistribution1D) empacotadas em std::any para o tag
+ *     corrente em setDistribution/setOption, não a cada build
+ *   - detail::resolve_entry/fill_grid1d: núcleo de build() reutilizado
+ *     pelo Grid1DBatchBuilder
+ *   - stream()/buildChunked(): geração em blocos (Grid1DStream) sem o
+ *     registro; a sequência base vem direto de Uniform1D/Random1D
  * License: GNU GPL v3
  */
 // ----------------------------------------------------------------------------
 
 #include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBuilder.hpp>
 
-// Registro de distribuições
+// Registro de distribuições e núcleo compartilhado de geração
 #include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DDistributionRegistry.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DFill.hpp>
 
 // API/Tags
 #include <FVMGridMaker/Grid/Common/Tags1D.hpp>
 #include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1DStorage.h>
+
+// Kernel fundido de fechamento (blocos de cache + SIMD + ExecPolicy)
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Centering/ClosureKernel1D.hpp>
+
+// Distribuições com geração em blocos
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Random1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Uniform1D.hpp>
 
 // *** Error handling (umbrella) ***
 #include <FVMGridMaker/ErrorHandling/ErrorHandling.h>
+#include <FVMGridMaker/ErrorHandling/GridErrors.h>
 
 // C++
 #include <algorithm>
 #include <any>
+#include <cmath>
+#include <functional>
 #include <iterator>
 #include <numeric>
+#include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -40,6 +67,7 @@ using core::Real;
 using grid::DistributionTag;
 using grid::CenteringTag;
 using api::Grid1D;
+using api::Grid1DStorage;
 
 // ----------------------------------------------------------------------------
 // Setters (fluent API)
@@ -57,6 +85,7 @@ Grid1DBuilder& Grid1DBuilder::setDomain(Real a, Real b) {
 
 Grid1DBuilder& Grid1DBuilder::setDistribution(DistributionTag tag) {
     this->dist_ = tag;
+    this->pack_options();
     return *this;
 }
 
@@ -68,13 +97,60 @@ Grid1DBuilder& Grid1DBuilder::setCentering(CenteringTag centering) {
 Grid1DBuilder& Grid1DBuilder::setOption(
     const FVMGridMaker::grid::grid1d::patterns::distribution::Random1D::Options& opt) {
     this->random1d_options_ = opt;
+    this->pack_options();
+    return *this;
+}
+
+Grid1DBuilder& Grid1DBuilder::setOption(
+    const FVMGridMaker::grid::grid1d::patterns::distribution::Geometric1D::Options& opt) {
+    this->geometric1d_options_ = opt;
+    this->pack_options();
+    return *this;
+}
+
+Grid1DBuilder& Grid1DBuilder::setOption(
+    const FVMGridMaker::grid::grid1d::patterns::distribution::Vinokur1D::Options& opt) {
+    this->vinokur1d_options_ = opt;
+    this->pack_options();
+    return *this;
+}
+
+Grid1DBuilder& Grid1DBuilder::setOption(
+    const FVMGridMaker::grid::grid1d::patterns::distribution::Equidistribution1D::Options& opt) {
+    this->equidistribution1d_options_ = opt;
+    this->pack_options();
+    return *this;
+}
+
+// Payload do registro = opções da distribuição corrente (se fornecidas)
+void Grid1DBuilder::pack_options() {
+    this->options_any_.reset();
+    if (this->dist_ == DistributionTag::Random1D && this->random1d_options_) {
+        this->options_any_ = *this->random1d_options_;
+    } else if (this->dist_ == DistributionTag::Geometric1D && this->geometric1d_options_) {
+        this->options_any_ = *this->geometric1d_options_;
+    } else if (this->dist_ == DistributionTag::Vinokur1D && this->vinokur1d_options_) {
+        this->options_any_ = *this->vinokur1d_options_;
+    } else if (this->dist_ == DistributionTag::Equidistribution1D &&
+               this->equidistribution1d_options_) {
+        this->options_any_ = *this->equidistribution1d_options_;
+    }
+}
+
+Grid1DBuilder& Grid1DBuilder::setExecPolicy(ExecPolicy policy) {
+    this->exec_ = policy;
+    return *this;
+}
+
+Grid1DBuilder& Grid1DBuilder::setValidation(bool enabled) {
+    this->check_ = enabled;
     return *this;
 }
 
 // ----------------------------------------------------------------------------
-// build()
+// Validação dos parâmetros
 // ----------------------------------------------------------------------------
-Grid1D Grid1DBuilder::build() const {
+void Grid1DBuilder::validate() const {
     // Validações que o teste espera lançar FVMGException:
     if (this->n_ == 0) {
         FVMG_ERROR(error::CoreErr::InvalidArgument, {
@@ -88,85 +164,221 @@ Grid1D Grid1DBuilder::build() const {
             {"what",  "requires B > A"}
         });
     }
+}
 
-    // Resolve geradores no registro
-    auto& reg = Grid1DDistributionRegistry::instance();
+// ----------------------------------------------------------------------------
+// build()
+// ----------------------------------------------------------------------------
+Grid1D Grid1DBuilder::build() const {
+    this->validate();
 
-    auto nameOpt = reg.nameForTag(this->dist_);
-    if (!nameOpt.has_value()) {
-        // não é verificado em teste; manter std::runtime_error está OK
-        throw std::runtime_error("Grid1DBuilder::build(): distribuição não registrada para o tag.");
-    }
+    // Arena única (faces | centros | dF | dC), alinhada a 64 bytes
+    Grid1DStorage storage(this->n_);
+    this->fill(storage.faces(), storage.centers(),
+               storage.deltasFaces(), storage.deltasCenters());
+    return Grid1D{std::move(storage)};
+}
 
-    auto entryOpt = reg.find(*nameOpt);
-    if (!entryOpt.has_value()) {
-        throw std::runtime_error("Grid1DBuilder::build(): gerador ausente no registro.");
+// ----------------------------------------------------------------------------
+// buildInto()
+// ----------------------------------------------------------------------------
+void Grid1DBuilder::buildInto(std::span<Real> xf,
+                              std::span<Real> xc,
+                              std::span<Real> dF,
+                              std::span<Real> dC) const {
+    this->validate();
+
+    const std::size_t N = static_cast<std::size_t>(this->n_);
+    if (xf.size() != N + 1u || xc.size() != N ||
+        dF.size() != N      || dC.size() != N + 1u) {
+        FVMG_ERROR(error::CoreErr::InvalidArgument, {
+            {"where", "Grid1DBuilder::buildInto"},
+            {"what",  "buffer sizes must be (N+1, N, N, N+1)"}
+        });
+        return;   // Policy::Status: buffers intocados
     }
-    const auto& entry = *entryOpt;
-
-    // Empacota Options específicas (quando Random1D)
-    const std::any* options_any = nullptr;
-    std::any holder;
-    if (this->dist_ == DistributionTag::Random1D && this->random1d_options_.has_value()) {
-        holder      = *this->random1d_options_;
-        options_any = &holder;
+    this->fill(xf, xc, dF, dC);
+}
+
+// ----------------------------------------------------------------------------
+// fill(): gera a sequência base e fecha a malha nos spans de saída
+// ----------------------------------------------------------------------------
+void Grid1DBuilder::fill(std::span<Real> xf,
+                         std::span<Real> xc,
+                         std::span<Real> dF,
+                         std::span<Real> dC) const {
+    std::optional<Grid1DDistributionRegistry::Entry> entryCopy;
+    const auto* entry = detail::resolve_entry(this->dist_, entryCopy);
+
+    // Opções específicas já empacotadas em setOption(...)
+    const std::any* options_any =
+        this->options_any_.has_value() ? &this->options_any_ : nullptr;
+
+    detail::fill_grid1d(*entry, this->a_, this->b_, this->cent_, options_any,
+                        this->exec_, this->check_, xf, xc, dF, dC);
+}
+
+// ----------------------------------------------------------------------------
+// detail: núcleo compartilhado com o Grid1DBatchBuilder
+// ----------------------------------------------------------------------------
+DETAIL_NAMESPACE_OPEN
+
+const Grid1DDistributionRegistry::Entry*
+resolve_entry(DistributionTag tag,
+              std::optional<Grid1DDistributionRegistry::Entry>& copy) {
+    // Resolve geradores no registro: congelado -> ponteiro estável, O(1),
+    // sem lock nem alocação; caso contrário, cópia da entrada sob lock.
+    auto& reg = Grid1DDistributionRegistry::instance();
+
+    const Grid1DDistributionRegistry::Entry* entryPtr = reg.entryForTag(tag);
+    if (entryPtr == nullptr) {
+        if (reg.isFrozen() || !(copy = reg.findByTag(tag))) {
+            // não é verificado em teste; manter std::runtime_error está OK
+            throw std::runtime_error("Grid1DBuilder::build(): distribuição não registrada para o tag.");
+        }
+        entryPtr = &*copy;
     }
+    return entryPtr;
+}
 
-    std::vector<Real> xf; // faces (N+1)
-    std::vector<Real> xc; // centros (N)
+void fill_grid1d(const Grid1DDistributionRegistry::Entry& entry,
+                 Real a, Real b, CenteringTag centering_tag,
+                 const std::any* options_any,
+                 ExecPolicy exec, bool check,
+                 std::span<Real> xf,
+                 std::span<Real> xc,
+                 std::span<Real> dF,
+                 std::span<Real> dC) {
+    const std::size_t N = xc.size();
+    const Index       n = static_cast<Index>(N);
 
     // 1) Gera sequência base
-    if (this->cent_ == CenteringTag::FaceCentered) {
-        // Base: faces
-        xf = entry.faces_fn(this->n_, this->a_, this->b_, options_any);
-        if (xf.size() != static_cast<std::size_t>(this->n_) + 1u) {
-            throw std::runtime_error("Distribuição gerou faces com tamanho inválido.");
+    if (centering_tag == CenteringTag::FaceCentered) {
+        // Base: faces (in-place quando a distribuição oferece fill_faces_fn)
+        if (entry.fill_faces_fn) {
+            entry.fill_faces_fn(n, a, b, xf, options_any);
+        } else {
+            const auto base = entry.faces_fn(n, a, b, options_any);
+            if (base.size() != N + 1u) {
+                throw std::runtime_error("Distribuição gerou faces com tamanho inválido.");
+            }
+            std::copy(base.begin(), base.end(), xf.begin());
         }
-
-        // Deriva centros: média entre faces adjacentes
-        xc.resize(static_cast<std::size_t>(this->n_));
-        auto itR = std::next(xf.begin());
-        std::transform(
-            xf.begin(), std::prev(xf.end()), xc.begin(),
-            [&](Real xL) { Real xR = *itR++; return Real(0.5) * (xL + xR); }
-        );
     } else {
-        // Base: centros
-        xc = entry.centers_fn(this->n_, this->a_, this->b_, options_any);
-        if (xc.size() != static_cast<std::size_t>(this->n_)) {
-            throw std::runtime_error("Distribuição gerou centros com tamanho inválido.");
+        // Base: centros (in-place quando a distribuição oferece fill_centers_fn)
+        if (entry.fill_centers_fn) {
+            entry.fill_centers_fn(n, a, b, xc, options_any);
+        } else {
+            const auto base = entry.centers_fn(n, a, b, options_any);
+            if (base.size() != N) {
+                throw std::runtime_error("Distribuição gerou centros com tamanho inválido.");
+            }
+            std::copy(base.begin(), base.end(), xc.begin());
         }
+    }
 
-        // Fecha faces
-        xf.resize(static_cast<std::size_t>(this->n_) + 1u);
-        xf.front() = this->a_;
-        xf.back()  = this->b_;
-        if (this->n_ >= 2) {
-            for (std::size_t i = 1; i < static_cast<std::size_t>(this->n_); ++i) {
-                xf[i] = Real(0.5) * (xc[i - 1] + xc[i]);
-            }
+    // 2) Fechamento fundido: uma varredura escreve as três saídas restantes.
+    //    CellCentered: faces de borda fechadas no domínio [A,B].
+    namespace centering = FVMGridMaker::grid::grid1d::patterns::centering;
+    const auto bad = (centering_tag == CenteringTag::FaceCentered)
+        ? centering::close_from_faces(xf, xc, dF, dC, exec, check)
+        : centering::close_from_centers(xc, a, b, xf, dF, dC, exec, check);
+
+    // 3) Violação encontrada no fechamento: k é a menor posição com
+    //    dF[k] <= 0 ou dC[k] <= 0; classifica a partir dos valores em k.
+    if (bad) {
+        const std::size_t k = *bad;
+        error::GridErr code = error::GridErr::CenterOutsideCell;
+        std::size_t    i    = k;
+        if (k < N && !(xf[k] <= xf[k + 1u])) {
+            code = error::GridErr::NonIncreasingFaces;   // faces decrescentes (ou NaN)
+        } else if (k < N && !(dF[k] > Real(0))) {
+            code = error::GridErr::DegenerateMesh;       // faces iguais: largura nula
+        } else if (k == N) {
+            i = N - 1u;                                  // xf[N] <= xc[N-1]
+        } else if (k > 0) {
+            code = error::GridErr::NonIncreasingCenters; // xc[k] <= xc[k-1]
+            i    = k - 1u;
         }
+        FVMG_ERROR(code, {{"i", std::to_string(i)}});
+    }
+}
+
+DETAIL_NAMESPACE_CLOSE
+
+// ----------------------------------------------------------------------------
+// stream() / buildChunked()
+// ----------------------------------------------------------------------------
+Grid1DStream Grid1DBuilder::stream(Index chunk) const {
+    namespace dist = FVMGridMaker::grid::grid1d::patterns::distribution;
+    const bool  faces = (this->cent_ == CenteringTag::FaceCentered);
+    const Index N     = this->n_;
+    const Real  A     = this->a_;
+    const Real  B     = this->b_;
+
+    // Após FVMG_ERROR sem exceção (Policy::Status): stream sem blocos
+    auto empty = [&] {
+        return Grid1DStream(0, A, B, this->cent_, 1, this->exec_, {});
+    };
+
+    this->validate();
+    if (N == 0 || !(B > A)) return empty();
+    if (chunk == 0) {
+        FVMG_ERROR(error::CoreErr::InvalidArgument, {
+            {"where", "Grid1DBuilder::stream"},
+            {"what",  "chunk must be > 0"}
+        });
+        return empty();
     }
 
-    // 2) dF (N) = dif entre faces adjacentes
-    std::vector<Real> dF(static_cast<std::size_t>(this->n_));
-    std::transform(
-        std::next(xf.begin()), xf.end(), xf.begin(), dF.begin(),
-        [](Real xr, Real xl){ return xr - xl; }
-    );
-
-    // 3) dC (N+1): convenção do projeto
-    std::vector<Real> dC(static_cast<std::size_t>(this->n_) + 1u);
-    dC.front() = xc.front() - xf.front();
-    if (this->n_ >= 2) {
-        std::transform(
-            std::next(xc.begin()), xc.end(), xc.begin(), std::next(dC.begin()),
-            [](Real c, Real p){ return c - p; }
-        );
+    // Sequência base em ordem; cada gerador guarda a própria posição.
+    Grid1DStream::BaseFn base;
+    if (this->dist_ == DistributionTag::Uniform1D) {
+        base = [faces, N, A, B, pos = std::size_t(0)](std::span<Real> out) mutable {
+            if (faces) dist::Uniform1D::facesRange(N, A, B, pos, out);
+            else       dist::Uniform1D::centersRange(N, A, B, pos, out);
+            pos += out.size();
+        };
+    } else if (this->dist_ == DistributionTag::Random1D &&
+               this->random1d_options_ &&
+               this->random1d_options_->policy == Random1D::Options::Policy::CounterBased) {
+        // Mesmas expressões de Random1D::faces_into / centers_into
+        dist::Random1D::PrefixStream ps(N, &*this->random1d_options_);
+        const Real total = ps.total();
+        auto face = [A, B, total](Real p) { return std::lerp(A, B, p / total); };
+        if (faces) {
+            base = [ps, face, A, pos = std::size_t(0)](std::span<Real> out) mutable {
+                if (pos == 0 && !out.empty()) out.front() = A;
+                const std::span<Real> P = out.subspan(pos == 0 ? 1u : 0u);
+                ps.next(P);
+                for (auto& v : P) v = face(v);
+                pos += out.size();
+            };
+        } else {
+            base = [ps, face, left = face(Real(0))](std::span<Real> out) mutable {
+                ps.next(out);
+                for (auto& v : out) {
+                    const Real right = face(v);
+                    v    = Real(0.5) * (left + right);
+                    left = right;
+                }
+            };
+        }
+    } else {
+        FVMG_ERROR(error::CoreErr::InvalidArgument, {
+            {"where", "Grid1DBuilder::stream"},
+            {"what",  "streaming supports Uniform1D and Random1D (Policy::CounterBased)"}
+        });
+        return empty();
     }
-    dC.back() = xf.back() - xc.back();
 
-    return Grid1D{std::move(xf), std::move(xc), std::move(dF), std::move(dC)};
+    return Grid1DStream(N, A, B, this->cent_, chunk, this->exec_, std::move(base));
+}
+
+void Grid1DBuilder::buildChunked(
+    Index chunk, const std::function<void(Index, const api::Grid1DView&)>& sink) const {
+    auto s = this->stream(chunk);
+    while (s.next()) sink(s.first(), s.chunk());
 }
 
 FVMG_GRID1D_BUILDERS_CLOSE
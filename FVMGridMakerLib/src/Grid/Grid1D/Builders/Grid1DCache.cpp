@@ -0,0 +1,183 @@
+// ----------------------------------------------------------------------------
+/* File: Grid1DCache.cpp
+ * Author: FVMGridMaker Team
+ * Version: 1.4
+ * Date: 2025-10-27
+ * Description: Implementação do Grid1DCache.
+ *   - Lista LRU (frente = mais recente) + índice hash chave → nó da lista
+ *   - build() roda fora do lock; a inserção resolve corridas pela mesma chave
+ *   - Chave: parâmetros do builder + opções da distribuição ativa (sem
+ *     ExecPolicy)
+ *   - Equidistribution1D com opções não passa pelo cache
+ *   - Remoção pelo fim da lista até a ocupação caber no limite em bytes
+ * License: GNU GPL v3
+ */
+// ----------------------------------------------------------------------------
+
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DCache.hpp>
+
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1DStorage.h>
+
+// C++
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+FVMG_GRID1D_BUILDERS_OPEN
+
+namespace {
+
+std::uint64_t bits_of(core::Real x) noexcept {
+    return std::bit_cast<std::uint64_t>(x);
+}
+
+// Mistura do SplitMix64 (boa dispersão para chaves quase iguais)
+std::uint64_t mix(std::uint64_t z) noexcept {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+void combine(std::uint64_t& h, std::uint64_t v) noexcept {
+    h = mix(h + 0x9E3779B97F4A7C15ULL + v);
+}
+
+std::size_t cost_of(const api::Grid1D& g) noexcept {
+    return g.storage().bytes();
+}
+
+} // namespace
+
+static_assert(sizeof(core::Real) == sizeof(std::uint64_t),
+              "Grid1DCache compara reais pelos bits de 64");
+
+std::size_t Grid1DCache::KeyHash::operator()(const Key& k) const noexcept {
+    std::uint64_t h = 0;
+    combine(h, k.n);
+    combine(h, k.a_bits);
+    combine(h, k.b_bits);
+    combine(h, (std::uint64_t{k.dist} << 24) | (std::uint64_t{k.cent} << 16) |
+               (std::uint64_t{k.check} << 8) | std::uint64_t{k.has_options});
+    combine(h, k.w_lo_bits);
+    combine(h, k.w_hi_bits);
+    combine(h, (std::uint64_t{k.has_seed} << 8) | std::uint64_t{k.policy});
+    combine(h, k.seed);
+    combine(h, k.ratio_bits);
+    combine(h, k.first_width_bits);
+    combine(h, k.last_width_bits);
+    return static_cast<std::size_t>(h);
+}
+
+Grid1DCache::Key Grid1DCache::key_of(const Grid1DBuilder& b) noexcept {
+    Key k{};
+    k.n      = static_cast<std::uint64_t>(b.n_);
+    k.a_bits = bits_of(b.a_);
+    k.b_bits = bits_of(b.b_);
+    k.dist   = static_cast<std::uint8_t>(b.dist_);
+    k.cent   = static_cast<std::uint8_t>(b.cent_);
+    k.check  = b.check_;
+    // Só as opções da distribuição ativa; ExecPolicy fica fora (mesmos bits)
+    switch (b.dist_) {
+    case DistributionTag::Random1D:
+        if (b.random1d_options_) {
+            const auto& o = *b.random1d_options_;
+            k.has_options = true;
+            k.w_lo_bits   = bits_of(o.w_lo);
+            k.w_hi_bits   = bits_of(o.w_hi);
+            k.has_seed    = o.seed.has_value();
+            k.seed        = o.seed.value_or(0u);
+            k.policy      = static_cast<std::uint8_t>(o.policy);
+        }
+        break;
+    case DistributionTag::Geometric1D:
+        if (b.geometric1d_options_) {
+            k.has_options = true;
+            k.ratio_bits  = bits_of(b.geometric1d_options_->ratio);
+        }
+        break;
+    case DistributionTag::Vinokur1D:
+        if (b.vinokur1d_options_) {
+            k.has_options      = true;
+            k.first_width_bits = bits_of(b.vinokur1d_options_->first_width);
+            k.last_width_bits  = bits_of(b.vinokur1d_options_->last_width);
+        }
+        break;
+    default:
+        break;
+    }
+    return k;
+}
+
+Grid1DCache::Grid1DCache(std::size_t max_bytes)
+    : m_max_bytes(max_bytes)
+{}
+
+std::shared_ptr<const api::Grid1D> Grid1DCache::get(const Grid1DBuilder& b) {
+    // Monitor (std::function/densidade) fora da chave: sem cache
+    if (b.dist_ == DistributionTag::Equidistribution1D && b.equidistribution1d_options_) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ++m_stats.misses;
+        }
+        return std::make_shared<const api::Grid1D>(b.build());
+    }
+
+    const Key key = key_of(b);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (auto it = m_index.find(key); it != m_index.end()) {
+            m_lru.splice(m_lru.begin(), m_lru, it->second);
+            ++m_stats.hits;
+            return it->second->second;
+        }
+        ++m_stats.misses;
+    }
+
+    // Falta: constrói sem segurar o lock
+    Value grid = std::make_shared<const api::Grid1D>(b.build());
+    const std::size_t cost = cost_of(*grid);
+    if (cost > m_max_bytes) return grid;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (auto it = m_index.find(key); it != m_index.end()) {
+        // Outra thread inseriu a mesma chave enquanto construíamos
+        m_lru.splice(m_lru.begin(), m_lru, it->second);
+        return it->second->second;
+    }
+    m_lru.emplace_front(key, grid);
+    m_index.emplace(key, m_lru.begin());
+    m_stats.bytes += cost;
+    ++m_stats.entries;
+    evict_to_fit_locked();
+    return grid;
+}
+
+void Grid1DCache::evict_to_fit_locked() {
+    while (m_stats.bytes > m_max_bytes && !m_lru.empty()) {
+        auto& [key, grid] = m_lru.back();
+        m_stats.bytes -= cost_of(*grid);
+        --m_stats.entries;
+        ++m_stats.evictions;
+        m_index.erase(key);
+        m_lru.pop_back();
+    }
+}
+
+void Grid1DCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_index.clear();
+    m_lru.clear();
+    m_stats.bytes   = 0;
+    m_stats.entries = 0;
+}
+
+Grid1DCache::Stats Grid1DCache::stats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+FVMG_GRID1D_BUILDERS_CLOSE
@@ -1,7 +1,7 @@
 // ----------------------------------------------------------------------------
 // File: Grid1DDistributionRegistry.cpp
 // Author: FVMGridMaker Team
-// Version: 2.0
+// Version: 2.1
 // Date: 2025-10-26
 // Description: Implementação do registro de geradores de distribuições 1D para
 //              o Grid1D. Não realiza auto-registro de padrões — cada padrão
@@ -15,8 +15,12 @@
  */
 
 #include <FVMGridMaker/Core/namespace.h>
+#include <FVMGridMaker/ErrorHandling/ErrorHandling.h>
+#include <FVMGridMaker/ErrorHandling/GridErrors.h>
 #include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DDistributionRegistry.hpp>
 
+#include <mutex>        // std::unique_lock
+#include <shared_mutex> // std::shared_lock
 #include <utility>      // std::move
 #include <string>
 #include <string_view>
@@ -51,6 +55,8 @@ Grid1DDistributionRegistry& Grid1DDistributionRegistry::instance() {
  * @param entry Estrutura com os geradores *faces_fn* e *centers_fn*.
  */
 void Grid1DDistributionRegistry::registerDistribution(std::string name, Entry entry) {
+    std::unique_lock lock(mutex_);
+    ensureNotFrozen("Grid1DDistributionRegistry::registerDistribution");
     names_[std::move(name)] = std::move(entry);
 }
 
@@ -67,6 +73,8 @@ void Grid1DDistributionRegistry::registerDistribution(
     Entry entry,
     FVMGridMaker::grid::DistributionTag tag)
 {
+    std::unique_lock lock(mutex_);
+    ensureNotFrozen("Grid1DDistributionRegistry::registerDistribution");
     // Associa o tag ao nome (guarda a cópia do nome antes de movê-lo)
     tag_to_name_[static_cast<int>(tag)] = name;
     // Registra a entry por nome
@@ -83,6 +91,7 @@ void Grid1DDistributionRegistry::registerDistribution(
  */
 std::optional<Grid1DDistributionRegistry::Entry>
 Grid1DDistributionRegistry::find(std::string_view name) const {
+    std::shared_lock lock(mutex_);
     auto it = names_.find(std::string{name});
     if (it == names_.end()) {
         return std::nullopt;
@@ -97,6 +106,7 @@ Grid1DDistributionRegistry::find(std::string_view name) const {
  */
 std::optional<std::string>
 Grid1DDistributionRegistry::nameForTag(FVMGridMaker::grid::DistributionTag tag) const {
+    std::shared_lock lock(mutex_);
     auto it = tag_to_name_.find(static_cast<int>(tag));
     if (it == tag_to_name_.end()) {
         return std::nullopt;
@@ -111,6 +121,9 @@ Grid1DDistributionRegistry::nameForTag(FVMGridMaker::grid::DistributionTag tag)
  */
 std::optional<Grid1DDistributionRegistry::Entry>
 Grid1DDistributionRegistry::findByTag(FVMGridMaker::grid::DistributionTag tag) const {
+    if (const Entry* e = entryForTag(tag)) {
+        return *e;
+    }
     auto name_opt = nameForTag(tag);
     if (!name_opt) {
         return std::nullopt;
@@ -118,6 +131,42 @@ Grid1DDistributionRegistry::findByTag(FVMGridMaker::grid::DistributionTag tag) c
     return find(*name_opt);
 }
 
+// -----------------------------------------------------------------------------
+// Congelamento
+// -----------------------------------------------------------------------------
+/**
+ * @brief Congela o registro e monta a tabela densa `tag -> Entry*`.
+ *
+ * @details Chamadas repetidas não têm efeito. A publicação usa
+ *          `memory_order_release`; `entryForTag` lê com `acquire`.
+ */
+void Grid1DDistributionRegistry::freeze() {
+    std::unique_lock lock(mutex_);
+    if (frozen_.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    by_tag_.fill(nullptr);
+    for (const auto& [tag, name] : tag_to_name_) {
+        const auto idx = static_cast<std::size_t>(tag);
+        if (idx >= by_tag_.size()) continue;
+        auto it = names_.find(name);
+        if (it != names_.end()) {
+            by_tag_[idx] = &it->second;
+        }
+    }
+
+    frozen_.store(true, std::memory_order_release);
+}
+
+void Grid1DDistributionRegistry::ensureNotFrozen(std::string_view where) const {
+    if (frozen_.load(std::memory_order_relaxed)) {
+        FVMG_ERROR(error::GridErr::RegistryFrozen, {
+            {"where", std::string{where}}
+        });
+    }
+}
+
 BUILDERS_NAMESPACE_CLOSE
 GRID1D_NAMESPACE_CLOSE
 GRID_NAMESPACE_CLOSE
@@ -0,0 +1,104 @@
+// ----------------------------------------------------------------------------
+/* File: Grid1DStream.cpp
+ * Author: FVMGridMaker Team
+ * Version: 1.1
+ * Date: 2025-10-27
+ * Description: Implementação do Grid1DStream.
+ *   - Janela deslizante sobre a sequência base (faces ou centros) com uma
+ *     célula de contexto de cada lado do bloco
+ *   - Fechamento do bloco com o mesmo ClosureKernel1D do build(); as
+ *     distâncias dC nas bordas do bloco são corrigidas com os vizinhos da
+ *     janela (mesmas expressões do kernel → mesmos bits)
+ * License: GNU GPL v3
+ */
+// ----------------------------------------------------------------------------
+
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DStream.hpp>
+
+// Kernel fundido de fechamento
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Centering/ClosureKernel1D.hpp>
+
+// C++
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+FVMG_GRID1D_BUILDERS_OPEN
+
+using core::Index;
+using core::Real;
+using grid::CenteringTag;
+
+Grid1DStream::Grid1DStream(Index n, Real a, Real b, CenteringTag centering,
+                           Index chunk, core::ExecPolicy exec, BaseFn base)
+    : m_n(n), m_a(a), m_b(b), m_cent(centering), m_block(std::min(chunk, n)),
+      m_exec(exec), m_base(std::move(base)),
+      m_win(m_block + 3u),
+      m_out(m_block + 1u),
+      m_dF(m_block),
+      m_dC(m_block + 1u)
+{
+    // Bloco vazio só na malha vazia: next() nunca devolveria n = 0
+    assert((m_block > 0 || m_n == 0) && "Grid1DStream: chunk must be > 0");
+}
+
+bool Grid1DStream::next() {
+    if (m_next >= m_n) return false;
+
+    namespace centering = FVMGridMaker::grid::grid1d::patterns::centering;
+    const bool        faces = (m_cent == CenteringTag::FaceCentered);
+    const std::size_t N     = m_n;
+    const std::size_t i0    = m_next;
+    const std::size_t n     = std::min<std::size_t>(m_block, N - i0);
+
+    // 1) Janela da base: [i0-1, i0+n+1] (faces) ou [i0-1, i0+n] (centros),
+    //    limitada à sequência; descarta o que ficou antes e gera o resto.
+    const std::size_t M  = faces ? N + 1u : N;
+    const std::size_t ws = (i0 > 0) ? i0 - 1u : 0u;
+    const std::size_t we = std::min(i0 + n + (faces ? 1u : 0u), M - 1u);
+
+    const std::size_t drop = ws - m_win_lo;
+    if (drop > 0) {
+        std::copy(m_win.begin() + static_cast<std::ptrdiff_t>(drop),
+                  m_win.begin() + static_cast<std::ptrdiff_t>(m_win_n), m_win.begin());
+        m_win_n -= drop;
+    }
+    m_win_lo = ws;
+    const std::size_t have = m_win_lo + m_win_n;
+    m_base(std::span<Real>(m_win.data() + m_win_n, we + 1u - have));
+    m_win_n = we + 1u - ws;
+
+    const Real* w  = m_win.data() + (i0 - ws);   // base[i0]
+    const bool  lb = (i0 > 0);                    // há célula à esquerda
+    const bool  rb = (i0 + n < N);                // há célula à direita
+
+    std::span<Real> dF(m_dF.data(), n);
+    std::span<Real> dC(m_dC.data(), n + 1u);
+
+    // 2) Fechamento do bloco + dC de borda a partir dos vizinhos
+    if (faces) {
+        std::span<const Real> xf(w, n + 1u);
+        std::span<Real>       xc(m_out.data(), n);
+        centering::close_from_faces(xf, xc, dF, dC, m_exec);
+        if (lb) dC[0] = xc[0] - Real(0.5) * (w[-1] + w[0]);
+        if (rb) dC[n] = Real(0.5) * (w[n] + w[n + 1u]) - xc[n - 1u];
+        m_chunk = api::Grid1DView(xf, xc, dF, dC);
+    } else {
+        std::span<const Real> xc(w, n);
+        std::span<Real>       xf(m_out.data(), n + 1u);
+        const Real xL = lb ? Real(0.5) * (w[-1] + w[0])      : m_a;
+        const Real xR = rb ? Real(0.5) * (w[n - 1u] + w[n]) : m_b;
+        centering::close_from_centers(xc, xL, xR, xf, dF, dC, m_exec);
+        if (lb) dC[0] = w[0] - w[-1];
+        if (rb) dC[n] = w[n] - w[n - 1u];
+        m_chunk = api::Grid1DView(xf, xc, dF, dC);
+    }
+
+    m_first = i0;
+    m_next  = i0 + n;
+    return true;
+}
+
+FVMG_GRID1D_BUILDERS_CLOSE
@@ -0,0 +1,324 @@
+// ----------------------------------------------------------------------------
+/* File: Grid1DFile.cpp
+ * Author: FVMGridMaker Team
+ * Version: 1.3
+ * Date: 2025-10-27
+ * Description: Implementação do formato binário de malhas 1D.
+ *   - write_grid1d(): cabeçalho + quatro seções alinhadas, escrita sequencial
+ *     em path.tmp seguida de rename() sobre o destino
+ *   - MappedGrid1D::open(): mmap somente leitura (POSIX, O_CLOEXEC); em
+ *     plataformas sem mmap, leitura para um buffer alinhado (mesma API, sem
+ *     compartilhamento); tags do cabeçalho fora da faixa são rejeitados
+ *   - grid1d_checksum(): hash por blocos fixos via core::deterministic_reduce
+ *   - Erros integram com ErrorHandling (FileErr)
+ * License: GNU GPL v3
+ */
+// ----------------------------------------------------------------------------
+
+#include <FVMGridMaker/Grid/Grid1D/IO/Grid1DFile.hpp>
+
+#include <FVMGridMaker/Core/ParallelFor.hpp>
+#include <FVMGridMaker/ErrorHandling/ErrorHandling.h>
+#include <FVMGridMaker/ErrorHandling/FileErrors.h>
+
+// C++
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <span>
+#include <string>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+  #define FVMG_HAVE_MMAP 1
+#endif
+
+FVMG_GRID1D_IO_OPEN
+
+using core::Real;
+
+namespace {
+
+constexpr char kMagic[8] = {'F', 'V', 'M', 'G', '1', 'D', '\0', '\0'};
+
+// ----------------------------------------------------------------------------
+// Hash (64 bits, não criptográfico): 4 lanes multiplicativas por bloco,
+// blocos combinados em ordem — independente da ExecPolicy.
+// ----------------------------------------------------------------------------
+constexpr std::uint64_t kPrime1 = 0x9E3779B185EBCA87ull;
+constexpr std::uint64_t kPrime2 = 0xC2B2AE3D27D4EB4Full;
+
+constexpr std::uint64_t rotl(std::uint64_t x, int r) noexcept {
+    return (x << r) | (x >> (64 - r));
+}
+
+constexpr std::uint64_t fmix(std::uint64_t h) noexcept {
+    h ^= h >> 33; h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33; h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+std::uint64_t hash_bytes(const unsigned char* p, std::size_t len) noexcept {
+    std::array<std::uint64_t, 4> lane{kPrime1, kPrime2, ~kPrime1, ~kPrime2};
+    const std::size_t words = len / 8u;
+    std::size_t w = 0;
+    for (; w + 4u <= words; w += 4u) {
+        for (std::size_t k = 0; k < 4u; ++k) {
+            std::uint64_t v;
+            std::memcpy(&v, p + 8u * (w + k), 8u);
+            lane[k] = rotl(lane[k] ^ (v * kPrime2), 31) * kPrime1;
+        }
+    }
+    std::uint64_t h = fmix(lane[0]) ^ rotl(fmix(lane[1]), 17)
+                    ^ rotl(fmix(lane[2]), 34) ^ rotl(fmix(lane[3]), 51);
+    for (; w < words; ++w) {
+        std::uint64_t v;
+        std::memcpy(&v, p + 8u * w, 8u);
+        h = rotl(h ^ (v * kPrime2), 27) * kPrime1;
+    }
+    for (std::size_t i = 8u * words; i < len; ++i) {
+        h = rotl(h ^ (std::uint64_t(p[i]) * kPrime1), 11) * kPrime2;
+    }
+    return fmix(h ^ len);
+}
+
+std::uint64_t hash_array(std::span<const Real> v, core::ExecPolicy policy) {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(v.data());
+    const std::size_t len = v.size_bytes();
+    return core::deterministic_reduce(
+        len, policy, std::uint64_t(len),
+        [bytes](std::size_t b, std::size_t e) { return hash_bytes(bytes + b, e - b); },
+        [](std::uint64_t acc, std::uint64_t h) { return fmix(rotl(acc, 23) ^ h) * kPrime1; },
+        std::size_t(1) << 16);
+}
+
+std::size_t padded_bytes(std::size_t count) noexcept {
+    const std::size_t b = count * sizeof(Real);
+    return (b + kGrid1DFileAlignment - 1u) / kGrid1DFileAlignment * kGrid1DFileAlignment;
+}
+
+void format_error(const std::string& path, const char* what) {
+    FVMG_ERROR(error::FileErr::InvalidFormat, {{"path", path}, {"what", what}});
+}
+
+} // namespace
+
+// ----------------------------------------------------------------------------
+// grid1d_checksum()
+// ----------------------------------------------------------------------------
+std::uint64_t grid1d_checksum(const api::Grid1DView& g, core::ExecPolicy policy) {
+    std::uint64_t h = fmix(static_cast<std::uint64_t>(g.nVolumes()) ^ kPrime2);
+    for (const auto s : {g.faces(), g.centers(), g.deltasFaces(), g.deltasCenters()}) {
+        h = fmix(rotl(h, 29) ^ hash_array(s, policy)) * kPrime1;
+    }
+    return h;
+}
+
+// ----------------------------------------------------------------------------
+// write_grid1d()
+// ----------------------------------------------------------------------------
+void write_grid1d(const std::string& path, const api::Grid1DView& g,
+                  const Grid1DFileMeta& meta) {
+    const std::size_t N = static_cast<std::size_t>(g.nVolumes());
+    const std::size_t count[4] = {N + (N ? 1u : 0u), N, N, N + (N ? 1u : 0u)};
+
+    Grid1DFileHeader h{};
+    std::memcpy(h.magic, kMagic, sizeof kMagic);
+    h.version      = kGrid1DFileVersion;
+    h.header_bytes = sizeof(Grid1DFileHeader);
+    h.real_bytes   = sizeof(Real);
+    h.endian       = kGrid1DFileEndian;
+    h.n            = N;
+    h.a            = meta.a;
+    h.b            = meta.b;
+    h.distribution = static_cast<std::uint8_t>(meta.distribution);
+    h.centering    = static_cast<std::uint8_t>(meta.centering);
+    h.seed         = meta.seed;
+    std::uint64_t off = (sizeof(Grid1DFileHeader) + kGrid1DFileAlignment - 1u)
+                      / kGrid1DFileAlignment * kGrid1DFileAlignment;
+    for (std::size_t k = 0; k < 4u; ++k) {
+        h.offset[k] = off;
+        off += padded_bytes(count[k]);
+    }
+    h.checksum = grid1d_checksum(g);
+
+    // Escreve em path.tmp e troca por rename(): leitores que mapeiam
+    // @p path veem o arquivo antigo ou o novo, nunca um parcial.
+    const std::string tmp = path + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            FVMG_ERROR(error::FileErr::WriteError, {{"path", tmp}});
+            return;
+        }
+
+        static constexpr char zeros[kGrid1DFileAlignment] = {};
+        out.write(reinterpret_cast<const char*>(&h), sizeof h);
+        out.write(zeros, static_cast<std::streamsize>(h.offset[0] - sizeof h));
+
+        const std::span<const Real> arrays[4] = {g.faces(), g.centers(),
+                                                 g.deltasFaces(), g.deltasCenters()};
+        for (std::size_t k = 0; k < 4u; ++k) {
+            const auto& a = arrays[k];
+            out.write(reinterpret_cast<const char*>(a.data()),
+                      static_cast<std::streamsize>(a.size_bytes()));
+            out.write(zeros, static_cast<std::streamsize>(padded_bytes(count[k]) - a.size_bytes()));
+        }
+
+        out.close();
+        if (!out) {
+            std::remove(tmp.c_str());
+            FVMG_ERROR(error::FileErr::WriteError, {{"path", tmp}});
+            return;
+        }
+    }
+
+    if (std::rename(tmp.c_str(), path.c_str()) != 0) {
+        std::remove(tmp.c_str());
+        FVMG_ERROR(error::FileErr::WriteError, {{"path", path}});
+    }
+}
+
+// ----------------------------------------------------------------------------
+// MappedGrid1D
+// ----------------------------------------------------------------------------
+MappedGrid1D::MappedGrid1D(MappedGrid1D&& other) noexcept
+    : m_addr (std::exchange(other.m_addr, nullptr)),
+      m_bytes(std::exchange(other.m_bytes, 0u)),
+      m_view (std::exchange(other.m_view, {})),
+      m_meta (other.m_meta)
+{}
+
+MappedGrid1D& MappedGrid1D::operator=(MappedGrid1D&& other) noexcept {
+    if (this != &other) {
+        release();
+        m_addr  = std::exchange(other.m_addr, nullptr);
+        m_bytes = std::exchange(other.m_bytes, 0u);
+        m_view  = std::exchange(other.m_view, {});
+        m_meta  = other.m_meta;
+    }
+    return *this;
+}
+
+MappedGrid1D::~MappedGrid1D() { release(); }
+
+void MappedGrid1D::release() noexcept {
+    if (m_addr == nullptr) return;
+#if defined(FVMG_HAVE_MMAP)
+    ::munmap(m_addr, m_bytes);
+#else
+    ::operator delete(m_addr, std::align_val_t{kGrid1DFileAlignment});
+#endif
+    m_addr  = nullptr;
+    m_bytes = 0;
+    m_view  = {};
+}
+
+const Grid1DFileHeader& MappedGrid1D::header() const noexcept {
+    static const Grid1DFileHeader empty{};
+    return m_addr ? *static_cast<const Grid1DFileHeader*>(m_addr) : empty;
+}
+
+bool MappedGrid1D::verify(core::ExecPolicy policy) const {
+    return is_open() && grid1d_checksum(m_view, policy) == header().checksum;
+}
+
+MappedGrid1D MappedGrid1D::open(const std::string& path, bool verify) {
+    MappedGrid1D m;
+
+#if defined(FVMG_HAVE_MMAP)
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        if (errno == EACCES) FVMG_ERROR(error::FileErr::AccessDenied, {{"path", path}});
+        else                 FVMG_ERROR(error::FileErr::FileNotFound, {{"path", path}});
+        return m;
+    }
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(Grid1DFileHeader))) {
+        ::close(fd);
+        format_error(path, "file smaller than header");
+        return m;
+    }
+    const std::size_t bytes = static_cast<std::size_t>(st.st_size);
+    void* addr = ::mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);  // o mapeamento permanece válido
+    if (addr == MAP_FAILED) {
+        FVMG_ERROR(error::FileErr::ReadError, {{"path", path}});
+        return m;
+    }
+#else
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        FVMG_ERROR(error::FileErr::FileNotFound, {{"path", path}});
+        return m;
+    }
+    const std::size_t bytes = static_cast<std::size_t>(in.tellg());
+    if (bytes < sizeof(Grid1DFileHeader)) {
+        format_error(path, "file smaller than header");
+        return m;
+    }
+    void* addr = ::operator new(bytes, std::align_val_t{kGrid1DFileAlignment});
+    in.seekg(0);
+    if (!in.read(static_cast<char*>(addr), static_cast<std::streamsize>(bytes))) {
+        ::operator delete(addr, std::align_val_t{kGrid1DFileAlignment});
+        FVMG_ERROR(error::FileErr::ReadError, {{"path", path}});
+        return m;
+    }
+#endif
+    m.m_addr  = addr;
+    m.m_bytes = bytes;
+
+    // --- Cabeçalho -----------------------------------------------------------
+    const auto& h = m.header();
+    const char* why = nullptr;
+    if      (std::memcmp(h.magic, kMagic, sizeof kMagic) != 0) why = "bad magic";
+    else if (h.version != kGrid1DFileVersion)                  why = "unsupported version";
+    else if (h.header_bytes != sizeof(Grid1DFileHeader))       why = "unexpected header size";
+    else if (h.endian != kGrid1DFileEndian)                    why = "byte order mismatch";
+    else if (h.real_bytes != sizeof(Real))                     why = "Real size mismatch";
+    else if (h.distribution >= static_cast<std::uint8_t>(DistributionTag::Count))
+                                                               why = "unknown distribution";
+    else if (h.centering >= static_cast<std::uint8_t>(CenteringTag::Count))
+                                                               why = "unknown centering";
+
+    const std::size_t N = static_cast<std::size_t>(h.n);
+    const std::size_t count[4] = {N + (N ? 1u : 0u), N, N, N + (N ? 1u : 0u)};
+    for (std::size_t k = 0; why == nullptr && k < 4u; ++k) {
+        if (h.offset[k] % kGrid1DFileAlignment != 0u)                 why = "misaligned section";
+        else if (h.offset[k] > bytes ||
+                 count[k] > (bytes - h.offset[k]) / sizeof(Real))     why = "truncated section";
+    }
+    if (why != nullptr) {
+        m.release();
+        format_error(path, why);
+        return m;
+    }
+
+    const auto* base = static_cast<const unsigned char*>(addr);
+    auto section = [base, &h, &count](std::size_t k) {
+        return std::span<const Real>(reinterpret_cast<const Real*>(base + h.offset[k]), count[k]);
+    };
+    m.m_view = api::Grid1DView(section(0), section(1), section(2), section(3));
+    m.m_meta.distribution = static_cast<DistributionTag>(h.distribution);
+    m.m_meta.centering    = static_cast<CenteringTag>(h.centering);
+    m.m_meta.a            = h.a;
+    m.m_meta.b            = h.b;
+    m.m_meta.seed         = h.seed;
+
+    if (verify && !m.verify()) {
+        m.release();
+        FVMG_ERROR(error::FileErr::ChecksumMismatch, {{"path", path}});
+    }
+    return m;
+}
+
+FVMG_GRID1D_IO_CLOSE
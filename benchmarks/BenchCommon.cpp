@@ -0,0 +1,63 @@
+// ----------------------------------------------------------------------------
+// File: BenchCommon.cpp
+// Author: FVMGridMaker Team
+// Version: 1.1
+// Date: 2025-10-27
+// Description: Registro das distribuições (o core não se auto-registra) e
+//              cache de malhas de entrada do FVMGridMaker_bench.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#include "BenchCommon.hpp"
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBuilder.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DDistributionRegistry.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/RegisterBuiltinDistributions1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Random1D.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <optional>
+
+namespace fvmg_bench {
+
+namespace core = FVMGridMaker::core;
+namespace dist = FVMGridMaker::grid::grid1d::patterns::distribution;
+using FVMGridMaker::grid::CenteringTag;
+using FVMGridMaker::grid::DistributionTag;
+using FVMGridMaker::grid::grid1d::api::Grid1D;
+using FVMGridMaker::grid::grid1d::builders::Grid1DBuilder;
+using FVMGridMaker::grid::grid1d::builders::Grid1DDistributionRegistry;
+using FVMGridMaker::grid::grid1d::builders::registerBuiltinDistributions;
+
+void register_distributions() {
+    auto& reg = Grid1DDistributionRegistry::instance();
+    if (reg.isFrozen()) return;
+    registerBuiltinDistributions();
+    reg.freeze();
+}
+
+const Grid1D& cached_grid(core::Index n, DistributionTag tag) {
+    static std::optional<Grid1D> grid;
+    static core::Index           grid_n   = 0;
+    static DistributionTag       grid_tag = DistributionTag::Count;
+
+    if (!grid || grid_n != n || grid_tag != tag) {
+        grid.reset(); // libera a malha anterior antes de alocar a nova
+        dist::Random1D::Options opt{};
+        opt.seed = 12345u;
+        grid = Grid1DBuilder{}.setN(n).setDomain(0.0, 1.0)
+                   .setDistribution(tag)
+                   .setCentering(CenteringTag::FaceCentered)
+                   .setOption(opt)
+                   .build();
+        grid_n   = n;
+        grid_tag = tag;
+    }
+    return *grid;
+}
+
+} // namespace fvmg_bench
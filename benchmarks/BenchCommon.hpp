@@ -0,0 +1,50 @@
+// ----------------------------------------------------------------------------
+// File: BenchCommon.hpp
+// Author: FVMGridMaker Team
+// Version: 1.1
+// Date: 2025-10-27
+// Description: Utilitários compartilhados pelo FVMGridMaker_bench: varredura
+//              de N, registro das distribuições e malhas de entrada em cache.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#pragma once
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#ifndef FVMG_BENCH_MAX_N
+  #define FVMG_BENCH_MAX_N 100000000
+#endif
+
+namespace fvmg_bench {
+
+/// N = 10, 100, ..., FVMG_BENCH_MAX_N (arg 0 do benchmark).
+inline void sweep_n(benchmark::internal::Benchmark* b) {
+    b->RangeMultiplier(10)->Range(10, static_cast<std::int64_t>(FVMG_BENCH_MAX_N));
+    b->Unit(benchmark::kMicrosecond);
+}
+
+/// Registra os padrões embutidos no registro global e o congela.
+void register_distributions();
+
+/**
+ * @brief Malha de entrada (N volumes) para benchmarks de estatísticas e
+ *        validação. Mantém apenas a última malha pedida (N até 1e8 ocupa
+ *        ~3 GiB; não acumular tamanhos).
+ */
+const FVMGridMaker::grid::grid1d::api::Grid1D&
+cached_grid(FVMGridMaker::core::Index n,
+            FVMGridMaker::grid::DistributionTag tag);
+
+} // namespace fvmg_bench
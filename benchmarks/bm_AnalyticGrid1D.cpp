@@ -0,0 +1,66 @@
+// ----------------------------------------------------------------------------
+// File: bm_AnalyticGrid1D.cpp
+// Author: FVMGridMaker Team
+// Version: 1.0
+// Date: 2025-10-27
+// Description: Benchmarks da malha analítica preguiçosa (UniformGrid1D):
+//              laço típico de solver sobre valores calculados sob demanda
+//              x sobre os arrays armazenados do Grid1D, e materialização.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#include "BenchCommon.hpp"
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Grid/Grid1D/API/AnalyticGrid1D.h>
+
+namespace {
+
+namespace core = FVMGridMaker::core;
+using FVMGridMaker::grid::DistributionTag;
+using FVMGridMaker::grid::grid1d::api::UniformGrid1D;
+
+// Laço de solver: Σ xc[i]·dF[i] (acessores escalares)
+template <class G>
+core::Real sweep(const G& g) {
+    core::Real acc = 0;
+    const core::Index n = g.nVolumes();
+    for (core::Index i = 0; i < n; ++i) acc += g.center(i) * g.deltaFace(i);
+    return acc;
+}
+
+void BM_Sweep_Stored(benchmark::State& state) {
+    const auto& g = fvmg_bench::cached_grid(static_cast<core::Index>(state.range(0)),
+                                            DistributionTag::Uniform1D);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sweep(g));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Sweep_Analytic(benchmark::State& state) {
+    const UniformGrid1D g(static_cast<core::Index>(state.range(0)), 0.0, 1.0);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sweep(g));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <core::ExecPolicy Exec>
+void BM_Analytic_Materialize(benchmark::State& state) {
+    const UniformGrid1D g(static_cast<core::Index>(state.range(0)), 0.0, 1.0);
+    for (auto _ : state) {
+        auto m = g.materialize(Exec);
+        benchmark::DoNotOptimize(m.faces().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_Sweep_Stored)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Sweep_Analytic)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Analytic_Materialize<core::ExecPolicy::Serial>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Analytic_Materialize<core::ExecPolicy::Parallel>)->Apply(fvmg_bench::sweep_n)->UseRealTime();
@@ -0,0 +1,84 @@
+// ----------------------------------------------------------------------------
+// File: bm_Equidistribution1D.cpp
+// Author: FVMGridMaker Team
+// Version: 1.0
+// Date: 2025-10-27
+// Description: Benchmarks da distribuição Equidistribution1D: integral
+//              acumulada + inversa por blocos (uma busca binária por bloco e
+//              fusão linear) x uma busca binária por face.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#include "BenchCommon.hpp"
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Equidistribution1D.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+namespace core = FVMGridMaker::core;
+using FVMGridMaker::grid::grid1d::patterns::distribution::Equidistribution1D;
+
+// Densidade amostrada com M = N + 1 pontos uniformes (pico em x = 0.3)
+std::vector<core::Real> sampled_density(std::size_t m) {
+    std::vector<core::Real> w(m);
+    for (std::size_t k = 0; k < m; ++k) {
+        const core::Real x = static_cast<core::Real>(k) / static_cast<core::Real>(m - 1u);
+        w[k] = 1.0 + 100.0 * std::exp(-400.0 * (x - 0.3) * (x - 0.3));
+    }
+    return w;
+}
+
+template <core::ExecPolicy Exec>
+void BM_Equidistribution1D_Kernel(benchmark::State& state) {
+    const auto n = static_cast<core::Index>(state.range(0));
+    std::vector<core::Real> xf(n + 1u);
+    Equidistribution1D::Options opt{};
+    opt.density = sampled_density(n + 1u);
+    opt.exec    = Exec;
+    for (auto _ : state) {
+        Equidistribution1D::faces_into(n, 0.0, 1.0, xf, &opt);
+        benchmark::DoNotOptimize(xf.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Referência: soma serial + std::upper_bound por face
+void BM_Equidistribution1D_BinarySearch(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto w = sampled_density(n + 1u);
+    const core::Real h = 1.0 / static_cast<core::Real>(n);
+    std::vector<core::Real> W(n + 1u), xf(n + 1u);
+    for (auto _ : state) {
+        W[0] = 0.0;
+        for (std::size_t k = 0; k < n; ++k) W[k + 1] = W[k] + 0.5 * (w[k] + w[k + 1]) * h;
+        const core::Real T = W[n];
+        for (std::size_t i = 0; i <= n; ++i) {
+            const core::Real tau = T * static_cast<core::Real>(i) / static_cast<core::Real>(n);
+            auto k = static_cast<std::size_t>(std::upper_bound(W.begin(), W.end(), tau) - W.begin());
+            k = std::min(k == 0u ? std::size_t(0) : k - 1u, n - 1u);
+            const core::Real R   = tau - W[k];
+            const core::Real g   = (w[k + 1] - w[k]) / h;
+            const core::Real den = w[k] + std::sqrt(std::max(w[k] * w[k] + 2.0 * g * R, 0.0));
+            xf[i] = static_cast<core::Real>(k) * h + std::min(2.0 * R / den, h);
+        }
+        benchmark::DoNotOptimize(xf.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_Equidistribution1D_Kernel<core::ExecPolicy::Serial>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Equidistribution1D_Kernel<core::ExecPolicy::Parallel>)->Apply(fvmg_bench::sweep_n)->UseRealTime();
+BENCHMARK(BM_Equidistribution1D_BinarySearch)->Apply(fvmg_bench::sweep_n);
@@ -0,0 +1,88 @@
+// ----------------------------------------------------------------------------
+// File: bm_Geometric1D.cpp
+// Author: FVMGridMaker Team
+// Version: 1.1
+// Date: 2025-10-27
+// Description: Benchmarks da distribuição Geometric1D: kernel em blocos
+//              (tabelas + um expm1 por bloco) x std::pow por face x
+//              acumulação serial x_{i+1} = x_i + d·r^i.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#include "BenchCommon.hpp"
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Geometric1D.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+namespace core = FVMGridMaker::core;
+using FVMGridMaker::grid::grid1d::patterns::distribution::Geometric1D;
+
+// r^N = e^10 para todo N: larguras em 4 ordens de grandeza e a menor
+// célula acima da resolução de [0, 1] até N = 1e8
+core::Real ratio_for(std::size_t n) {
+    return std::exp(10.0 / static_cast<core::Real>(n));
+}
+
+template <core::ExecPolicy Exec>
+void BM_Geometric1D_Kernel(benchmark::State& state) {
+    const auto n = static_cast<core::Index>(state.range(0));
+    std::vector<core::Real> xf(n + 1u);
+    Geometric1D::Options opt{};
+    opt.ratio = ratio_for(static_cast<std::size_t>(n));
+    opt.exec  = Exec;
+    for (auto _ : state) {
+        Geometric1D::faces_into(n, 0.0, 1.0, xf, &opt);
+        benchmark::DoNotOptimize(xf.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Forma fechada ingênua: uma std::pow por face
+void BM_Geometric1D_Pow(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    std::vector<core::Real> xf(n + 1u);
+    const core::Real r = ratio_for(n);
+    for (auto _ : state) {
+        const core::Real s = 1.0 / (std::pow(r, static_cast<core::Real>(n)) - 1.0);
+        for (std::size_t i = 0; i <= n; ++i) {
+            xf[i] = (std::pow(r, static_cast<core::Real>(i)) - 1.0) * s;
+        }
+        benchmark::DoNotOptimize(xf.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Acumulação serial (dependência entre iterações; erro cresce com N)
+void BM_Geometric1D_Serial(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    std::vector<core::Real> xf(n + 1u);
+    const core::Real r = ratio_for(n);
+    for (auto _ : state) {
+        core::Real d = (r - 1.0) / (std::pow(r, static_cast<core::Real>(n)) - 1.0);
+        xf[0] = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            xf[i + 1] = xf[i] + d;
+            d *= r;
+        }
+        benchmark::DoNotOptimize(xf.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_Geometric1D_Kernel<core::ExecPolicy::Serial>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Geometric1D_Kernel<core::ExecPolicy::Parallel>)->Apply(fvmg_bench::sweep_n)->UseRealTime();
+BENCHMARK(BM_Geometric1D_Pow)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Geometric1D_Serial)->Apply(fvmg_bench::sweep_n);
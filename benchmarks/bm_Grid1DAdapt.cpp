@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// File: bm_Grid1DAdapt.cpp
+// Author: FVMGridMaker Team
+// Version: 1.0
+// Date: 2025-10-27
+// Description: Benchmarks de refine/coarsen incrementais (1% das células)
+//              x reconstrução completa pelo Grid1DBuilder no novo N.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#include "BenchCommon.hpp"
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBuilder.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Utils/Grid1DAdapt.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+namespace core  = FVMGridMaker::core;
+namespace adapt = FVMGridMaker::grid::grid1d::utils::adapt;
+using FVMGridMaker::grid::CenteringTag;
+using FVMGridMaker::grid::DistributionTag;
+using FVMGridMaker::grid::grid1d::api::Grid1D;
+using FVMGridMaker::grid::grid1d::builders::Grid1DBuilder;
+
+Grid1D uniform(core::Index n) {
+    Grid1DBuilder b;
+    b.setN(n).setDomain(0.0, 1.0).setDistribution(DistributionTag::Uniform1D)
+     .setCentering(CenteringTag::FaceCentered);
+    return b.build();
+}
+
+// Uma célula a cada 100 (pelo menos uma)
+std::vector<core::Index> every_100(core::Index n, core::Index span) {
+    std::vector<core::Index> v;
+    for (core::Index i = 0; i + span <= n; i += 100) v.push_back(i);
+    return v;
+}
+
+template <core::ExecPolicy Exec>
+void BM_Grid1DAdapt_Refine(benchmark::State& state) {
+    const auto   n     = static_cast<core::Index>(state.range(0));
+    const Grid1D g     = uniform(n);
+    const auto   cells = every_100(n, 1);
+    for (auto _ : state) {
+        auto r = adapt::refine(g, cells, 2, Exec);
+        benchmark::DoNotOptimize(r.grid.faces().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <core::ExecPolicy Exec>
+void BM_Grid1DAdapt_Coarsen(benchmark::State& state) {
+    const auto   n      = static_cast<core::Index>(state.range(0));
+    const Grid1D g      = uniform(n);
+    const auto   starts = every_100(n, 2);
+    for (auto _ : state) {
+        auto c = adapt::coarsen(g, starts, 2, Exec);
+        benchmark::DoNotOptimize(c.grid.faces().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Referência: malha inteira refeita pelo builder com o N refinado
+void BM_Grid1DAdapt_FullRebuild(benchmark::State& state) {
+    const auto n  = static_cast<core::Index>(state.range(0));
+    const auto n2 = n + every_100(n, 1).size();
+    Grid1DBuilder b;
+    b.setN(n2).setDomain(0.0, 1.0).setDistribution(DistributionTag::Uniform1D)
+     .setCentering(CenteringTag::FaceCentered).setExecPolicy(core::ExecPolicy::Serial);
+    for (auto _ : state) {
+        auto r = b.build();
+        benchmark::DoNotOptimize(r.faces().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_Grid1DAdapt_Refine<core::ExecPolicy::Serial>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Grid1DAdapt_Refine<core::ExecPolicy::Parallel>)->Apply(fvmg_bench::sweep_n)->UseRealTime();
+BENCHMARK(BM_Grid1DAdapt_Coarsen<core::ExecPolicy::Serial>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Grid1DAdapt_FullRebuild)->Apply(fvmg_bench::sweep_n);
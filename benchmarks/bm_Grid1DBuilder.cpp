@@ -0,0 +1,273 @@
+// ----------------------------------------------------------------------------
+// File: bm_Grid1DBuilder.cpp
+// Author: FVMGridMaker Team
+// Version: 1.4
+// Date: 2025-10-27
+// Description: Benchmarks de construção: distribuição × centralização pelo
+//              Grid1DBuilder (despacho via registro) e pelo Grid1DBuilderT
+//              (estático), além do custo do lookup no registro e da
+//              validação embutida no fechamento (setValidation), da
+//              geração em blocos (buildChunked), do acerto no Grid1DCache
+//              e de lotes de malhas pequenas (Grid1DBatchBuilder).
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#include "BenchCommon.hpp"
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1DStorage.h>
+#include <FVMGridMaker/Grid/Grid1D/Builders/ConfigureDistribution.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/DistOptions.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBatchBuilder.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBuilder.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBuilderT.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DCache.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DDistributionRegistry.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Centering/CellCentered.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Centering/FaceCentered.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Random1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Uniform1D.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+namespace core = FVMGridMaker::core;
+namespace cent = FVMGridMaker::grid::grid1d::patterns::centering;
+namespace dist = FVMGridMaker::grid::grid1d::patterns::distribution;
+using FVMGridMaker::grid::CenteringTag;
+using FVMGridMaker::grid::DistributionTag;
+using FVMGridMaker::grid::grid1d::api::Grid1DStorage;
+using FVMGridMaker::grid::grid1d::builders::DistOptions;
+using FVMGridMaker::grid::grid1d::builders::Grid1DBatchBuilder;
+using FVMGridMaker::grid::grid1d::builders::Grid1DBuilder;
+using FVMGridMaker::grid::grid1d::builders::Grid1DBuilderT;
+using FVMGridMaker::grid::grid1d::builders::Grid1DCache;
+using FVMGridMaker::grid::grid1d::builders::Grid1DDistributionRegistry;
+using FVMGridMaker::grid::grid1d::builders::Grid1DSpec;
+using FVMGridMaker::grid::grid1d::builders::configureDistribution;
+
+constexpr auto kChunkExec = core::ExecPolicy::Serial;
+
+dist::Random1D::Options bench_random_options() {
+    dist::Random1D::Options opt{};
+    opt.seed = 12345u;
+    return opt;
+}
+
+// Grid1DBuilder::buildInto (sem alocação no laço): despacho via registro
+template <DistributionTag Dist, CenteringTag Cent, core::ExecPolicy Exec,
+          bool Validate = false>
+void BM_Grid1DBuilder(benchmark::State& state) {
+    const auto n = static_cast<core::Index>(state.range(0));
+    Grid1DStorage s(n);
+    Grid1DBuilder b;
+    b.setN(n).setDomain(0.0, 1.0).setDistribution(Dist).setCentering(Cent)
+     .setOption(bench_random_options()).setExecPolicy(Exec).setValidation(Validate);
+
+    for (auto _ : state) {
+        b.buildInto(s.faces(), s.centers(), s.deltasFaces(), s.deltasCenters());
+        benchmark::DoNotOptimize(s.faces().data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Grid1DBuilderT::buildInto: D × C resolvidos em compilação
+template <class D, class C>
+void BM_Grid1DBuilderT(benchmark::State& state) {
+    const auto n = static_cast<core::Index>(state.range(0));
+    Grid1DStorage s(n);
+    Grid1DBuilderT<D, C> b = [] {
+        if constexpr (std::is_same_v<D, dist::Random1D>) {
+            return Grid1DBuilderT<D, C>{dist::Random1D{bench_random_options()}};
+        } else {
+            return Grid1DBuilderT<D, C>{};
+        }
+    }();
+    b.setN(n).setDomain(0.0, 1.0);
+
+    for (auto _ : state) {
+        b.buildInto(s.faces(), s.centers(), s.deltasFaces(), s.deltasCenters());
+        benchmark::DoNotOptimize(s.faces().data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// build() completo (inclui a alocação da arena do Grid1D)
+template <DistributionTag Dist, CenteringTag Cent>
+void BM_Grid1DBuilder_Build(benchmark::State& state) {
+    const auto n = static_cast<core::Index>(state.range(0));
+    Grid1DBuilder b;
+    b.setN(n).setDomain(0.0, 1.0).setDistribution(Dist).setCentering(Cent)
+     .setOption(bench_random_options());
+
+    for (auto _ : state) {
+        auto g = b.build();
+        benchmark::DoNotOptimize(g.faces().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// buildChunked: malha inteira em blocos de 64 Ki células (memória O(bloco));
+// inclui a criação do stream (buffers do bloco) a cada iteração.
+// Random1D exige o gerador por contador.
+template <DistributionTag Dist, CenteringTag Cent>
+void BM_Grid1DBuilder_Chunked(benchmark::State& state) {
+    const auto n = static_cast<core::Index>(state.range(0));
+    auto opt   = bench_random_options();
+    opt.policy = dist::Random1D::Options::Policy::CounterBased;
+    Grid1DBuilder b;
+    b.setN(n).setDomain(0.0, 1.0).setDistribution(Dist).setCentering(Cent)
+     .setOption(opt).setExecPolicy(kChunkExec);
+
+    for (auto _ : state) {
+        b.buildChunked(65536, [](core::Index, const auto& v) {
+            benchmark::DoNotOptimize(v.deltasCenters().data());
+        });
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Grid1DCache::get com acerto (hash da chave + lock; sem construção)
+template <DistributionTag Dist, CenteringTag Cent>
+void BM_Grid1DBuilder_CacheHit(benchmark::State& state) {
+    const auto n = static_cast<core::Index>(state.range(0));
+    Grid1DBuilder b;
+    b.setN(n).setDomain(0.0, 1.0).setDistribution(Dist).setCentering(Cent)
+     .setOption(bench_random_options());
+    Grid1DCache cache(std::size_t(1) << 32);
+    (void)cache.get(b);
+
+    for (auto _ : state) {
+        auto g = cache.get(b);
+        benchmark::DoNotOptimize(g.get());
+    }
+}
+
+// Lote de malhas pequenas (arg 0 = número de malhas de 32 volumes;
+// Random1D com semente por malha): laço de build() x Grid1DBatchBuilder
+constexpr core::Index kSmallN = 32;
+
+template <DistributionTag Dist>
+std::vector<Grid1DSpec> small_specs(std::size_t count) {
+    std::vector<Grid1DSpec> specs(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        specs[i].n    = kSmallN;
+        specs[i].dist = (Dist == DistributionTag::Random1D)
+            ? DistOptions::Random1D_Fixed(0.5, 1.5, 1u + i)
+            : DistOptions{Dist, {}};
+    }
+    return specs;
+}
+
+template <DistributionTag Dist>
+void BM_SmallGrids_BuildLoop(benchmark::State& state) {
+    const auto specs = small_specs<Dist>(static_cast<std::size_t>(state.range(0)));
+    std::vector<Grid1DBuilder> builders(specs.size());
+    for (std::size_t i = 0; i < specs.size(); ++i) {
+        builders[i].setN(kSmallN).setDomain(0.0, 1.0);
+        configureDistribution(builders[i], specs[i].dist);
+    }
+    for (auto _ : state) {
+        for (const auto& b : builders) {
+            auto g = b.build();
+            benchmark::DoNotOptimize(g.faces().data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <DistributionTag Dist, core::ExecPolicy Exec>
+void BM_SmallGrids_Batch(benchmark::State& state) {
+    const auto specs = small_specs<Dist>(static_cast<std::size_t>(state.range(0)));
+    const auto bb    = Grid1DBatchBuilder{}.setExecPolicy(Exec);
+    auto batch       = bb.build(specs);   // arena reaproveitada no laço
+    for (auto _ : state) {
+        bb.buildInto(specs, batch);
+        benchmark::DoNotOptimize(batch[0].faces().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void small_grid_counts(benchmark::internal::Benchmark* b) {
+    b->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMicrosecond);
+}
+
+// Lookup no registro (custo fixo do despacho por build)
+void BM_Registry_FindByName(benchmark::State& state) {
+    const auto& reg = Grid1DDistributionRegistry::instance();
+    for (auto _ : state) {
+        auto e = reg.find("Random1D");
+        benchmark::DoNotOptimize(e);
+    }
+}
+
+void BM_Registry_FindByTag(benchmark::State& state) {
+    const auto& reg = Grid1DDistributionRegistry::instance();
+    for (auto _ : state) {
+        auto e = reg.findByTag(DistributionTag::Random1D);
+        benchmark::DoNotOptimize(e);
+    }
+}
+
+void BM_Registry_EntryForTag(benchmark::State& state) {
+    const auto& reg = Grid1DDistributionRegistry::instance();
+    for (auto _ : state) {
+        const auto* e = reg.entryForTag(DistributionTag::Random1D);
+        benchmark::DoNotOptimize(e);
+    }
+}
+
+constexpr auto kFace = CenteringTag::FaceCentered;
+constexpr auto kCell = CenteringTag::CellCentered;
+constexpr auto kUni  = DistributionTag::Uniform1D;
+constexpr auto kRnd  = DistributionTag::Random1D;
+constexpr auto kSer  = core::ExecPolicy::Serial;
+constexpr auto kPar  = core::ExecPolicy::Parallel;
+
+} // namespace
+
+BENCHMARK(BM_Grid1DBuilder<kUni, kFace, kSer>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Grid1DBuilder<kUni, kCell, kSer>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Grid1DBuilder<kRnd, kFace, kSer>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Grid1DBuilder<kRnd, kCell, kSer>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Grid1DBuilder<kUni, kFace, kSer, true>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Grid1DBuilder<kUni, kCell, kSer, true>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Grid1DBuilder<kUni, kFace, kPar>)->Apply(fvmg_bench::sweep_n)->UseRealTime();
+BENCHMARK(BM_Grid1DBuilder<kUni, kCell, kPar>)->Apply(fvmg_bench::sweep_n)->UseRealTime();
+BENCHMARK(BM_Grid1DBuilder<kRnd, kFace, kPar>)->Apply(fvmg_bench::sweep_n)->UseRealTime();
+BENCHMARK(BM_Grid1DBuilder<kRnd, kCell, kPar>)->Apply(fvmg_bench::sweep_n)->UseRealTime();
+
+BENCHMARK(BM_Grid1DBuilderT<dist::Uniform1D, cent::FaceCentered>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Grid1DBuilderT<dist::Uniform1D, cent::CellCentered>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Grid1DBuilderT<dist::Random1D,  cent::FaceCentered>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Grid1DBuilderT<dist::Random1D,  cent::CellCentered>)->Apply(fvmg_bench::sweep_n);
+
+BENCHMARK(BM_Grid1DBuilder_Build<kUni, kFace>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Grid1DBuilder_Build<kRnd, kFace>)->Apply(fvmg_bench::sweep_n);
+
+BENCHMARK(BM_Grid1DBuilder_Chunked<kUni, kFace>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Grid1DBuilder_Chunked<kRnd, kFace>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Grid1DBuilder_Chunked<kRnd, kCell>)->Apply(fvmg_bench::sweep_n);
+
+BENCHMARK(BM_Grid1DBuilder_CacheHit<kRnd, kFace>)->Apply(fvmg_bench::sweep_n);
+
+BENCHMARK(BM_SmallGrids_BuildLoop<kUni>)->Apply(small_grid_counts);
+BENCHMARK(BM_SmallGrids_BuildLoop<kRnd>)->Apply(small_grid_counts);
+BENCHMARK(BM_SmallGrids_Batch<kUni, kSer>)->Apply(small_grid_counts);
+BENCHMARK(BM_SmallGrids_Batch<kRnd, kSer>)->Apply(small_grid_counts);
+BENCHMARK(BM_SmallGrids_Batch<kUni, kPar>)->Apply(small_grid_counts)->UseRealTime();
+BENCHMARK(BM_SmallGrids_Batch<kRnd, kPar>)->Apply(small_grid_counts)->UseRealTime();
+
+BENCHMARK(BM_Registry_FindByName);
+BENCHMARK(BM_Registry_FindByTag);
+BENCHMARK(BM_Registry_EntryForTag);
@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------
+// File: bm_Grid1DFile.cpp
+// Author: FVMGridMaker Team
+// Version: 1.0
+// Date: 2025-10-27
+// Description: Benchmarks do formato binário de malhas 1D: gravação, abertura
+//              por mmap sem verificação (custo independente de N) e
+//              verificação do checksum.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#include "BenchCommon.hpp"
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Grid/Grid1D/IO/Grid1DFile.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <filesystem>
+#include <string>
+
+namespace {
+
+namespace core = FVMGridMaker::core;
+namespace io   = FVMGridMaker::grid::grid1d::io;
+using FVMGridMaker::grid::DistributionTag;
+
+const FVMGridMaker::grid::grid1d::api::Grid1D& input(const benchmark::State& state) {
+    return fvmg_bench::cached_grid(static_cast<core::Index>(state.range(0)),
+                                   DistributionTag::Random1D);
+}
+
+std::string bench_path(const benchmark::State& state) {
+    return (std::filesystem::temp_directory_path() /
+            ("fvmg_bench_" + std::to_string(state.range(0)) + ".fvmg")).string();
+}
+
+void BM_File_Write(benchmark::State& state) {
+    const auto& g    = input(state);
+    const auto  path = bench_path(state);
+    for (auto _ : state) {
+        io::write_grid1d(path, g);
+    }
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_File_Open(benchmark::State& state) {
+    const auto path = bench_path(state);
+    io::write_grid1d(path, input(state));
+    for (auto _ : state) {
+        auto m = io::MappedGrid1D::open(path);
+        benchmark::DoNotOptimize(m.view().faces().data());
+    }
+    std::filesystem::remove(path);
+}
+
+template <core::ExecPolicy Exec>
+void BM_File_Verify(benchmark::State& state) {
+    const auto path = bench_path(state);
+    io::write_grid1d(path, input(state));
+    const auto m = io::MappedGrid1D::open(path);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(m.verify(Exec));
+    }
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_File_Write)->Apply(fvmg_bench::sweep_n)->UseRealTime();
+BENCHMARK(BM_File_Open)->Apply(fvmg_bench::sweep_n)->UseRealTime();
+BENCHMARK(BM_File_Verify<core::ExecPolicy::Serial>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_File_Verify<core::ExecPolicy::Parallel>)->Apply(fvmg_bench::sweep_n)->UseRealTime();
@@ -0,0 +1,114 @@
+// ----------------------------------------------------------------------------
+// File: bm_Grid1DStats.cpp
+// Author: FVMGridMaker Team
+// Version: 1.2
+// Date: 2025-10-27
+// Description: Benchmarks das estatísticas de malha: basic_exec serial vs
+//              paralelo, cada métrica de Grid1DStats (uma varredura cada) e
+//              a varredura fundida Grid1DStats::all e o histograma
+//              paralelo (histogram_into).
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#include "BenchCommon.hpp"
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Grid/Grid1D/Utils/Grid1DStats.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Utils/Grid1DStatsExec.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace {
+
+namespace core  = FVMGridMaker::core;
+namespace utils = FVMGridMaker::grid::grid1d::utils;
+using FVMGridMaker::grid::DistributionTag;
+using utils::Grid1DStats;
+
+const FVMGridMaker::grid::grid1d::api::Grid1D& input(const benchmark::State& state) {
+    return fvmg_bench::cached_grid(static_cast<core::Index>(state.range(0)),
+                                   DistributionTag::Random1D);
+}
+
+template <utils::ExecPolicy Exec>
+void BM_Stats_BasicExec(benchmark::State& state) {
+    const auto& g = input(state);
+    bool used_parallel = false;
+    for (auto _ : state) {
+        auto b = utils::basic_exec(g, Exec, &used_parallel);
+        benchmark::DoNotOptimize(b);
+    }
+    state.counters["used_parallel"] = used_parallel ? 1.0 : 0.0;
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Uma métrica de Grid1DStats por benchmark (cada uma relê deltasFaces)
+template <auto Metric>
+void BM_Stats_Metric(benchmark::State& state) {
+    const auto L = input(state).deltasFaces();
+    for (auto _ : state) {
+        auto r = Metric(L);
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+auto basic      (std::span<const core::Real> L) { return Grid1DStats::basic(L); }
+auto adjacent   (std::span<const core::Real> L) { return Grid1DStats::adjacent_ratios(L); }
+auto smoothness (std::span<const core::Real> L) { return Grid1DStats::smoothness(L); }
+auto edges      (std::span<const core::Real> L) { return Grid1DStats::edges_vs_interior(L); }
+auto symmetry   (std::span<const core::Real> L) { return Grid1DStats::symmetry(L); }
+auto geometric  (std::span<const core::Real> L) { return Grid1DStats::geometric_progression(L); }
+template <utils::ExecPolicy Exec>
+void BM_Stats_All(benchmark::State& state) {
+    const auto L = input(state).deltasFaces();
+    Grid1DStats::AllOptions opt{};
+    opt.bins  = 64;
+    opt.range = std::make_pair(core::Real(0), core::Real(2) / static_cast<core::Real>(state.range(0)));
+    opt.exec  = Exec;
+    for (auto _ : state) {
+        auto r = Grid1DStats::all(L, opt);
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <utils::ExecPolicy Exec, Grid1DStats::BinScale Scale>
+void BM_Stats_HistogramInto(benchmark::State& state) {
+    const auto L = input(state).deltasFaces();
+    const auto [lo, hi] = std::minmax_element(L.begin(), L.end());
+    std::vector<std::size_t> counts(64);
+    for (auto _ : state) {
+        Grid1DStats::histogram_into(L, counts, *lo, *hi, Scale, Exec);
+        benchmark::DoNotOptimize(counts.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+auto histogram64(std::span<const core::Real> L) { return Grid1DStats::histogram(L, 64); }
+
+} // namespace
+
+BENCHMARK(BM_Stats_BasicExec<utils::ExecPolicy::Serial>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Stats_BasicExec<utils::ExecPolicy::Parallel>)->Apply(fvmg_bench::sweep_n)->UseRealTime();
+
+BENCHMARK(BM_Stats_Metric<basic>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Stats_Metric<adjacent>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Stats_Metric<smoothness>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Stats_Metric<edges>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Stats_Metric<symmetry>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Stats_Metric<geometric>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Stats_Metric<histogram64>)->Apply(fvmg_bench::sweep_n);
+
+BENCHMARK(BM_Stats_All<utils::ExecPolicy::Serial>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Stats_All<utils::ExecPolicy::Parallel>)->Apply(fvmg_bench::sweep_n)->UseRealTime();
+
+BENCHMARK(BM_Stats_HistogramInto<utils::ExecPolicy::Serial,   Grid1DStats::BinScale::Linear>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Stats_HistogramInto<utils::ExecPolicy::Parallel, Grid1DStats::BinScale::Linear>)->Apply(fvmg_bench::sweep_n)->UseRealTime();
+BENCHMARK(BM_Stats_HistogramInto<utils::ExecPolicy::Parallel, Grid1DStats::BinScale::Log>)->Apply(fvmg_bench::sweep_n)->UseRealTime();
@@ -0,0 +1,75 @@
+// ----------------------------------------------------------------------------
+// File: bm_Grid1DValidation.cpp
+// Author: FVMGridMaker Team
+// Version: 1.1
+// Date: 2025-10-27
+// Description: Benchmarks das rotinas de validação (monotonicidade de faces e
+//              centros, larguras positivas e a verificação fundida
+//              validation::cells) sobre malhas válidas, isto é, o caso em
+//              que o array inteiro é percorrido.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#include "BenchCommon.hpp"
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Grid/Grid1D/Utils/Grid1DValidation.hpp>
+
+namespace {
+
+namespace core       = FVMGridMaker::core;
+namespace validation = FVMGridMaker::grid::grid1d::utils::validation;
+using FVMGridMaker::grid::DistributionTag;
+
+const FVMGridMaker::grid::grid1d::api::Grid1D& input(const benchmark::State& state) {
+    return fvmg_bench::cached_grid(static_cast<core::Index>(state.range(0)),
+                                   DistributionTag::Random1D);
+}
+
+void BM_Validation_IncreasingFaces(benchmark::State& state) {
+    const auto xf = input(state).faces();
+    for (auto _ : state) {
+        validation::strictly_increasing_faces(xf);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Validation_IncreasingCenters(benchmark::State& state) {
+    const auto xc = input(state).centers();
+    for (auto _ : state) {
+        validation::strictly_increasing_centers(xc);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Validation_PositiveFaceLengths(benchmark::State& state) {
+    const auto xf = input(state).faces();
+    for (auto _ : state) {
+        validation::positive_face_lengths(xf);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <core::ExecPolicy Exec>
+void BM_Validation_Cells(benchmark::State& state) {
+    const auto& g  = input(state);
+    const auto  xf = g.faces();
+    const auto  xc = g.centers();
+    for (auto _ : state) {
+        validation::cells(xf, xc, Exec);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_Validation_IncreasingFaces)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Validation_IncreasingCenters)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Validation_PositiveFaceLengths)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Validation_Cells<core::ExecPolicy::Serial>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Validation_Cells<core::ExecPolicy::Parallel>)->Apply(fvmg_bench::sweep_n)->UseRealTime();
@@ -0,0 +1,86 @@
+// ----------------------------------------------------------------------------
+// File: bm_Vinokur1D.cpp
+// Author: FVMGridMaker Team
+// Version: 1.0
+// Date: 2025-10-27
+// Description: Benchmarks da distribuição Vinokur1D: kernel em blocos
+//              (tabelas + um expm1 por bloco, sem desvios no laço interno)
+//              x forma tanh clássica com std::tanh por face; custo do
+//              Newton que resolve (δ, α) a partir das larguras das pontas.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#include "BenchCommon.hpp"
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Vinokur1D.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+namespace core = FVMGridMaker::core;
+using FVMGridMaker::grid::grid1d::patterns::distribution::Vinokur1D;
+
+// Camada-limite nas duas paredes: larguras ~1e-3/N da uniforme
+Vinokur1D::Options widths(core::Index n) {
+    Vinokur1D::Options o{};
+    o.first_width = 1e-3 / static_cast<core::Real>(n);
+    o.last_width  = 2e-3 / static_cast<core::Real>(n);
+    return o;
+}
+
+template <core::ExecPolicy Exec>
+void BM_Vinokur1D_Kernel(benchmark::State& state) {
+    const auto n = static_cast<core::Index>(state.range(0));
+    std::vector<core::Real> xf(n + 1u);
+    Vinokur1D::Options opt = widths(n);
+    opt.exec = Exec;
+    for (auto _ : state) {
+        Vinokur1D::faces_into(n, 0.0, 1.0, xf, &opt);
+        benchmark::DoNotOptimize(xf.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Forma tanh clássica: t = ½[1 + tanh(δ(ξ-½))/tanh(δ/2)], u = t/(α + (1-α)t)
+void BM_Vinokur1D_Tanh(benchmark::State& state) {
+    const auto n = static_cast<core::Index>(state.range(0));
+    const auto opt = widths(n);
+    const auto s   = Vinokur1D::stretching(n, opt.first_width, opt.last_width);
+    std::vector<core::Real> xf(n + 1u);
+    for (auto _ : state) {
+        const core::Real th = std::tanh(0.5 * s.delta);
+        const core::Real N  = static_cast<core::Real>(n);
+        for (std::size_t i = 0; i <= n; ++i) {
+            const core::Real xi = static_cast<core::Real>(i) / N;
+            const core::Real t  = 0.5 * (1.0 + std::tanh(s.delta * (xi - 0.5)) / th);
+            xf[i] = t / (s.alpha + (1.0 - s.alpha) * t);
+        }
+        benchmark::DoNotOptimize(xf.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Só o solver (O(1) em N)
+void BM_Vinokur1D_Solve(benchmark::State& state) {
+    const auto n   = static_cast<core::Index>(state.range(0));
+    const auto opt = widths(n);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Vinokur1D::stretching(n, opt.first_width, opt.last_width));
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_Vinokur1D_Kernel<core::ExecPolicy::Serial>)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Vinokur1D_Kernel<core::ExecPolicy::Parallel>)->Apply(fvmg_bench::sweep_n)->UseRealTime();
+BENCHMARK(BM_Vinokur1D_Tanh)->Apply(fvmg_bench::sweep_n);
+BENCHMARK(BM_Vinokur1D_Solve)->Arg(1000);
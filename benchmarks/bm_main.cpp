@@ -0,0 +1,40 @@
+// ----------------------------------------------------------------------------
+// File: bm_main.cpp
+// Author: FVMGridMaker Team
+// Version: 1.0
+// Date: 2025-10-27
+// Description: main do FVMGridMaker_bench. Registra as distribuições e, se o
+//              usuário não indicou --benchmark_out, grava o resultado em
+//              JSON (FVMGridMaker_bench.json) para comparação entre commits.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+#include "BenchCommon.hpp"
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <string_view>
+#include <vector>
+
+int main(int argc, char** argv) {
+    fvmg_bench::register_distributions();
+
+    std::vector<char*> args(argv, argv + argc);
+    bool has_out = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::string_view(argv[i]).starts_with("--benchmark_out=")) has_out = true;
+    }
+    static char out_arg[] = "--benchmark_out=FVMGridMaker_bench.json";
+    static char fmt_arg[] = "--benchmark_out_format=json";
+    if (!has_out) {
+        args.push_back(out_arg);
+        args.push_back(fmt_arg);
+    }
+
+    int n_args = static_cast<int>(args.size());
+    benchmark::Initialize(&n_args, args.data());
+    if (benchmark::ReportUnrecognizedArguments(n_args, args.data())) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,28 @@
+# ------------------------------------------------------------
+# Benchmarks configuration (Google Benchmark)
+# - Usa o pacote instalado no sistema; se ausente, baixa via
+#   FetchContent (mesma estratégia do googletest em ConfigTests).
+# ------------------------------------------------------------
+
+if(NOT BUILD_BENCHMARKS)
+  return()
+endif()
+
+message(STATUS "Building Benchmarks...")
+
+# Maior N da varredura 10, 100, ..., FVMG_BENCH_MAX_N
+set(FVMG_BENCH_MAX_N "100000000" CACHE STRING "Maior N usado nas varreduras de benchmark")
+
+find_package(benchmark QUIET)
+if(NOT benchmark_FOUND)
+  include(FetchContent)
+  FetchContent_Declare(
+    googlebenchmark
+    URL https://github.com/google/benchmark/archive/refs/tags/v1.8.3.zip
+  )
+  set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+  set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+  FetchContent_MakeAvailable(googlebenchmark)
+endif()
+
+add_subdirectory(benchmarks)
@@ -22,6 +22,7 @@ set(CMAKE_CXX_EXTENSIONS OFF)
 option(BUILD_EXAMPLES "Build examples" ON)
 option(BUILD_TESTS "Build tests" ON)
 option(BUILD_DOCS "Build docs (Doxygen + Sphinx)" OFF)
+option(BUILD_BENCHMARKS "Build benchmarks (Google Benchmark)" OFF)
 
 # Default build type
 if(NOT CMAKE_BUILD_TYPE)
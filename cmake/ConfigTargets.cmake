@@ -15,10 +15,12 @@ target_include_directories(FVMGridMaker
         ${FVMG_INCLUDE_DIR}
 )
 
-# Link dependencies (RNF06: Nenhuma)
+# Link dependencies (RNF06: nenhuma externa; apenas threads do sistema,
+# usadas por core::parallel_for_chunks)
+find_package(Threads REQUIRED)
 target_link_libraries(FVMGridMaker
     PUBLIC
-        # Vazio (CGAL Removido)
+        Threads::Threads
 )
 
 # Set optimizations
@@ -0,0 +1,21 @@
+// ----------------------------------------------------------------------------
+// File: RegisterBuiltinDistributions.cpp
+// Author: FVMGridMaker Team
+// Description: Ambiente global comum a todos os binários de teste: registra
+//              os padrões embutidos antes dos testes (o core não se
+//              auto-registra). Registros próprios de cada diretório de teste
+//              prevalecem, em qualquer ordem de inicialização.
+// ----------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <FVMGridMaker/Grid/Grid1D/Builders/RegisterBuiltinDistributions1D.hpp>
+
+struct BuiltinDistributionsEnv : ::testing::Environment {
+    void SetUp() override {
+        FVMGridMaker::grid::grid1d::builders::registerBuiltinDistributions();
+    }
+};
+
+::testing::Environment* const kBuiltinDistributionsEnv =
+    ::testing::AddGlobalTestEnvironment(new BuiltinDistributionsEnv{});
@@ -0,0 +1,101 @@
+// ----------------------------------------------------------------------------
+// File: ut_AnalyticGrid1D.cpp
+// Author: FVMGridMaker Team
+// Version: 1.0
+// Date: 2025-10-27
+// Description: Testes de unidade da malha analítica preguiçosa
+//              (UniformGrid1D): memória O(1), acessores idênticos ao build()
+//              face-centered e materialização igual para qualquer política.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Grid1D/API/AnalyticGrid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBuilderT.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Centering/FaceCentered.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Uniform1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Utils/Grid1DStats.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using Real  = FVMGridMaker::core::Real;
+using Index = FVMGridMaker::core::Index;
+using FVMGridMaker::core::ExecPolicy;
+using FVMGridMaker::grid::grid1d::api::Grid1D;
+using FVMGridMaker::grid::grid1d::api::UniformGrid1D;
+using FVMGridMaker::grid::grid1d::builders::Grid1DBuilderT;
+using FVMGridMaker::grid::grid1d::patterns::centering::FaceCentered;
+using FVMGridMaker::grid::grid1d::patterns::distribution::Uniform1D;
+using FVMGridMaker::grid::grid1d::utils::Grid1DStats;
+
+namespace {
+
+std::vector<Real> as_vec(std::span<const Real> s) { return {s.begin(), s.end()}; }
+
+Grid1D built(Index N, Real A, Real B) {
+    return Grid1DBuilderT<Uniform1D, FaceCentered>{}.setN(N).setDomain(A, B).build();
+}
+
+void expect_same(const Grid1D& a, const Grid1D& b) {
+    EXPECT_EQ(as_vec(a.faces()),         as_vec(b.faces()));
+    EXPECT_EQ(as_vec(a.centers()),       as_vec(b.centers()));
+    EXPECT_EQ(as_vec(a.deltasFaces()),   as_vec(b.deltasFaces()));
+    EXPECT_EQ(as_vec(a.deltasCenters()), as_vec(b.deltasCenters()));
+}
+
+} // namespace
+
+static_assert(sizeof(UniformGrid1D) == sizeof(Index) + 2 * sizeof(Real),
+              "malha analítica guarda só N, A e B");
+
+TEST(AnalyticGrid1D, AccessorsMatchFaceCenteredBuild) {
+    for (Index N : {1u, 2u, 7u, 1000u, 70001u}) {
+        SCOPED_TRACE(testing::Message() << "N=" << N);
+        const UniformGrid1D lazy(N, -1.0, 3.0);
+        const Grid1D g = built(N, -1.0, 3.0);
+
+        ASSERT_EQ(lazy.nVolumes(), g.nVolumes());
+        ASSERT_EQ(lazy.nFaces(),   g.nFaces());
+        for (Index i = 0; i < N; ++i) {
+            ASSERT_EQ(lazy.face(i),        g.face(i))        << "i=" << i;
+            ASSERT_EQ(lazy.center(i),      g.center(i))      << "i=" << i;
+            ASSERT_EQ(lazy.deltaFace(i),   g.deltaFace(i))   << "i=" << i;
+            ASSERT_EQ(lazy.deltaCenter(i), g.deltaCenter(i)) << "i=" << i;
+        }
+        EXPECT_EQ(lazy.face(N),        g.face(N));
+        EXPECT_EQ(lazy.deltaCenter(N), g.deltaCenter(N));
+    }
+}
+
+TEST(AnalyticGrid1D, MaterializeIsPolicyIndependent) {
+    for (Index N : {1u, 3u, 4097u, 200003u}) {
+        SCOPED_TRACE(testing::Message() << "N=" << N);
+        const UniformGrid1D lazy(N, 0.25, 7.5);
+        const Grid1D ref = built(N, 0.25, 7.5);
+        for (auto p : {ExecPolicy::Serial, ExecPolicy::Parallel, ExecPolicy::Auto}) {
+            expect_same(lazy.materialize(p), ref);
+        }
+    }
+
+    // Spans do materializado alimentam os templates GridLike
+    const Grid1D g = UniformGrid1D(512, 0.0, 1.0).materialize();
+    EXPECT_GT(Grid1DStats::uniformidadeFaces(g), 1.0 - 1e-12);
+}
+
+TEST(AnalyticGrid1D, DefaultIsEmpty) {
+    const UniformGrid1D none{};
+    EXPECT_TRUE(none.empty());
+    EXPECT_EQ(none.nFaces(), 0u);
+    EXPECT_EQ(none.materialize().nVolumes(), 0u);
+}
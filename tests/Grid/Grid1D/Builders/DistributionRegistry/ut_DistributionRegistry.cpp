@@ -1,11 +1,12 @@
 // ----------------------------------------------------------------------------
 // File: ut_DistributionRegistry.cpp
 // Author: FVMGridMaker Team
-// Version: 1.1
-// Date: 2025-10-26
+// Version: 1.3
+// Date: 2025-10-27
 // Description: Testes de unidade do Grid1DDistributionRegistry.
 //              Verifica presença de padrões e registro de distribuições
-//              definidas pelo usuário (faces/centers).
+//              definidas pelo usuário (faces/centers). O modo congelado
+//              fica em DistributionRegistryFrozen (binário próprio).
 // License: GNU GPL v3
 // ----------------------------------------------------------------------------
 
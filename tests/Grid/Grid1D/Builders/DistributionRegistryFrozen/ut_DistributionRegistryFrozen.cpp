@@ -0,0 +1,87 @@
+// ----------------------------------------------------------------------------
+// File: ut_DistributionRegistryFrozen.cpp
+// Author: FVMGridMaker Team
+// Version: 1.0
+// Date: 2025-10-27
+// Description: Testes de unidade do modo congelado do
+//              Grid1DDistributionRegistry (lookup denso por tag, leitura
+//              concorrente). Congelar é irreversível no processo, por isso
+//              este teste tem binário próprio e não depende da ordem (nem de
+//              --gtest_shuffle) dos demais testes do registro.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/ErrorHandling/ErrorHandling.h>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DDistributionRegistry.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// gtest (silencia -Wsign-conversion apenas nesses headers)
+#if defined(__GNUC__) || defined(__clang__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wsign-conversion"
+#endif
+#include <gtest/gtest.h>
+#if defined(__GNUC__) || defined(__clang__)
+  #pragma GCC diagnostic pop
+#endif
+
+using FVMGridMaker::core::Real;
+using FVMGridMaker::grid::DistributionTag;
+using FVMGridMaker::grid::grid1d::builders::Grid1DDistributionRegistry;
+
+// ----------------------------------------------------------------------------
+// TESTES
+// ----------------------------------------------------------------------------
+
+TEST(DistributionRegistry, FreezeGivesStableLockFreeLookup) {
+    auto& reg = Grid1DDistributionRegistry::instance();
+
+    // Antes do freeze não há tabela densa
+    EXPECT_FALSE(reg.isFrozen());
+    EXPECT_EQ(reg.entryForTag(DistributionTag::Uniform1D), nullptr);
+
+    reg.freeze();
+    reg.freeze(); // idempotente
+    ASSERT_TRUE(reg.isFrozen());
+
+    const auto* e = reg.entryForTag(DistributionTag::Uniform1D);
+    ASSERT_NE(e, nullptr);
+    EXPECT_EQ(e, reg.entryForTag(DistributionTag::Uniform1D));   // endereço estável
+    EXPECT_EQ(reg.entryForTag(DistributionTag::Count), nullptr); // fora da faixa
+
+    // Leitura concorrente: todos os threads veem o mesmo ponteiro
+    constexpr int kThreads = 4;
+    std::vector<const Grid1DDistributionRegistry::Entry*> seen(kThreads, nullptr);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < kThreads; ++t) {
+        pool.emplace_back([&reg, &seen, t] {
+            const Grid1DDistributionRegistry::Entry* p = nullptr;
+            for (int k = 0; k < 10000; ++k) {
+                p = reg.entryForTag(DistributionTag::Uniform1D);
+            }
+            seen[static_cast<std::size_t>(t)] = p;
+        });
+    }
+    for (auto& th : pool) th.join();
+    for (const auto* p : seen) EXPECT_EQ(p, e);
+
+    const auto xf = e->faces_fn(4, Real(0), Real(1), nullptr);
+    ASSERT_EQ(xf.size(), 5u);
+    EXPECT_DOUBLE_EQ(xf.back(), 1.0);
+
+    // Registro após freeze é rejeitado
+    EXPECT_THROW(reg.registerDistribution("Late", Grid1DDistributionRegistry::Entry{}),
+                 FVMGridMaker::error::FVMGException);
+    EXPECT_FALSE(reg.find("Late").has_value());
+}
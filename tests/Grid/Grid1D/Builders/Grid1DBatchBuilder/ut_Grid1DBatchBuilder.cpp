@@ -0,0 +1,233 @@
+// ----------------------------------------------------------------------------
+// File: ut_Grid1DBatchBuilder.cpp
+// Author: FVMGridMaker Team
+// Version: 1.2
+// Date: 2025-10-27
+// Description: Testes de unidade do Grid1DBatchBuilder: cada malha do lote é
+//              idêntica ao Grid1DBuilder::build() com os mesmos parâmetros,
+//              para qualquer ExecPolicy; arena única, reaproveitada por
+//              buildInto(); especificações inválidas lançam antes de gerar
+//              (com Policy::Status, o lote anterior fica intacto); erros
+//              de uma malha indicam o spec; Auto aninhado roda serial.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/ParallelFor.hpp>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/ErrorHandling/ErrorHandling.h>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1DView.h>
+#include <FVMGridMaker/Grid/Grid1D/Builders/ConfigureDistribution.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/DistOptions.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBatchBuilder.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBuilder.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <atomic>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using Real  = FVMGridMaker::core::Real;
+using Index = FVMGridMaker::core::Index;
+using FVMGridMaker::core::ExecPolicy;
+using FVMGridMaker::grid::CenteringTag;
+using FVMGridMaker::grid::DistributionTag;
+using FVMGridMaker::grid::grid1d::api::Grid1D;
+using FVMGridMaker::grid::grid1d::api::Grid1DView;
+using FVMGridMaker::grid::grid1d::builders::DistOptions;
+using FVMGridMaker::grid::grid1d::builders::Grid1DBatchBuilder;
+using FVMGridMaker::grid::grid1d::builders::Grid1DBuilder;
+using FVMGridMaker::grid::grid1d::builders::Grid1DSpec;
+using FVMGridMaker::grid::grid1d::builders::configureDistribution;
+
+namespace {
+
+std::vector<Real> as_vec(std::span<const Real> s) { return {s.begin(), s.end()}; }
+
+// Lote variado: N de 1 a ~300, domínios, tags, centerings e sementes
+std::vector<Grid1DSpec> mixed_specs(std::size_t count) {
+    std::vector<Grid1DSpec> specs;
+    specs.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        Grid1DSpec s;
+        s.n = static_cast<Index>(1u + (i * 37u) % 300u);
+        s.a = -static_cast<Real>(i % 5u);
+        s.b = 1.0 + static_cast<Real>(i % 3u);
+        s.dist = (i % 2u == 0u)
+            ? DistOptions{DistributionTag::Uniform1D, {}}
+            : DistOptions::Random1D_Fixed(0.5, 1.5, 1000u + i);
+        s.centering = (i % 4u < 2u) ? CenteringTag::FaceCentered
+                                    : CenteringTag::CellCentered;
+        specs.push_back(s);
+    }
+    return specs;
+}
+
+Grid1D reference(const Grid1DSpec& s) {
+    Grid1DBuilder b;
+    b.setN(s.n).setDomain(s.a, s.b).setCentering(s.centering);
+    configureDistribution(b, s.dist);
+    return b.build();
+}
+
+void expect_same(const Grid1DView& v, const Grid1D& g) {
+    EXPECT_EQ(as_vec(v.faces()),         as_vec(g.faces()));
+    EXPECT_EQ(as_vec(v.centers()),       as_vec(g.centers()));
+    EXPECT_EQ(as_vec(v.deltasFaces()),   as_vec(g.deltasFaces()));
+    EXPECT_EQ(as_vec(v.deltasCenters()), as_vec(g.deltasCenters()));
+}
+
+} // namespace
+
+TEST(Grid1DBatchBuilder, EachGridMatchesBuild) {
+    const auto specs = mixed_specs(257);
+    std::vector<Grid1D> refs;
+    for (const auto& s : specs) refs.push_back(reference(s));
+
+    for (auto p : {ExecPolicy::Serial, ExecPolicy::Parallel, ExecPolicy::Auto}) {
+        SCOPED_TRACE(testing::Message() << "policy=" << static_cast<int>(p));
+        const auto batch = Grid1DBatchBuilder{}.setExecPolicy(p).build(specs);
+        ASSERT_EQ(batch.size(), specs.size());
+        for (std::size_t i = 0; i < specs.size(); ++i) {
+            SCOPED_TRACE(testing::Message() << "i=" << i);
+            ASSERT_EQ(batch[i].nVolumes(), specs[i].n);
+            expect_same(batch[i], refs[i]);
+        }
+    }
+}
+
+TEST(Grid1DBatchBuilder, LargeGridUsesBatchPolicyForClosure) {
+    // Poucas malhas grandes: uma fatia, fechamento paralelo dentro da malha
+    std::vector<Grid1DSpec> specs(2);
+    specs[0].n = 300000;
+    specs[1].n = 7;
+    specs[1].dist = DistOptions::Random1D_Fixed(0.3, 1.9, 42u);
+    const auto batch = Grid1DBatchBuilder{}.setExecPolicy(ExecPolicy::Auto).build(specs);
+    expect_same(batch[0], reference(specs[0]));
+    expect_same(batch[1], reference(specs[1]));
+}
+
+TEST(Grid1DBatchBuilder, SingleArenaLayout) {
+    const auto specs = mixed_specs(10);
+    const auto batch = Grid1DBatchBuilder{}.build(specs);
+
+    std::size_t reals = 0;
+    for (const auto& s : specs) reals += 4u * s.n + 2u;
+    EXPECT_EQ(batch.bytes(), reals * sizeof(Real));
+
+    // Malhas consecutivas na mesma alocação
+    for (std::size_t i = 0; i + 1 < batch.size(); ++i) {
+        EXPECT_EQ(batch[i].deltasCenters().data() + batch[i].deltasCenters().size(),
+                  batch[i + 1].faces().data());
+    }
+
+    EXPECT_TRUE(Grid1DBatchBuilder{}.build({}).empty());
+}
+
+TEST(Grid1DBatchBuilder, BuildIntoReusesArena) {
+    const auto big   = mixed_specs(50);
+    const auto small = mixed_specs(20);
+    const Grid1DBatchBuilder bb;
+
+    auto batch = bb.build(big);
+    const Real* arena = batch[0].faces().data();
+
+    bb.buildInto(small, batch);   // cabe: mesma arena
+    ASSERT_EQ(batch.size(), small.size());
+    EXPECT_EQ(batch[0].faces().data(), arena);
+    for (std::size_t i = 0; i < small.size(); ++i) expect_same(batch[i], reference(small[i]));
+
+    // Lote inválido não altera o lote anterior
+    auto bad = small;
+    bad.back().n = 0;
+    EXPECT_THROW(bb.buildInto(bad, batch), FVMGridMaker::error::FVMGException);
+    ASSERT_EQ(batch.size(), small.size());
+    expect_same(batch[3], reference(small[3]));
+}
+
+TEST(Grid1DBatchBuilder, InvalidSpecThrows) {
+    using FVMGridMaker::error::FVMGException;
+    auto specs = mixed_specs(5);
+    specs[3].n = 0;
+    EXPECT_THROW((void)Grid1DBatchBuilder{}.build(specs), FVMGException);
+
+    specs = mixed_specs(5);
+    specs[2].b = specs[2].a;
+    EXPECT_THROW((void)Grid1DBatchBuilder{}.build(specs), FVMGException);
+
+    // Validação dentro do fechamento: malhas válidas passam
+    EXPECT_NO_THROW((void)Grid1DBatchBuilder{}.setValidation(true).build(mixed_specs(20)));
+}
+
+TEST(Grid1DBatchBuilder, InvalidSpecKeepsBatchUnderStatusPolicy) {
+    namespace err = FVMGridMaker::error;
+    const auto original = err::Config::get();
+    err::ErrorConfig cfg;
+    cfg.policy = err::Policy::Status;
+    err::Config::set(cfg);
+    (void)err::ErrorManager::flush();
+
+    const auto specs = mixed_specs(6);
+    const Grid1DBatchBuilder bb;
+    auto batch = bb.build(specs);
+
+    auto bad = specs;
+    bad[4].n = 0;
+    bb.buildInto(bad, batch);
+    bad = specs;
+    bad[1].b = bad[1].a;
+    bb.buildInto(bad, batch);
+
+    ASSERT_EQ(batch.size(), specs.size());
+    for (std::size_t i = 0; i < specs.size(); ++i) expect_same(batch[i], reference(specs[i]));
+    EXPECT_TRUE(bb.build(bad).empty());
+
+    EXPECT_EQ(err::ErrorManager::flush().size(), 3u);
+    err::Config::set(*original);
+}
+
+TEST(Grid1DBatchBuilder, WorkerErrorsNameTheSpec) {
+    // Geometric1D r = 0.9, N = 1000: menor célula abaixo da resolução
+    for (ExecPolicy p : {ExecPolicy::Serial, ExecPolicy::Parallel}) {
+        auto specs = mixed_specs(6);
+        specs[3].n    = 1000;
+        specs[3].dist = DistOptions::Geometric1D_Ratio(0.9);
+        try {
+            (void)Grid1DBatchBuilder{}.setExecPolicy(p).build(specs);
+            ADD_FAILURE() << "build() deveria lançar";
+        } catch (const std::invalid_argument& e) {
+            EXPECT_NE(std::string(e.what()).find("[spec 3]"), std::string::npos) << e.what();
+        }
+    }
+}
+
+TEST(Grid1DBatchBuilder, NestedAutoRunsSerialInsideSplitLoop) {
+    namespace core = FVMGridMaker::core;
+    if (core::hardware_threads() < 2u) GTEST_SKIP() << "um só thread de hardware";
+
+    // Dentro de um bloco paralelo, Auto não abre threads; Parallel sim
+    std::atomic<int> nested_auto{0}, nested_parallel{0}, blocks{0};
+    core::parallel_for_chunks(4, ExecPolicy::Parallel, [&](std::size_t, std::size_t) {
+        ++blocks;
+        if (core::parallel_chunks(std::size_t(1) << 30, ExecPolicy::Auto) > 1u) ++nested_auto;
+        if (core::parallel_chunks(4, ExecPolicy::Parallel) > 1u) ++nested_parallel;
+    }, 1);
+    EXPECT_GT(blocks.load(), 1);
+    EXPECT_EQ(nested_auto.load(), 0);
+    EXPECT_EQ(nested_parallel.load(), blocks.load());
+
+    // Fora do laço, Auto volta a dividir
+    EXPECT_GT(core::parallel_chunks(std::size_t(1) << 30, ExecPolicy::Auto), 1u);
+}
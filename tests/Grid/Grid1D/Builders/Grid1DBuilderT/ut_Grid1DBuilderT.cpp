@@ -0,0 +1,178 @@
+// ----------------------------------------------------------------------------
+// File: ut_Grid1DBuilderT.cpp
+// Author: FVMGridMaker Team
+// Version: 1.2
+// Date: 2025-10-27
+// Description: Testes de unidade do Grid1DBuilderT (D × C em tempo de
+//              compilação): equivalência bit a bit com o Grid1DBuilder;
+//              buildInto sem escrita após erro (Policy::Status);
+//              functor const chamado sem cópia.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/ErrorHandling/ErrorHandling.h>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBuilder.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBuilderT.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Centering/CellCentered.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Centering/FaceCentered.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Random1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Uniform1D.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using Real  = FVMGridMaker::core::Real;
+using Index = FVMGridMaker::core::Index;
+using FVMGridMaker::grid::CenteringTag;
+using FVMGridMaker::grid::DistributionTag;
+using FVMGridMaker::grid::grid1d::api::Grid1D;
+using FVMGridMaker::grid::grid1d::builders::Grid1DBuilder;
+using FVMGridMaker::grid::grid1d::builders::Grid1DBuilderT;
+using FVMGridMaker::grid::grid1d::patterns::centering::CellCentered;
+using FVMGridMaker::grid::grid1d::patterns::centering::FaceCentered;
+using FVMGridMaker::grid::grid1d::patterns::distribution::Random1D;
+using FVMGridMaker::grid::grid1d::patterns::distribution::Uniform1D;
+
+namespace {
+std::vector<Real> as_vec(auto range) { return {range.begin(), range.end()}; }
+
+void expect_same(const Grid1D& a, const Grid1D& b) {
+    EXPECT_EQ(as_vec(a.faces()),         as_vec(b.faces()));
+    EXPECT_EQ(as_vec(a.centers()),       as_vec(b.centers()));
+    EXPECT_EQ(as_vec(a.deltasFaces()),   as_vec(b.deltasFaces()));
+    EXPECT_EQ(as_vec(a.deltasCenters()), as_vec(b.deltasCenters()));
+}
+
+// Uniform1D que conta cópias (métodos const, como os da biblioteca).
+int g_copies = 0;
+struct CountingUniform {
+    CountingUniform() = default;
+    CountingUniform(const CountingUniform&) { ++g_copies; }
+    CountingUniform& operator=(const CountingUniform&) { ++g_copies; return *this; }
+    void makeFaces(Index N, Real A, Real B, std::span<Real> xf,
+                   std::uint64_t s, Real dx) const { Uniform1D{}.makeFaces(N, A, B, xf, s, dx); }
+    void makeCenters(Index N, Real A, Real B, std::span<Real> xc,
+                     std::uint64_t s, Real dx) const { Uniform1D{}.makeCenters(N, A, B, xc, s, dx); }
+};
+
+// Functor com estado mutável: makeFaces/makeCenters não-const.
+struct MutableUniform {
+    int calls = 0;
+    void makeFaces(Index N, Real A, Real B, std::span<Real> xf,
+                   std::uint64_t s, Real dx) { ++calls; Uniform1D{}.makeFaces(N, A, B, xf, s, dx); }
+    void makeCenters(Index N, Real A, Real B, std::span<Real> xc,
+                     std::uint64_t s, Real dx) { ++calls; Uniform1D{}.makeCenters(N, A, B, xc, s, dx); }
+};
+} // namespace
+
+TEST(Grid1DBuilderT, UniformMatchesRuntimeBuilder) {
+    for (Index n : {Index(1), Index(2), Index(7), Index(100)}) {
+        const auto gf = Grid1DBuilderT<Uniform1D, FaceCentered>{}
+                            .setN(n).setDomain(-1.0, 3.0).build();
+        const auto rf = Grid1DBuilder{}.setN(n).setDomain(-1.0, 3.0)
+                            .setDistribution(DistributionTag::Uniform1D)
+                            .setCentering(CenteringTag::FaceCentered).build();
+        expect_same(gf, rf);
+
+        const auto gc = Grid1DBuilderT<Uniform1D, CellCentered>{}
+                            .setN(n).setDomain(-1.0, 3.0).build();
+        const auto rc = Grid1DBuilder{}.setN(n).setDomain(-1.0, 3.0)
+                            .setDistribution(DistributionTag::Uniform1D)
+                            .setCentering(CenteringTag::CellCentered).build();
+        expect_same(gc, rc);
+    }
+}
+
+TEST(Grid1DBuilderT, RandomMatchesRuntimeBuilder) {
+    Random1D::Options opt{};
+    opt.w_lo = 0.6; opt.w_hi = 1.4; opt.seed = 424242u;
+
+    const auto gf = Grid1DBuilderT<Random1D, FaceCentered>{Random1D{opt}}
+                        .setN(300).setDomain(0.0, 2.0).build();
+    const auto rf = Grid1DBuilder{}.setN(300).setDomain(0.0, 2.0)
+                        .setDistribution(DistributionTag::Random1D)
+                        .setCentering(CenteringTag::FaceCentered)
+                        .setOption(opt).build();
+    expect_same(gf, rf);
+
+    const auto gc = Grid1DBuilderT<Random1D, CellCentered>{Random1D{opt}}
+                        .setN(300).setDomain(0.0, 2.0).build();
+    const auto rc = Grid1DBuilder{}.setN(300).setDomain(0.0, 2.0)
+                        .setDistribution(DistributionTag::Random1D)
+                        .setCentering(CenteringTag::CellCentered)
+                        .setOption(opt).build();
+    expect_same(gc, rc);
+}
+
+TEST(Grid1DBuilderT, BuildIntoAndValidation) {
+    constexpr Index N = 16;
+    std::vector<Real> xf(N + 1), xc(N), dF(N), dC(N + 1);
+    Grid1DBuilderT<Uniform1D, FaceCentered> b;
+    b.setN(N).setDomain(0.0, 1.0).buildInto(xf, xc, dF, dC);
+    expect_same(b.build(), Grid1D(xf, xc, dF, dC));
+
+    using UniformFace = Grid1DBuilderT<Uniform1D, FaceCentered>;
+    using UniformCell = Grid1DBuilderT<Uniform1D, CellCentered>;
+    std::vector<Real> small(N);
+    EXPECT_THROW(b.buildInto(small, xc, dF, dC), FVMGridMaker::error::FVMGException);
+    EXPECT_THROW((void)UniformFace{}.setN(0).build(),
+                 FVMGridMaker::error::FVMGException);
+    EXPECT_THROW((void)UniformCell{}.setN(4).setDomain(1.0, 1.0).build(),
+                 FVMGridMaker::error::FVMGException);
+}
+
+TEST(Grid1DBuilderT, BuildIntoStopsOnWrongSizesUnderStatusPolicy) {
+    namespace err = FVMGridMaker::error;
+    const auto original = err::Config::get();
+    err::ErrorConfig cfg;
+    cfg.policy = err::Policy::Status;
+    err::Config::set(cfg);
+    (void)err::ErrorManager::flush();
+
+    // Buffers curtos (N para as faces) ficam intocados nos dois builders
+    constexpr Index N = 16;
+    std::vector<Real> xf(N, -1.0), xc(N, -1.0), dF(N, -1.0), dC(N + 1, -1.0);
+    Grid1DBuilderT<Uniform1D, FaceCentered>{}.setN(N).setDomain(0.0, 1.0)
+        .buildInto(xf, xc, dF, dC);
+    Grid1DBuilder{}.setN(N).setDomain(0.0, 1.0)
+        .setDistribution(DistributionTag::Uniform1D).buildInto(xf, xc, dF, dC);
+    for (const auto* v : {&xf, &xc, &dF, &dC}) {
+        for (Real x : *v) EXPECT_EQ(x, -1.0);
+    }
+
+    // N = 0: build() devolve malha vazia
+    using UniformFace = Grid1DBuilderT<Uniform1D, FaceCentered>;
+    EXPECT_EQ(UniformFace{}.setN(0).build().nVolumes(), Index{0});
+
+    EXPECT_EQ(err::ErrorManager::flush().size(), 3u);
+    err::Config::set(*original);
+}
+
+TEST(Grid1DBuilderT, ConstFunctorIsNotCopiedPerBuild) {
+    Grid1DBuilderT<CountingUniform, FaceCentered> b;
+    b.setN(32).setDomain(0.0, 1.0);
+    g_copies = 0;
+    const auto g = b.build();
+    (void)b.build();
+    EXPECT_EQ(g_copies, 0);
+    expect_same(g, Grid1DBuilderT<Uniform1D, FaceCentered>{}
+                       .setN(32).setDomain(0.0, 1.0).build());
+
+    // Functor não-const continua aceito (cópia local por build)
+    const auto m = Grid1DBuilderT<MutableUniform, CellCentered>{}
+                       .setN(32).setDomain(0.0, 1.0).build();
+    expect_same(m, Grid1DBuilderT<Uniform1D, CellCentered>{}
+                       .setN(32).setDomain(0.0, 1.0).build());
+}
@@ -0,0 +1,160 @@
+// ----------------------------------------------------------------------------
+// File: ut_Grid1DBuilderValidation.cpp
+// Author: FVMGridMaker Team
+// Version: 1.0
+// Date: 2025-10-27
+// Description: Testes de unidade de Grid1DBuilder::setValidation com
+//              violações plantadas por uma distribuição registrada no teste:
+//              código GridErr e índice {i} reportados, nas duas centragens.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/ErrorHandling/ErrorHandling.h>
+#include <FVMGridMaker/ErrorHandling/FVMGException.h>
+#include <FVMGridMaker/ErrorHandling/GridErrors.h>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBuilder.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DDistributionRegistry.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <any>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+// gtest (silencia -Wsign-conversion apenas nesses headers)
+#if defined(__GNUC__) || defined(__clang__)
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wsign-conversion"
+#endif
+#include <gtest/gtest.h>
+#if defined(__GNUC__) || defined(__clang__)
+  #pragma GCC diagnostic pop
+#endif
+
+using Real  = FVMGridMaker::core::Real;
+using Index = FVMGridMaker::core::Index;
+using FVMGridMaker::core::ExecPolicy;
+using FVMGridMaker::error::GridErr;
+using FVMGridMaker::grid::CenteringTag;
+using FVMGridMaker::grid::DistributionTag;
+using FVMGridMaker::grid::grid1d::builders::Grid1DBuilder;
+using FVMGridMaker::grid::grid1d::builders::Grid1DDistributionRegistry;
+
+namespace {
+
+// Sequência base plantada (faces em FaceCentered, centros em CellCentered).
+std::vector<Real> g_planted;
+
+// Registra "Planted1D" sob o tag Random1D (este binário não usa Random1D).
+// Feito no corpo de cada teste, após os ambientes globais: a associação
+// tag -> nome não depende da ordem de inicialização.
+void plant(std::vector<Real> base) {
+    g_planted = std::move(base);
+    Grid1DDistributionRegistry::Entry e{};
+    e.faces_fn   = [](Index, Real, Real, const std::any*) { return g_planted; };
+    e.centers_fn = [](Index, Real, Real, const std::any*) { return g_planted; };
+    Grid1DDistributionRegistry::instance().registerDistribution(
+        "Planted1D", std::move(e), DistributionTag::Random1D);
+}
+
+// Mensagem esperada para @p code com {i} = @p i (idioma da configuração).
+std::string expected_message(GridErr code, std::size_t i) {
+    using Traits = FVMGridMaker::error::ErrorTraits<GridErr>;
+    const auto cfg = FVMGridMaker::error::Config::get();
+    std::string out(cfg && cfg->language == FVMGridMaker::error::Language::EnUS
+                        ? Traits::enUS(code) : Traits::ptBR(code));
+    const std::string token = "{i}";
+    const std::string value = std::to_string(i);
+    for (auto pos = out.find(token); pos != std::string::npos;
+         pos = out.find(token, pos + value.size())) {
+        out.replace(pos, token.size(), value);
+    }
+    return out;
+}
+
+// Constrói a malha plantada (N = tamanho da base) e confere código e {i}.
+void expect_violation(CenteringTag centering, std::vector<Real> base,
+                      GridErr code, std::size_t i) {
+    const Index N = static_cast<Index>(centering == CenteringTag::FaceCentered
+                                           ? base.size() - 1u : base.size());
+    const Real  a = (centering == CenteringTag::FaceCentered) ? base.front() : Real(0);
+    const Real  b = (centering == CenteringTag::FaceCentered) ? base.back()  : Real(1);
+    plant(std::move(base));
+
+    for (ExecPolicy p : {ExecPolicy::Serial, ExecPolicy::Parallel}) {
+        auto builder = Grid1DBuilder{}.setN(N).setDomain(a, b)
+                          .setDistribution(DistributionTag::Random1D)
+                          .setCentering(centering)
+                          .setExecPolicy(p);
+        EXPECT_NO_THROW((void)builder.build());
+        try {
+            (void)builder.setValidation(true).build();
+            ADD_FAILURE() << "build() com validação deveria lançar";
+        } catch (const FVMGridMaker::error::FVMGException& e) {
+            EXPECT_EQ(e.code(), FVMGridMaker::error::code(code));
+            EXPECT_EQ(e.record().message, expected_message(code, i));
+        }
+    }
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// FaceCentered: faces plantadas; centros = médias das faces
+// -----------------------------------------------------------------------------
+TEST(Grid1DBuilderValidation, FaceCenteredReportsCodeAndIndex) {
+    // xf[2] > xf[3]: primeira largura negativa em k = 2
+    expect_violation(CenteringTag::FaceCentered, {0.0, 0.25, 0.5, 0.4, 1.0},
+                     GridErr::NonIncreasingFaces, 2);
+
+    // NaN em xf[2]: dF[1] é a primeira falha
+    expect_violation(CenteringTag::FaceCentered, {0.0, 0.25, std::nan(""), 0.75, 1.0},
+                     GridErr::NonIncreasingFaces, 1);
+
+    // xf[2] == xf[3]: célula de largura nula
+    expect_violation(CenteringTag::FaceCentered, {0.0, 0.25, 0.5, 0.5, 1.0},
+                     GridErr::DegenerateMesh, 2);
+
+    // Faces separadas por 1 ulp: 0.5*(xf0 + xf1) arredonda para xf0
+    // (empate para par), logo xc[0] == xf[0] e dC[0] = 0
+    const Real f0 = 1.0;
+    const Real f1 = std::nextafter(f0, 2.0);
+    const Real f2 = std::nextafter(f1, 2.0);
+    expect_violation(CenteringTag::FaceCentered, {f0, f1, f2},
+                     GridErr::CenterOutsideCell, 0);
+}
+
+// -----------------------------------------------------------------------------
+// CellCentered: centros plantados em [0, 1]; faces internas = médias
+// -----------------------------------------------------------------------------
+TEST(Grid1DBuilderValidation, CellCenteredReportsCodeAndIndex) {
+    // xf = {0, .35, .325, .475, 1}: faces decrescem em k = 1
+    expect_violation(CenteringTag::CellCentered, {0.1, 0.6, 0.05, 0.9},
+                     GridErr::NonIncreasingFaces, 1);
+
+    // xf = {0, .35, .35, .5, 1}: largura nula em k = 1
+    expect_violation(CenteringTag::CellCentered, {0.1, 0.6, 0.1, 0.9},
+                     GridErr::DegenerateMesh, 1);
+
+    // xc[2] < xc[1] com faces crescentes: dC[2] <= 0 → i = k - 1 = 1
+    expect_violation(CenteringTag::CellCentered, {0.1, 0.4, 0.3, 0.9},
+                     GridErr::NonIncreasingCenters, 1);
+
+    // xc[0] == A: dC[0] = 0 → i = 0
+    expect_violation(CenteringTag::CellCentered, {0.0, 0.3, 0.5, 0.8},
+                     GridErr::CenterOutsideCell, 0);
+
+    // xc[N-1] == B: dC[N] = 0 → i = N - 1
+    expect_violation(CenteringTag::CellCentered, {0.1, 0.3, 0.5, 1.0},
+                     GridErr::CenterOutsideCell, 3);
+}
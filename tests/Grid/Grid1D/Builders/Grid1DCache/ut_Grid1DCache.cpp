@@ -0,0 +1,233 @@
+// ----------------------------------------------------------------------------
+// File: ut_Grid1DCache.cpp
+// Author: FVMGridMaker Team
+// Version: 1.1
+// Date: 2025-10-27
+// Description: Testes de unidade do Grid1DCache: acerto devolve a mesma
+//              malha compartilhada, cada parâmetro da malha entra na chave
+//              (ExecPolicy e opções de outra distribuição não), remoção LRU
+//              pelo limite em bytes e acesso concorrente.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/ErrorHandling/ErrorHandling.h>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBuilder.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DCache.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Random1D.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using Real  = FVMGridMaker::core::Real;
+using Index = FVMGridMaker::core::Index;
+using FVMGridMaker::core::ExecPolicy;
+using FVMGridMaker::grid::CenteringTag;
+using FVMGridMaker::grid::DistributionTag;
+using FVMGridMaker::grid::grid1d::api::Grid1D;
+using FVMGridMaker::grid::grid1d::builders::Grid1DBuilder;
+using FVMGridMaker::grid::grid1d::builders::Grid1DCache;
+using FVMGridMaker::grid::grid1d::patterns::distribution::Random1D;
+
+namespace {
+
+constexpr std::size_t kMiB = std::size_t(1) << 20;
+
+Random1D::Options seeded(std::uint64_t seed) {
+    Random1D::Options opt{};
+    opt.seed = seed;
+    return opt;
+}
+
+Grid1DBuilder base_builder(Index N = 100) {
+    Grid1DBuilder b;
+    b.setN(N).setDomain(0.0, 1.0)
+     .setDistribution(DistributionTag::Random1D)
+     .setCentering(CenteringTag::FaceCentered)
+     .setOption(seeded(7u));
+    return b;
+}
+
+std::size_t grid_bytes(Index N) {
+    return base_builder(N).build().storage().bytes();
+}
+
+} // namespace
+
+TEST(Grid1DCache, HitReturnsSameSharedGrid) {
+    Grid1DCache cache(16 * kMiB);
+    const auto b = base_builder();
+
+    const auto g1 = cache.get(b);
+    const auto g2 = cache.get(base_builder());   // builder distinto, mesmos campos
+    EXPECT_EQ(g1.get(), g2.get());
+
+    const Grid1D ref = b.build();
+    ASSERT_EQ(g1->nVolumes(), ref.nVolumes());
+    for (Index i = 0; i < ref.nFaces(); ++i) EXPECT_EQ(g1->face(i), ref.face(i));
+
+    const auto s = cache.stats();
+    EXPECT_EQ(s.hits, 1u);
+    EXPECT_EQ(s.misses, 1u);
+    EXPECT_EQ(s.entries, 1u);
+    EXPECT_EQ(s.bytes, g1->storage().bytes());
+}
+
+TEST(Grid1DCache, EveryGridParameterIsPartOfTheKey) {
+    Grid1DCache cache(64 * kMiB);
+    const std::vector<std::function<void(Grid1DBuilder&)>> variants = {
+        [](Grid1DBuilder&)   {},
+        [](Grid1DBuilder& b) { b.setN(101); },
+        [](Grid1DBuilder& b) { b.setDomain(0.0, 2.0); },
+        [](Grid1DBuilder& b) { b.setDomain(-0.0, 1.0); },
+        [](Grid1DBuilder& b) { b.setDistribution(DistributionTag::Uniform1D); },
+        [](Grid1DBuilder& b) { b.setCentering(CenteringTag::CellCentered); },
+        [](Grid1DBuilder& b) { b.setValidation(true); },
+        [](Grid1DBuilder& b) { b.setOption(seeded(8u)); },
+        [](Grid1DBuilder& b) { b.setOption(Random1D::Options{}); },
+        [](Grid1DBuilder& b) { auto o = seeded(7u); o.w_lo = 0.25; b.setOption(o); },
+        [](Grid1DBuilder& b) { auto o = seeded(7u); o.w_hi = 2.0;  b.setOption(o); },
+        [](Grid1DBuilder& b) {
+            auto o = seeded(7u);
+            o.policy = Random1D::Options::Policy::CounterBased;
+            b.setOption(o);
+        },
+    };
+
+    std::set<const Grid1D*> distinct;
+    for (const auto& v : variants) {
+        auto b = base_builder();
+        v(b);
+        distinct.insert(cache.get(b).get());
+    }
+    EXPECT_EQ(distinct.size(), variants.size());
+    EXPECT_EQ(cache.stats().misses, variants.size());
+    EXPECT_EQ(cache.stats().hits, 0u);
+
+    // Segunda passada: tudo acerta
+    for (const auto& v : variants) {
+        auto b = base_builder();
+        v(b);
+        EXPECT_EQ(distinct.count(cache.get(b).get()), 1u);
+    }
+    EXPECT_EQ(cache.stats().hits, variants.size());
+}
+
+TEST(Grid1DCache, KeyIgnoresExecPolicyAndInactiveOptions) {
+    Grid1DCache cache(16 * kMiB);
+
+    // Só a ExecPolicy muda (builder e opções): mesma malha, mesma entrada
+    const auto g = cache.get(base_builder());
+    for (ExecPolicy p : {ExecPolicy::Serial, ExecPolicy::Parallel}) {
+        auto b = base_builder();
+        auto o = seeded(7u);
+        o.exec = p;
+        b.setExecPolicy(p).setOption(o);
+        EXPECT_EQ(cache.get(b).get(), g.get());
+
+        const Grid1D ref = b.build();
+        for (Index i = 0; i < ref.nFaces(); ++i) EXPECT_EQ(g->face(i), ref.face(i));
+    }
+
+    // Opções guardadas para outra distribuição não separam entradas
+    auto uniform = [] {
+        Grid1DBuilder b;
+        b.setN(100).setDomain(0.0, 1.0)
+         .setDistribution(DistributionTag::Uniform1D)
+         .setCentering(CenteringTag::FaceCentered);
+        return b;
+    };
+    const auto u = cache.get(uniform());
+    auto with_random = uniform();
+    with_random.setOption(seeded(9u));
+    EXPECT_EQ(cache.get(with_random).get(), u.get());
+
+    EXPECT_EQ(cache.stats().misses, 2u);
+    EXPECT_EQ(cache.stats().entries, 2u);
+}
+
+TEST(Grid1DCache, EvictsLeastRecentlyUsedWithinByteLimit) {
+    const Index N = 1000;
+    Grid1DCache cache(2 * grid_bytes(N));   // cabem duas malhas
+
+    auto with_seed = [&](std::uint64_t s) { auto b = base_builder(N); b.setOption(seeded(s)); return b; };
+
+    const auto a  = cache.get(with_seed(1));
+    (void)cache.get(with_seed(2));
+    EXPECT_EQ(cache.get(with_seed(1)).get(), a.get());   // 1 vira o mais recente
+    (void)cache.get(with_seed(3));                      // remove 2
+
+    auto s = cache.stats();
+    EXPECT_EQ(s.entries, 2u);
+    EXPECT_EQ(s.evictions, 1u);
+    EXPECT_LE(s.bytes, cache.capacityBytes());
+
+    const auto misses = s.misses;
+    EXPECT_EQ(cache.get(with_seed(1)).get(), a.get());
+    EXPECT_EQ(cache.stats().misses, misses);
+    (void)cache.get(with_seed(2));
+    EXPECT_EQ(cache.stats().misses, misses + 1u);
+
+    // Ponteiro entregue sobrevive à remoção e ao clear()
+    cache.clear();
+    EXPECT_EQ(cache.stats().entries, 0u);
+    EXPECT_EQ(cache.stats().bytes, 0u);
+    EXPECT_EQ(a->nVolumes(), N);
+}
+
+TEST(Grid1DCache, OversizedGridIsNotStoredAndErrorsPropagate) {
+    Grid1DCache cache(grid_bytes(100) - 1u);
+    const auto g = cache.get(base_builder(100));
+    EXPECT_EQ(g->nVolumes(), 100u);
+    EXPECT_EQ(cache.stats().entries, 0u);
+    EXPECT_NE(cache.get(base_builder(100)).get(), g.get());
+
+    Grid1DBuilder bad;
+    bad.setN(0);
+    EXPECT_THROW((void)cache.get(bad), FVMGridMaker::error::FVMGException);
+    EXPECT_EQ(cache.stats().entries, 0u);
+}
+
+TEST(Grid1DCache, ConcurrentGetsShareGrids) {
+    constexpr std::size_t kThreads = 8;
+    constexpr std::size_t kIters   = 200;
+    constexpr std::size_t kKeys    = 4;
+    Grid1DCache cache(64 * kMiB);
+
+    std::vector<std::vector<const Grid1D*>> seen(kThreads, std::vector<const Grid1D*>(kKeys));
+    std::vector<std::thread> pool;
+    for (std::size_t t = 0; t < kThreads; ++t) {
+        pool.emplace_back([&, t] {
+            for (std::size_t it = 0; it < kIters; ++it) {
+                const std::size_t k = (t + it) % kKeys;
+                auto b = base_builder(5000);
+                b.setOption(seeded(k + 1u));
+                const auto g = cache.get(b);
+                if (it >= kIters - kKeys) seen[t][k] = g.get();
+            }
+        });
+    }
+    for (auto& th : pool) th.join();
+
+    const auto s = cache.stats();
+    EXPECT_EQ(s.hits + s.misses, kThreads * kIters);
+    EXPECT_EQ(s.entries, kKeys);
+    for (std::size_t k = 0; k < kKeys; ++k) {
+        for (std::size_t t = 1; t < kThreads; ++t) EXPECT_EQ(seen[t][k], seen[0][k]);
+    }
+}
@@ -0,0 +1,194 @@
+// ----------------------------------------------------------------------------
+// File: ut_Grid1DStream.cpp
+// Author: FVMGridMaker Team
+// Version: 1.1
+// Date: 2025-10-27
+// Description: Testes de unidade da geração em blocos (Grid1DStream):
+//              qualquer tamanho de bloco reproduz bit a bit a mesma malha,
+//              que coincide com build() para Uniform1D e Random1D em ambos
+//              os centerings; entradas não suportadas lançam (ou dão um
+//              stream sem blocos com Policy::Status).
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/ErrorHandling/ErrorHandling.h>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1DView.h>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBuilder.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Random1D.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using Real  = FVMGridMaker::core::Real;
+using Index = FVMGridMaker::core::Index;
+using FVMGridMaker::grid::CenteringTag;
+using FVMGridMaker::grid::DistributionTag;
+using FVMGridMaker::grid::grid1d::api::Grid1D;
+using FVMGridMaker::grid::grid1d::api::Grid1DView;
+using FVMGridMaker::grid::grid1d::builders::Grid1DBuilder;
+using FVMGridMaker::grid::grid1d::patterns::distribution::Random1D;
+
+namespace {
+
+std::vector<Real> as_vec(std::span<const Real> s) { return {s.begin(), s.end()}; }
+
+Grid1DBuilder make_builder(DistributionTag dist, CenteringTag cent, Index N) {
+    Grid1DBuilder b;
+    b.setN(N).setDomain(-1.0, 3.0).setDistribution(dist).setCentering(cent);
+    if (dist == DistributionTag::Random1D) {
+        Random1D::Options opt{};
+        opt.seed   = 20251027u;
+        opt.w_lo   = 0.4;
+        opt.w_hi   = 1.7;
+        opt.policy = Random1D::Options::Policy::CounterBased;
+        b.setOption(opt);
+    }
+    return b;
+}
+
+struct Arrays {
+    std::vector<Real> xf, xc, dF, dC;
+};
+
+// Concatena os blocos (sem os elementos compartilhados com o próximo) e
+// confere que cada bloco é exatamente o trecho [first, first+n) de @p ref.
+Arrays stream_all(const Grid1DBuilder& b, Index N, Index chunk, const Arrays* ref) {
+    Arrays out;
+    Index expected_first = 0;
+    b.buildChunked(chunk, [&](Index first, const Grid1DView& v) {
+        ASSERT_EQ(first, expected_first);
+        const std::size_t n = v.nVolumes();
+        ASSERT_GT(n, 0u);
+        ASSERT_LE(n, chunk);
+        if (ref) {
+            EXPECT_EQ(as_vec(v.faces()),         as_vec(std::span(ref->xf).subspan(first, n + 1u)));
+            EXPECT_EQ(as_vec(v.centers()),       as_vec(std::span(ref->xc).subspan(first, n)));
+            EXPECT_EQ(as_vec(v.deltasFaces()),   as_vec(std::span(ref->dF).subspan(first, n)));
+            EXPECT_EQ(as_vec(v.deltasCenters()), as_vec(std::span(ref->dC).subspan(first, n + 1u)));
+        }
+        const auto shared = static_cast<std::ptrdiff_t>(first + n == N ? 0 : 1);
+        out.xf.insert(out.xf.end(), v.faces().begin(), v.faces().end() - shared);
+        out.xc.insert(out.xc.end(), v.centers().begin(), v.centers().end());
+        out.dF.insert(out.dF.end(), v.deltasFaces().begin(), v.deltasFaces().end());
+        out.dC.insert(out.dC.end(), v.deltasCenters().begin(), v.deltasCenters().end() - shared);
+        expected_first += n;
+    });
+    return out;
+}
+
+// Tolerância absoluta na escala do domínio [-1, 3] (coordenadas próximas
+// de zero perdem dígitos relativos por cancelamento em A + i·dx)
+void expect_near_domain(const std::vector<Real>& a, std::span<const Real> b) {
+    ASSERT_EQ(a.size(), b.size());
+    for (std::size_t i = 0; i < a.size(); ++i) EXPECT_NEAR(a[i], b[i], 1e-13) << "i=" << i;
+}
+
+} // namespace
+
+TEST(Grid1DStream, ChunksMatchBuildForAnyChunkSize) {
+    for (auto dist : {DistributionTag::Uniform1D, DistributionTag::Random1D}) {
+        for (auto cent : {CenteringTag::FaceCentered, CenteringTag::CellCentered}) {
+            for (Index N : {1u, 2u, 5u, 4099u, 20011u}) {
+                SCOPED_TRACE(testing::Message()
+                             << "dist=" << static_cast<int>(dist)
+                             << " cent=" << static_cast<int>(cent) << " N=" << N);
+                const auto b = make_builder(dist, cent, N);
+
+                // Bloco único x build(): a distribuição registrada neste
+                // binário pode ser compilada com outras opções de ponto
+                // flutuante (ex.: FMA) que a biblioteca; tolera arredondamento.
+                const Arrays whole = stream_all(b, N, N, nullptr);
+                const Grid1D g     = b.build();
+                expect_near_domain(whole.xf, g.faces());
+                expect_near_domain(whole.xc, g.centers());
+                expect_near_domain(whole.dF, g.deltasFaces());
+                expect_near_domain(whole.dC, g.deltasCenters());
+
+                // Qualquer divisão em blocos: idêntica bit a bit ao bloco único
+                for (Index chunk : {1u, 2u, 7u, 1000u, 4096u, 30000u}) {
+                    SCOPED_TRACE(testing::Message() << "chunk=" << chunk);
+                    const Arrays parts = stream_all(b, N, chunk, &whole);
+                    EXPECT_EQ(parts.xf, whole.xf);
+                    EXPECT_EQ(parts.xc, whole.xc);
+                    EXPECT_EQ(parts.dF, whole.dF);
+                    EXPECT_EQ(parts.dC, whole.dC);
+                }
+            }
+        }
+    }
+}
+
+TEST(Grid1DStream, PullInterfaceReportsPosition) {
+    auto s = make_builder(DistributionTag::Random1D, CenteringTag::CellCentered, 10).stream(4);
+    EXPECT_EQ(s.nVolumes(), 10u);
+
+    ASSERT_TRUE(s.next());
+    EXPECT_EQ(s.first(), 0u);
+    EXPECT_EQ(s.chunk().nVolumes(), 4u);
+    EXPECT_EQ(s.chunk().face(0), -1.0);
+    EXPECT_FALSE(s.last());
+
+    ASSERT_TRUE(s.next());
+    EXPECT_EQ(s.first(), 4u);
+    ASSERT_TRUE(s.next());
+    EXPECT_EQ(s.first(), 8u);
+    EXPECT_EQ(s.chunk().nVolumes(), 2u);
+    EXPECT_TRUE(s.last());
+    EXPECT_EQ(s.chunk().face(2), 3.0);
+    EXPECT_FALSE(s.next());
+}
+
+TEST(Grid1DStream, RejectsUnsupportedInputs) {
+    using FVMGridMaker::error::FVMGException;
+    const auto u = make_builder(DistributionTag::Uniform1D, CenteringTag::FaceCentered, 8);
+    EXPECT_THROW((void)u.stream(0), FVMGException);
+
+    // Random1D sem Options ou com o gerador sequencial (mt19937)
+    Grid1DBuilder r;
+    r.setN(8).setDomain(0.0, 1.0).setDistribution(DistributionTag::Random1D);
+    EXPECT_THROW((void)r.stream(4), FVMGException);
+    r.setOption(Random1D::Options{});
+    EXPECT_THROW((void)r.stream(4), FVMGException);
+
+    Grid1DBuilder bad;
+    bad.setN(0);
+    EXPECT_THROW((void)bad.stream(4), FVMGException);
+}
+
+TEST(Grid1DStream, UnsupportedInputsGiveEmptyStreamUnderStatusPolicy) {
+    namespace err = FVMGridMaker::error;
+    const auto original = err::Config::get();
+    err::ErrorConfig cfg;
+    cfg.policy = err::Policy::Status;
+    err::Config::set(cfg);
+    (void)err::ErrorManager::flush();
+
+    const auto u = make_builder(DistributionTag::Uniform1D, CenteringTag::FaceCentered, 8);
+    Grid1DBuilder r;
+    r.setN(8).setDomain(0.0, 1.0).setDistribution(DistributionTag::Random1D);
+    Grid1DBuilder bad;
+    bad.setN(0);
+
+    for (auto s : {u.stream(0), r.stream(4), bad.stream(4)}) {
+        EXPECT_FALSE(s.next());
+        EXPECT_EQ(s.nVolumes(), Index{0});
+    }
+    Index calls = 0;
+    u.buildChunked(0, [&](Index, const Grid1DView&) { ++calls; });
+    EXPECT_EQ(calls, Index{0});
+
+    EXPECT_EQ(err::ErrorManager::flush().size(), 4u);
+    err::Config::set(*original);
+}
@@ -0,0 +1,174 @@
+// ----------------------------------------------------------------------------
+// File: ut_ClosureKernel1D.cpp
+// Author: FVMGridMaker Team
+// Version: 1.1
+// Date: 2025-10-27
+// Description: Testes de unidade do kernel fundido de fechamento 1D:
+//              igualdade bit a bit com a referência escalar em várias
+//              passagens, para tamanhos que cruzam blocos e lanes SIMD;
+//              verificação embutida (check) da menor posição inválida.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Centering/CellCentered.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Centering/ClosureKernel1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Centering/FaceCentered.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using Real = FVMGridMaker::core::Real;
+using FVMGridMaker::core::ExecPolicy;
+namespace centering = FVMGridMaker::grid::grid1d::patterns::centering;
+
+namespace {
+
+// Sequência estritamente crescente e não uniforme
+std::vector<Real> ramp(std::size_t n) {
+    std::vector<Real> v(n);
+    Real x = Real(-1);
+    for (std::size_t i = 0; i < n; ++i) {
+        x += Real(1) + Real(0.5) * std::sin(static_cast<Real>(i));
+        v[i] = x;
+    }
+    return v;
+}
+
+struct Closure {
+    std::vector<Real> xf, xc, dF, dC;
+    explicit Closure(std::size_t N) : xf(N + 1), xc(N), dF(N), dC(N + 1) {}
+};
+
+// Referência: passagens separadas, como o fechamento original
+Closure reference_from_faces(const std::vector<Real>& xf) {
+    const std::size_t N = xf.size() - 1;
+    Closure r(N);
+    r.xf = xf;
+    for (std::size_t i = 0; i < N; ++i) r.xc[i] = Real(0.5) * (xf[i] + xf[i + 1]);
+    for (std::size_t i = 0; i < N; ++i) r.dF[i] = xf[i + 1] - xf[i];
+    r.dC[0] = r.xc[0] - xf[0];
+    for (std::size_t i = 1; i < N; ++i) r.dC[i] = r.xc[i] - r.xc[i - 1];
+    r.dC[N] = xf[N] - r.xc[N - 1];
+    return r;
+}
+
+Closure reference_from_centers(const std::vector<Real>& xc, Real xL, Real xR) {
+    const std::size_t N = xc.size();
+    Closure r(N);
+    r.xc = xc;
+    r.xf[0] = xL;
+    r.xf[N] = xR;
+    for (std::size_t i = 1; i < N; ++i) r.xf[i] = Real(0.5) * (xc[i - 1] + xc[i]);
+    for (std::size_t i = 0; i < N; ++i) r.dF[i] = r.xf[i + 1] - r.xf[i];
+    r.dC[0] = xc[0] - xL;
+    for (std::size_t i = 1; i < N; ++i) r.dC[i] = xc[i] - xc[i - 1];
+    r.dC[N] = xR - xc[N - 1];
+    return r;
+}
+
+const std::size_t kSizes[] = {1, 2, 3, 7, 8, 9, 17,
+                              centering::kClosureBlock - 1,
+                              centering::kClosureBlock,
+                              centering::kClosureBlock + 1,
+                              3 * centering::kClosureBlock + 5,
+                              100003};
+
+} // namespace
+
+TEST(ClosureKernel1D, FromFacesMatchesReference) {
+    for (std::size_t N : kSizes) {
+        const auto xf  = ramp(N + 1);
+        const auto ref = reference_from_faces(xf);
+        for (ExecPolicy p : {ExecPolicy::Serial, ExecPolicy::Parallel, ExecPolicy::Auto}) {
+            Closure got(N);
+            centering::close_from_faces(xf, got.xc, got.dF, got.dC, p);
+            EXPECT_EQ(got.xc, ref.xc) << "N=" << N;
+            EXPECT_EQ(got.dF, ref.dF) << "N=" << N;
+            EXPECT_EQ(got.dC, ref.dC) << "N=" << N;
+        }
+    }
+}
+
+TEST(ClosureKernel1D, FromCentersMatchesReference) {
+    for (std::size_t N : kSizes) {
+        const auto xc  = ramp(N);
+        const Real xL  = xc.front() - Real(0.25);
+        const Real xR  = xc.back()  + Real(0.75);
+        const auto ref = reference_from_centers(xc, xL, xR);
+        for (ExecPolicy p : {ExecPolicy::Serial, ExecPolicy::Parallel, ExecPolicy::Auto}) {
+            Closure got(N);
+            centering::close_from_centers(xc, xL, xR, got.xf, got.dF, got.dC, p);
+            EXPECT_EQ(got.xf, ref.xf) << "N=" << N;
+            EXPECT_EQ(got.dF, ref.dF) << "N=" << N;
+            EXPECT_EQ(got.dC, ref.dC) << "N=" << N;
+        }
+    }
+}
+
+TEST(ClosureKernel1D, CenteringFunctorsKeepEdgeSemantics) {
+    // CellCentered: bordas por meia-largura
+    const std::vector<Real> xc{0.5, 1.5, 3.5};
+    Closure c(3);
+    centering::CellCentered{}(xc, c.xf, c.dF, c.dC);
+    EXPECT_EQ(c.xf, (std::vector<Real>{0.0, 1.0, 2.5, 4.5}));
+    EXPECT_EQ(c.dF, (std::vector<Real>{1.0, 1.5, 2.0}));
+    EXPECT_EQ(c.dC, (std::vector<Real>{0.5, 1.0, 2.0, 1.0}));
+
+    // N == 1: faces degeneradas no centro
+    const std::vector<Real> one{2.0};
+    Closure d(1);
+    centering::CellCentered{}(one, d.xf, d.dF, d.dC);
+    EXPECT_EQ(d.xf, (std::vector<Real>{2.0, 2.0}));
+    EXPECT_EQ(d.dF, (std::vector<Real>{0.0}));
+
+    // FaceCentered == kernel
+    const auto xf = ramp(1001);
+    Closure f(1000);
+    centering::FaceCentered{ExecPolicy::Parallel}(xf, f.xc, f.dF, f.dC);
+    const auto ref = reference_from_faces(xf);
+    EXPECT_EQ(f.xc, ref.xc);
+    EXPECT_EQ(f.dC, ref.dC);
+}
+
+TEST(ClosureKernel1D, CheckReportsSmallestInvalidPosition) {
+    constexpr std::size_t N = 3 * centering::kClosureBlock + 5;
+    for (ExecPolicy p : {ExecPolicy::Serial, ExecPolicy::Parallel}) {
+        Closure got(N);
+        auto xf = ramp(N + 1);
+        EXPECT_FALSE(centering::close_from_faces(xf, got.xc, got.dF, got.dC, p, true));
+
+        // sem check: nada é reportado, mesmo com violação
+        xf[N - 1] = xf[N - 2];
+        EXPECT_FALSE(centering::close_from_faces(xf, got.xc, got.dF, got.dC, p));
+        EXPECT_EQ(centering::close_from_faces(xf, got.xc, got.dF, got.dC, p, true), N - 2);
+
+        // a menor posição prevalece sobre a de outro bloco/thread
+        xf[centering::kClosureBlock + 3] = xf[centering::kClosureBlock + 4];
+        EXPECT_EQ(centering::close_from_faces(xf, got.xc, got.dF, got.dC, p, true),
+                  centering::kClosureBlock + 3);
+
+        // centros: dC[0] <= 0 (centro à esquerda da face xL) e dC[N] <= 0
+        auto xc = ramp(N);
+        EXPECT_FALSE(centering::close_from_centers(xc, xc.front() - 1, xc.back() + 1,
+                                                   got.xf, got.dF, got.dC, p, true));
+        EXPECT_EQ(centering::close_from_centers(xc, xc.front(), xc.back() + 1,
+                                                got.xf, got.dF, got.dC, p, true), 0u);
+        EXPECT_EQ(centering::close_from_centers(xc, xc.front() - 1, xc.back(),
+                                                got.xf, got.dF, got.dC, p, true), N);
+        xc[2 * centering::kClosureBlock] = xc[2 * centering::kClosureBlock - 1];
+        EXPECT_EQ(centering::close_from_centers(xc, xc.front() - 1, xc.back() + 1,
+                                                got.xf, got.dF, got.dC, p, true),
+                  2 * centering::kClosureBlock);
+    }
+}
@@ -20,6 +20,10 @@ TEST(Tags1D, ToStringCentering) {
 TEST(Tags1D, ToStringDistribution) {
     EXPECT_EQ(to_string(DistributionTag::Uniform1D), std::string_view{"Uniform1D"});
     EXPECT_EQ(to_string(DistributionTag::Random1D),  std::string_view{"Random1D"});
+    EXPECT_EQ(to_string(DistributionTag::Geometric1D), std::string_view{"Geometric1D"});
+    EXPECT_EQ(to_string(DistributionTag::Vinokur1D),   std::string_view{"Vinokur1D"});
+    EXPECT_EQ(to_string(DistributionTag::Equidistribution1D),
+              std::string_view{"Equidistribution1D"});
 
     auto bad = static_cast<DistributionTag>(255);
     EXPECT_EQ(to_string(bad), std::string_view{"Unknown"});
@@ -0,0 +1,252 @@
+// ----------------------------------------------------------------------------
+// File: ut_EquidistributionGrid1D.cpp
+// Author: FVMGridMaker Team
+// Version: 1.1
+// Date: 2025-10-27
+// Description: Testes de unidade da distribuição Equidistribution1D: mesma
+//              integral do monitor em cada célula, inversa analítica para
+//              w linear, função monitora x densidade amostrada, densidade em
+//              posições dadas, regiões com w = 0, monitor via DistOptions
+//              e cache (sem armazenar). Política de execução e builders:
+//              ut_FaceKernelDistribution1D.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/ConfigureDistribution.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/DistOptions.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBuilder.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DCache.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/ConceptsDistribution.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Equidistribution1D.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using Real  = FVMGridMaker::core::Real;
+using Index = FVMGridMaker::core::Index;
+using FVMGridMaker::core::ExecPolicy;
+using FVMGridMaker::grid::DistributionTag;
+using FVMGridMaker::grid::grid1d::builders::DistOptions;
+using FVMGridMaker::grid::grid1d::builders::Grid1DBuilder;
+using FVMGridMaker::grid::grid1d::builders::Grid1DCache;
+using FVMGridMaker::grid::grid1d::builders::configureDistribution;
+using FVMGridMaker::grid::grid1d::patterns::distribution::Distribution1D;
+using FVMGridMaker::grid::grid1d::patterns::distribution::Equidistribution1D;
+
+static_assert(Distribution1D<Equidistribution1D>);
+
+namespace {
+
+std::vector<Real> as_vec(std::span<const Real> s) { return {s.begin(), s.end()}; }
+
+Equidistribution1D::Options density(std::vector<Real> w, std::vector<Real> x = {},
+                                    ExecPolicy exec = ExecPolicy::Auto) {
+    Equidistribution1D::Options o{};
+    o.density   = std::move(w);
+    o.positions = std::move(x);
+    o.exec      = exec;
+    return o;
+}
+
+// ∫_a^b de w linear por partes nos nós (px, pw)
+Real integral(const std::vector<Real>& px, const std::vector<Real>& pw, Real a, Real b) {
+    auto w_at = [&](Real x) {
+        const auto k = static_cast<std::size_t>(
+            std::upper_bound(px.begin(), px.end() - 1, x) - px.begin()) - 1u;
+        const Real t = (x - px[k]) / (px[k + 1] - px[k]);
+        return pw[k] + t * (pw[k + 1] - pw[k]);
+    };
+    Real s  = 0.0;
+    Real lo = a;
+    for (std::size_t k = 1; k < px.size() && lo < b; ++k) {
+        if (px[k] <= lo) continue;
+        const Real hi = std::min(px[k], b);
+        s += 0.5 * (w_at(lo) + w_at(hi)) * (hi - lo);
+        lo = hi;
+    }
+    return s;
+}
+
+void expect_increasing(const std::vector<Real>& xf) {
+    for (std::size_t i = 0; i + 1 < xf.size(); ++i) ASSERT_LT(xf[i], xf[i + 1]) << "i=" << i;
+}
+
+} // namespace
+
+TEST(Equidistribution1D, EqualIntegralPerCell) {
+    const std::vector<Real> px = {0.0, 0.5, 1.0, 1.5, 2.0, 2.5, 3.0};
+    const std::vector<Real> pw = {1.0, 8.0, 0.5, 0.5, 20.0, 2.0, 1.0};
+    const Index N = 257;
+    const auto  o  = density(pw);
+    const auto  xf = Equidistribution1D::faces(N, 0.0, 3.0, &o);
+
+    ASSERT_EQ(xf.size(), N + 1);
+    EXPECT_EQ(xf.front(), 0.0);
+    EXPECT_EQ(xf.back(),  3.0);
+    expect_increasing(xf);
+
+    const Real T = integral(px, pw, 0.0, 3.0);
+    for (std::size_t i = 0; i < N; ++i) {
+        EXPECT_NEAR(integral(px, pw, xf[i], xf[i + 1]), T / N, 1e-12) << "i=" << i;
+    }
+}
+
+TEST(Equidistribution1D, LinearDensityMatchesClosedForm) {
+    // w = 1 + x em [0, 1]: W(x) = x + x²/2 → x_i = -1 + sqrt(1 + 3i/N)
+    const Index N = 1000;
+    const auto  o  = density({1.0, 2.0});
+    const auto  xf = Equidistribution1D::faces(N, 0.0, 1.0, &o);
+    for (std::size_t i = 0; i <= N; ++i) {
+        const Real ref = -1.0 + std::sqrt(1.0 + 3.0 * static_cast<Real>(i) / N);
+        EXPECT_NEAR(xf[i], ref, 1e-14) << "i=" << i;
+    }
+}
+
+TEST(Equidistribution1D, ConstantMonitorGivesUniformGrid) {
+    const Index N = 100;
+    Equidistribution1D::Options m{};
+    m.monitor = [](Real) { return 3.0; };
+    for (const auto& o : {m, density({2.0, 2.0, 2.0}), Equidistribution1D::Options{}}) {
+        const auto xf = Equidistribution1D::faces(N, -1.0, 4.0, &o);
+        for (std::size_t i = 0; i <= N; ++i) {
+            EXPECT_NEAR(xf[i], -1.0 + 5.0 * static_cast<Real>(i) / N, 1e-13) << "i=" << i;
+        }
+    }
+    // Sem Options: w = 1
+    const auto xf = Equidistribution1D::faces(N, -1.0, 4.0);
+    EXPECT_NEAR(xf[37], -1.0 + 5.0 * 0.37, 1e-13);
+}
+
+TEST(Equidistribution1D, MonitorMatchesSampledDensity) {
+    const Index N = 400;
+    const Index M = 1601;
+    auto w = [](Real x) { return 1.0 + 50.0 * std::exp(-200.0 * (x - 0.3) * (x - 0.3)); };
+
+    Equidistribution1D::Options m{};
+    m.monitor = w;
+    m.samples = M;
+
+    // Mesmos nós que a amostragem interna: lerp(A, B, k·(1/(M-1)))
+    std::vector<Real> s(M);
+    const Real inv = 1.0 / static_cast<Real>(M - 1);
+    for (std::size_t k = 0; k < M; ++k) s[k] = w(std::lerp(0.0, 1.0, static_cast<Real>(k) * inv));
+    s.back() = w(1.0);
+    const auto d = density(s);
+
+    const auto xf = Equidistribution1D::faces(N, 0.0, 1.0, &m);
+    EXPECT_EQ(xf, Equidistribution1D::faces(N, 0.0, 1.0, &d));
+    expect_increasing(xf);
+
+    // Refinada perto do pico
+    const auto it = std::lower_bound(xf.begin(), xf.end(), 0.3);
+    const auto i  = static_cast<std::size_t>(it - xf.begin());
+    EXPECT_LT(xf[i] - xf[i - 1], 0.1 * (xf[1] - xf[0]));
+
+    // samples = 0 → 4N + 1 amostras
+    m.samples = 0;
+    EXPECT_EQ(Equidistribution1D::faces(N, 0.0, 1.0, &m).size(), N + 1);
+}
+
+TEST(Equidistribution1D, DensityAtPositionsExtendsToDomain) {
+    // Ex.: densidade nos centros de uma malha anterior
+    const auto o   = density({1.0, 3.0, 1.0}, {0.2, 0.5, 0.8});
+    const auto ref = density({1.0, 1.0, 3.0, 1.0, 1.0}, {0.0, 0.2, 0.5, 0.8, 1.0});
+    const Index N = 64;
+    EXPECT_EQ(Equidistribution1D::faces(N, 0.0, 1.0, &o),
+              Equidistribution1D::faces(N, 0.0, 1.0, &ref));
+
+    // Posições cobrindo [A, B]: sem extensão; posições não uniformes
+    const std::vector<Real> px = {0.0, 0.1, 0.15, 0.7, 1.0};
+    const std::vector<Real> pw = {1.0, 4.0, 9.0, 2.0, 1.0};
+    const auto q  = density(pw, px);
+    const auto xf = Equidistribution1D::faces(N, 0.0, 1.0, &q);
+    const Real T  = integral(px, pw, 0.0, 1.0);
+    for (std::size_t i = 0; i < N; ++i) {
+        EXPECT_NEAR(integral(px, pw, xf[i], xf[i + 1]), T / N, 1e-13) << "i=" << i;
+    }
+}
+
+TEST(Equidistribution1D, ZeroDensityRegionStaysInOneCell) {
+    // w = 0 em [1, 2]: nenhuma face no interior da região
+    const auto o = density({1.0, 0.0, 0.0, 1.0});
+    for (const Index N : {Index(2), Index(4), Index(9), Index(100)}) {
+        const auto xf = Equidistribution1D::faces(N, 0.0, 3.0, &o);
+        expect_increasing(xf);
+        const auto inside = std::count_if(xf.begin(), xf.end(),
+                                          [](Real x) { return x > 1.0 && x < 2.0; });
+        EXPECT_EQ(inside, 0) << "N=" << N;
+    }
+}
+
+TEST(Equidistribution1D, MonitorOptionMatchesSampledDensity) {
+    // w linear por partes com nós em 0, ½, 1: 3 amostras do monitor
+    // reproduzem exatamente a densidade {1, 10, 1}
+    const Index N = 500;
+    const auto  o  = density({1.0, 10.0, 1.0});
+    const auto  xf = Equidistribution1D::faces(N, 0.0, 1.0, &o);
+
+    Grid1DBuilder b;
+    b.setN(N).setDomain(0.0, 1.0);
+    configureDistribution(b, DistOptions::Equidistribution1D_Monitor(
+        [](Real x) { return 1.0 + 9.0 * (1.0 - std::abs(2.0 * x - 1.0)); }, 3));
+    EXPECT_EQ(as_vec(b.build().faces()), xf);
+}
+
+TEST(Equidistribution1D, CacheBuildsWithoutStoring) {
+    Grid1DCache cache(std::size_t(1) << 20);
+    Grid1DBuilder b;
+    b.setN(64).setDomain(0.0, 1.0).setOption(density({1.0, 4.0}))
+     .setDistribution(DistributionTag::Equidistribution1D);
+
+    const auto g1 = cache.get(b);
+    const auto g2 = cache.get(b);
+    EXPECT_NE(g1, g2);
+    EXPECT_EQ(as_vec(g1->faces()), as_vec(g2->faces()));
+
+    const auto st = cache.stats();
+    EXPECT_EQ(st.hits,    0u);
+    EXPECT_EQ(st.misses,  2u);
+    EXPECT_EQ(st.entries, 0u);
+}
+
+TEST(Equidistribution1D, InvalidInputsThrow) {
+    std::vector<Real> xf(11);
+    const Real nan = std::numeric_limits<Real>::quiet_NaN();
+    const Real inf = std::numeric_limits<Real>::infinity();
+
+    Equidistribution1D::Options bad_samples{};
+    bad_samples.monitor = [](Real) { return 1.0; };
+    bad_samples.samples = 1;
+    Equidistribution1D::Options negative_monitor{};
+    negative_monitor.monitor = [](Real x) { return x - 0.5; };
+
+    for (const auto& o : {density({1.0, -1.0}), density({1.0, nan}), density({inf, 1.0}),
+                          density({0.0, 0.0, 0.0}), density({1.0}),
+                          density({1.0, 1.0}, {0.0}),
+                          density({1.0, 1.0}, {0.5, 0.5}),
+                          density({1.0, 1.0}, {-0.1, 0.5}),
+                          density({1.0, 1.0}, {0.5, 1.1}),
+                          bad_samples, negative_monitor}) {
+        EXPECT_THROW(Equidistribution1D::faces_into(10, 0.0, 1.0, xf, &o), std::invalid_argument);
+    }
+
+    EXPECT_THROW(Equidistribution1D::faces_into(0, 0.0, 1.0, xf), std::invalid_argument);
+    EXPECT_THROW(Equidistribution1D::faces_into(10, 1.0, 1.0, xf), std::invalid_argument);
+    EXPECT_THROW(Equidistribution1D::faces_into(9, 0.0, 1.0, xf), std::invalid_argument);
+}
@@ -0,0 +1,180 @@
+// ----------------------------------------------------------------------------
+// File: ut_FaceKernelDistribution1D.cpp
+// Author: FVMGridMaker Team
+// Version: 1.0
+// Date: 2025-10-27
+// Description: Testes tipados das distribuições sobre FaceKernelDistribution1D
+//              (Geometric1D, Vinokur1D, Equidistribution1D): mesmo resultado
+//              para qualquer ExecPolicy, centros = médias das faces e
+//              equivalência com o registro (Grid1DBuilder/DistOptions) e o
+//              Grid1DBuilderT.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/Builders/ConfigureDistribution.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/DistOptions.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBuilder.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBuilderT.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Centering/FaceCentered.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Equidistribution1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Geometric1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Vinokur1D.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using Real  = FVMGridMaker::core::Real;
+using Index = FVMGridMaker::core::Index;
+using FVMGridMaker::core::ExecPolicy;
+using FVMGridMaker::grid::CenteringTag;
+using FVMGridMaker::grid::DistributionTag;
+using FVMGridMaker::grid::grid1d::api::Grid1D;
+using FVMGridMaker::grid::grid1d::builders::DistOptions;
+using FVMGridMaker::grid::grid1d::builders::Grid1DBuilder;
+using FVMGridMaker::grid::grid1d::builders::Grid1DBuilderT;
+using FVMGridMaker::grid::grid1d::builders::configureDistribution;
+using FVMGridMaker::grid::grid1d::patterns::centering::FaceCentered;
+using FVMGridMaker::grid::grid1d::patterns::distribution::Equidistribution1D;
+using FVMGridMaker::grid::grid1d::patterns::distribution::Geometric1D;
+using FVMGridMaker::grid::grid1d::patterns::distribution::Vinokur1D;
+
+namespace {
+
+std::vector<Real> as_vec(std::span<const Real> s) { return {s.begin(), s.end()}; }
+
+// Por distribuição: opções de referência (e as mesmas via DistOptions) e
+// casos difíceis para a comparação entre políticas.
+struct GeometricCase {
+    using D = Geometric1D;
+    static constexpr DistributionTag kTag = DistributionTag::Geometric1D;
+
+    static D::Options sample() { D::Options o{}; o.ratio = 1.03; return o; }
+    static DistOptions dist_options() { return DistOptions::Geometric1D_Ratio(1.03); }
+
+    // r ≈ 1 dos dois lados: orientação de A e de B
+    static std::vector<D::Options> exec_cases() {
+        D::Options a{}, b{};
+        a.ratio = 1.00001;
+        b.ratio = 0.99999;
+        return {a, b};
+    }
+};
+
+struct VinokurCase {
+    using D = Vinokur1D;
+    static constexpr DistributionTag kTag = DistributionTag::Vinokur1D;
+
+    static D::Options sample() {
+        D::Options o{};
+        o.first_width = 1e-4;
+        o.last_width  = 5e-3;
+        return o;
+    }
+    static DistOptions dist_options() { return DistOptions::Vinokur1D_Widths(1e-4, 5e-3); }
+
+    static std::vector<D::Options> exec_cases() {
+        D::Options a{}, b{};
+        a.first_width = 1e-8; a.last_width = 1e-6;
+        b.first_width = 1e-4; b.last_width = 1e-3;
+        return {a, b};
+    }
+};
+
+struct EquidistributionCase {
+    using D = Equidistribution1D;
+    static constexpr DistributionTag kTag = DistributionTag::Equidistribution1D;
+
+    static D::Options sample() { D::Options o{}; o.density = {1.0, 10.0, 1.0}; return o; }
+    static DistOptions dist_options() {
+        return DistOptions::Equidistribution1D_Density({1.0, 10.0, 1.0});
+    }
+
+    // Função monitora (amostrada em paralelo) e densidade longa
+    static std::vector<D::Options> exec_cases() {
+        D::Options m{}, d{};
+        m.monitor = [](Real x) { return 1.0 + 1e3 * std::exp(-1e4 * (x - 0.7) * (x - 0.7)); };
+        d.density.resize(200001);
+        for (std::size_t k = 0; k < d.density.size(); ++k) {
+            d.density[k] = 1.0 + static_cast<Real>(k % 17);
+        }
+        return {m, d};
+    }
+};
+
+} // namespace
+
+template <class Case>
+class FaceKernelDistribution1D : public ::testing::Test {};
+
+using Cases = ::testing::Types<GeometricCase, VinokurCase, EquidistributionCase>;
+TYPED_TEST_SUITE(FaceKernelDistribution1D, Cases);
+
+TYPED_TEST(FaceKernelDistribution1D, ExecPolicyDoesNotChangeResult) {
+    using D = typename TypeParam::D;
+    const Index N = 300001;
+    for (const auto& base : TypeParam::exec_cases()) {
+        auto s = base, p = base;
+        s.exec = ExecPolicy::Serial;
+        p.exec = ExecPolicy::Parallel;
+        EXPECT_EQ(D::faces(N, 0.0, 1.0, &s),   D::faces(N, 0.0, 1.0, &p));
+        EXPECT_EQ(D::centers(N, 0.0, 1.0, &s), D::centers(N, 0.0, 1.0, &p));
+    }
+}
+
+TYPED_TEST(FaceKernelDistribution1D, CentersAreFaceMidpoints) {
+    using D = typename TypeParam::D;
+    const Index N  = 333;
+    const auto  o  = TypeParam::sample();
+    const auto  xf = D::faces(N, 0.0, 5.0, &o);
+    const auto  xc = D::centers(N, 0.0, 5.0, &o);
+    for (std::size_t i = 0; i < N; ++i) EXPECT_EQ(xc[i], 0.5 * (xf[i] + xf[i + 1]));
+
+    // Functor e *_into escrevem os mesmos valores
+    std::vector<Real> f(N + 1), c(N);
+    const D d(o);
+    d.makeFaces(N, 0.0, 5.0, f);
+    d.makeCenters(N, 0.0, 5.0, c);
+    EXPECT_EQ(f, xf);
+    EXPECT_EQ(c, xc);
+}
+
+TYPED_TEST(FaceKernelDistribution1D, BuildersMatchDistribution) {
+    using D = typename TypeParam::D;
+    const Index N  = 500;
+    const auto  o  = TypeParam::sample();
+    const auto  xf = D::faces(N, 0.0, 1.0, &o);
+
+    // Registro via setOption (ordem de setOption/setDistribution indiferente)
+    Grid1DBuilder b1;
+    b1.setN(N).setDomain(0.0, 1.0).setOption(o).setDistribution(TypeParam::kTag);
+    EXPECT_EQ(as_vec(b1.build().faces()), xf);
+
+    // DistOptions + configureDistribution
+    Grid1DBuilder b2;
+    b2.setN(N).setDomain(0.0, 1.0);
+    configureDistribution(b2, TypeParam::dist_options());
+    EXPECT_EQ(as_vec(b2.build().faces()), xf);
+
+    // Cell-centered: centros = médias das faces
+    Grid1DBuilder b3 = b1;
+    b3.setCentering(CenteringTag::CellCentered);
+    EXPECT_EQ(as_vec(b3.build().centers()), D::centers(N, 0.0, 1.0, &o));
+
+    // Builder estático
+    const Grid1D t = Grid1DBuilderT<D, FaceCentered>(D(o)).setN(N).setDomain(0.0, 1.0).build();
+    EXPECT_EQ(as_vec(t.faces()), xf);
+}
@@ -0,0 +1,210 @@
+// ----------------------------------------------------------------------------
+// File: ut_GeometricGrid1D.cpp
+// Author: FVMGridMaker Team
+// Version: 1.2
+// Date: 2025-10-27
+// Description: Testes de unidade da distribuição Geometric1D: forma fechada
+//              contra referência em long double, larguras em progressão
+//              geométrica, menor célula abaixo da resolução rejeitada,
+//              faixa/face escalar e GeometricGrid1D. Política de execução
+//              e builders: ut_FaceKernelDistribution1D.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/API/AnalyticGrid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DBuilder.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/ConceptsDistribution.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Geometric1D.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using Real  = FVMGridMaker::core::Real;
+using Index = FVMGridMaker::core::Index;
+using FVMGridMaker::core::ExecPolicy;
+using FVMGridMaker::grid::DistributionTag;
+using FVMGridMaker::grid::grid1d::api::GeometricGrid1D;
+using FVMGridMaker::grid::grid1d::api::Grid1D;
+using FVMGridMaker::grid::grid1d::builders::Grid1DBuilder;
+using FVMGridMaker::grid::grid1d::patterns::distribution::Distribution1D;
+using FVMGridMaker::grid::grid1d::patterns::distribution::Geometric1D;
+
+static_assert(Distribution1D<Geometric1D>);
+
+namespace {
+
+constexpr Real kEps = std::numeric_limits<Real>::epsilon();
+
+std::vector<Real> as_vec(std::span<const Real> s) { return {s.begin(), s.end()}; }
+
+Geometric1D::Options opts(Real r, ExecPolicy exec = ExecPolicy::Auto) {
+    Geometric1D::Options o{};
+    o.ratio = r;
+    o.exec  = exec;
+    return o;
+}
+
+// Referência: expm1(i·ln r)/expm1(N·ln r) em long double (sem cancelamento)
+long double ref_frac(std::size_t i, std::size_t N, Real r) {
+    const long double q = std::log1p(static_cast<long double>(r) - 1.0L);
+    if (q == 0.0L) return static_cast<long double>(i) / static_cast<long double>(N);
+    return std::expm1(static_cast<long double>(i) * q) /
+           std::expm1(static_cast<long double>(N) * q);
+}
+
+// Menor célula de [A, B] acima de eps·max(|A|, |B|) (referência em long double)
+bool resolvable(std::size_t N, Real A, Real B, Real r) {
+    const long double aq = std::abs(std::log1p(static_cast<long double>(r) - 1.0L));
+    const long double w  = (aq == 0.0L)
+        ? 1.0L / static_cast<long double>(N)
+        : std::expm1(aq) / std::expm1(static_cast<long double>(N) * aq);
+    return (B - A) * w > kEps * std::max(std::abs(A), std::abs(B));
+}
+
+} // namespace
+
+TEST(Geometric1D, MatchesClosedFormReference) {
+    const Real A = 0.0, B = 2.0;
+    for (Real r : {1.05, 1.2, 0.9, 0.5, 1.0 + 1e-9, 1.0 - 1e-9, 2.0, 1.0}) {
+        for (Index N : {1u, 7u, 63u, 64u, 65u, 1000u}) {
+            SCOPED_TRACE(testing::Message() << "r=" << r << " N=" << N);
+            const auto o  = opts(r);
+            if (!resolvable(N, A, B, r)) {
+                EXPECT_THROW((void)Geometric1D::faces(N, A, B, &o), std::invalid_argument);
+                continue;
+            }
+            const auto xf = Geometric1D::faces(N, A, B, &o);
+            ASSERT_EQ(xf.size(), N + 1u);
+            EXPECT_EQ(xf.front(), A);
+            EXPECT_EQ(xf.back(),  B);
+            // ln r arredondado: erro ~ N·|ln r|·eps relativo a L
+            const Real tol = (8.0 + static_cast<Real>(N) * std::abs(std::log(r))) * kEps * (B - A);
+            for (std::size_t i = 0; i <= N; ++i) {
+                const long double ref = A + (B - A) * ref_frac(i, N, r);
+                EXPECT_NEAR(xf[i], static_cast<Real>(ref), tol);
+                if (i > 0) {
+                    EXPECT_GT(xf[i], xf[i - 1]);
+                }
+            }
+        }
+    }
+}
+
+TEST(Geometric1D, SmallCellsKeepRelativeAccuracy) {
+    // Primeira (r > 1) e última (r < 1) larguras muito menores que L, com a
+    // extremidade refinada em 0 (sem perda para |A| ou |B|)
+    const Index N = 200;
+    for (Real r : {1.15, 1.0 / 1.15}) {
+        const auto o  = opts(r);
+        const Real A  = (r > 1.0) ? 0.0 : -2.0;
+        const auto xf = Geometric1D::faces(N, A, A + 2.0, &o);
+        const std::size_t k = (r > 1.0) ? 0u : N - 1u;   // célula pequena
+        // d_k = L·r^k·(r-1)/(r^N-1) (diferença de frações perderia dígitos)
+        const long double q   = std::log1p(static_cast<long double>(r) - 1.0L);
+        const long double ref = 2.0L * std::exp(static_cast<long double>(k) * q) *
+                                std::expm1(q) / std::expm1(static_cast<long double>(N) * q);
+        EXPECT_LT(ref, 1e-11L);
+        EXPECT_NEAR((xf[k + 1u] - xf[k]) / static_cast<Real>(ref), 1.0, 1e-12);
+    }
+}
+
+TEST(Geometric1D, WidthsFollowRatio) {
+    const Index N = 300;
+    for (Real r : {1.02, 0.97}) {
+        const auto o  = opts(r);
+        const auto xf = Geometric1D::faces(N, -1.0, 1.0, &o);
+        for (std::size_t i = 1; i < N; ++i) {
+            const Real ratio = (xf[i + 1] - xf[i]) / (xf[i] - xf[i - 1]);
+            EXPECT_NEAR(ratio, r, 1e-9) << "i=" << i;
+        }
+    }
+}
+
+TEST(Geometric1D, UnresolvableSmallCellsThrow) {
+    // Menor célula L·expm1(|q|)/expm1(N·|q|) abaixo da resolução de A/B:
+    // faces repetidas (inclusive quando r^N estoura)
+    struct Case { Real r; Index N; };
+    for (const Case c : {Case{1.1, 100000}, Case{0.9, 1000}, Case{1e-4, 63},
+                         Case{1e-4, 200}, Case{1.5, 5000}}) {
+        SCOPED_TRACE(c.N);
+        const auto o = opts(c.r);
+        std::vector<Real> xf(static_cast<std::size_t>(c.N) + 1u);
+        std::vector<Real> xc(static_cast<std::size_t>(c.N));
+        EXPECT_THROW(Geometric1D::faces_into(c.N, 0.0, 1.0, xf, &o), std::invalid_argument);
+        EXPECT_THROW(Geometric1D::centers_into(c.N, 0.0, 1.0, xc, &o), std::invalid_argument);
+    }
+
+    // Resolução medida em max(|A|, |B|): o mesmo caso passa em [0, 1] e
+    // falha longe da origem
+    const auto o = opts(1.1);
+    const Index N = 250;   // menor célula ~ 4.3e-12
+    std::vector<Real> xf(N + 1u);
+    EXPECT_NO_THROW(Geometric1D::faces_into(N, 0.0, 1.0, xf, &o));
+    for (std::size_t i = 1; i <= N; ++i) ASSERT_GT(xf[i], xf[i - 1]);
+    EXPECT_THROW(Geometric1D::faces_into(N, 1e5, 1e5 + 1.0, xf, &o), std::invalid_argument);
+
+    // Mesma rejeição pelo builder
+    Grid1DBuilder b;
+    b.setN(1000).setDomain(0.0, 1.0).setOption(opts(0.9))
+     .setDistribution(DistributionTag::Geometric1D);
+    EXPECT_THROW((void)b.build(), std::invalid_argument);
+}
+
+TEST(Geometric1D, RangeAndScalarMatchFullFaces) {
+    const Index N = 1000;
+    for (Real r : {1.003, 0.99}) {
+        const Geometric1D g(opts(r));
+        const auto o  = opts(r);
+        const auto xf = Geometric1D::faces(N, 0.0, 1.0, &o);
+
+        std::vector<Real> part(150);
+        g.facesRange(N, 0.0, 1.0, 401, part);
+        for (std::size_t k = 0; k < part.size(); ++k) EXPECT_EQ(part[k], xf[401 + k]);
+
+        const GeometricGrid1D lazy(N, 0.0, 1.0, g);
+        for (std::size_t i = 0; i <= N; ++i) EXPECT_EQ(lazy.face(i), xf[i]) << "i=" << i;
+
+        const Grid1D m = lazy.materialize();
+        EXPECT_EQ(as_vec(m.faces()), xf);
+    }
+}
+
+TEST(Geometric1D, RatioForFirstWidth) {
+    const Index N = 80;
+    for (Real d0 : {1e-6, 1e-3, 0.0125, 0.05}) {
+        const Real r  = Geometric1D::ratio_for_first_width(N, 2.0, d0);
+        const auto o  = opts(r);
+        const auto xf = Geometric1D::faces(N, 0.0, 2.0, &o);
+        EXPECT_NEAR((xf[1] - xf[0]) / d0, 1.0, 1e-10) << "d0=" << d0;
+    }
+    EXPECT_NEAR(Geometric1D::ratio_for_first_width(N, 2.0, 2.0 / 80.0), 1.0, 1e-12);
+    EXPECT_THROW((void)Geometric1D::ratio_for_first_width(N, 1.0, 1.5), std::invalid_argument);
+}
+
+TEST(Geometric1D, InvalidInputsThrow) {
+    std::vector<Real> xf(11);
+    for (Real r : {0.0, -1.0, 1e-5, 1e5, std::numeric_limits<Real>::quiet_NaN()}) {
+        const auto o = opts(r);
+        EXPECT_THROW(Geometric1D::faces_into(10, 0.0, 1.0, xf, &o), std::invalid_argument);
+    }
+    EXPECT_THROW(Geometric1D::faces_into(0, 0.0, 1.0, xf), std::invalid_argument);
+    EXPECT_THROW(Geometric1D::faces_into(10, 1.0, 1.0, xf), std::invalid_argument);
+    EXPECT_THROW(Geometric1D::faces_into(9, 0.0, 1.0, xf), std::invalid_argument);
+}
@@ -0,0 +1,266 @@
+// ----------------------------------------------------------------------------
+// File: ut_Grid1DAdapt.cpp
+// Author: FVMGridMaker Team
+// Version: 1.1
+// Date: 2025-10-27
+// Description: Testes de unidade de refine/coarsen incrementais: faces,
+//              centros, dF e dC iguais ao fechamento da malha nova, dados
+//              das células intocadas preservados, mapa antigo → novo,
+//              coarsen desfaz refine, variantes por predicado, mesmo
+//              resultado para qualquer ExecPolicy e entradas inválidas
+//              (exceção, ou malha intocada com Policy::Status).
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/ErrorHandling/ErrorHandling.h>
+#include <FVMGridMaker/ErrorHandling/FVMGException.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Centering/CellCentered.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Centering/FaceCentered.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Utils/Grid1DAdapt.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Utils/Grid1DValidation.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using Real  = FVMGridMaker::core::Real;
+using Index = FVMGridMaker::core::Index;
+using FVMGridMaker::core::ExecPolicy;
+using FVMGridMaker::error::FVMGException;
+using FVMGridMaker::grid::grid1d::api::Grid1D;
+using FVMGridMaker::grid::grid1d::patterns::centering::CellCentered;
+using FVMGridMaker::grid::grid1d::patterns::centering::FaceCentered;
+namespace adapt      = FVMGridMaker::grid::grid1d::utils::adapt;
+namespace validation = FVMGridMaker::grid::grid1d::utils::validation;
+
+namespace {
+
+std::vector<Real> as_vec(std::span<const Real> s) { return {s.begin(), s.end()}; }
+
+// Malha a partir das faces (centros, dF e dC pelo fechamento FaceCentered)
+Grid1D from_faces(std::vector<Real> xf) {
+    const std::size_t N = xf.size() - 1u;
+    std::vector<Real> xc(N), dF(N), dC(N + 1u);
+    FaceCentered{}(xf, xc, dF, dC);
+    return Grid1D(std::move(xf), std::move(xc), std::move(dF), std::move(dC));
+}
+
+// Faces não uniformes: larguras 1, 1.25, ..., 2 repetidas
+std::vector<Real> faces(std::size_t N) {
+    std::vector<Real> xf(N + 1u);
+    Real x = 0.0;
+    for (std::size_t i = 0; i <= N; ++i) {
+        xf[i] = x;
+        x += 1.0 + 0.25 * static_cast<Real>(i % 5);
+    }
+    return xf;
+}
+
+// As quatro sequências iguais às do fechamento das faces novas
+void expect_closed(const Grid1D& g) {
+    const Grid1D ref = from_faces(as_vec(g.faces()));
+    EXPECT_EQ(as_vec(g.centers()),       as_vec(ref.centers()));
+    EXPECT_EQ(as_vec(g.deltasFaces()),   as_vec(ref.deltasFaces()));
+    EXPECT_EQ(as_vec(g.deltasCenters()), as_vec(ref.deltasCenters()));
+    EXPECT_FALSE(validation::first_violation(g.faces(), g.centers()).has_value());
+}
+
+void expect_same(const Grid1D& a, const Grid1D& b) {
+    EXPECT_EQ(as_vec(a.faces()),         as_vec(b.faces()));
+    EXPECT_EQ(as_vec(a.centers()),       as_vec(b.centers()));
+    EXPECT_EQ(as_vec(a.deltasFaces()),   as_vec(b.deltasFaces()));
+    EXPECT_EQ(as_vec(a.deltasCenters()), as_vec(b.deltasCenters()));
+}
+
+} // namespace
+
+TEST(Grid1DAdapt, RefineSplitsSelectedCells) {
+    const Grid1D g = from_faces({0.0, 1.0, 2.0, 4.0, 5.0});
+    const std::vector<Index> cells = {0, 2};
+    const auto r = adapt::refine(g, cells);
+
+    EXPECT_EQ(r.grid.nVolumes(), 6u);
+    EXPECT_EQ(as_vec(r.grid.faces()), (std::vector<Real>{0.0, 0.5, 1.0, 2.0, 3.0, 4.0, 5.0}));
+    EXPECT_EQ(r.map, (std::vector<Index>{0, 2, 3, 5, 6}));
+    expect_closed(r.grid);
+
+    // Três partes; célula de borda direita
+    const std::vector<Index> last = {3};
+    const auto r3 = adapt::refine(g, last, 3);
+    EXPECT_EQ(r3.grid.nVolumes(), 6u);
+    EXPECT_EQ(r3.map, (std::vector<Index>{0, 1, 2, 3, 6}));
+    EXPECT_EQ(r3.grid.faces().back(), 5.0);
+    EXPECT_NEAR(r3.grid.face(4), 4.0 + 1.0 / 3.0, 1e-15);
+    expect_closed(r3.grid);
+}
+
+TEST(Grid1DAdapt, CoarsenMergesGroups) {
+    const Grid1D g = from_faces({0.0, 1.0, 2.0, 4.0, 5.0, 7.0});
+    const std::vector<Index> starts = {0, 3};
+    const auto c = adapt::coarsen(g, starts);
+
+    EXPECT_EQ(c.grid.nVolumes(), 3u);
+    EXPECT_EQ(as_vec(c.grid.faces()), (std::vector<Real>{0.0, 2.0, 4.0, 7.0}));
+    EXPECT_EQ(c.map, (std::vector<Index>{0, 0, 1, 2, 2, 3}));
+    expect_closed(c.grid);
+
+    // Tudo em uma célula
+    const std::vector<Index> all = {0};
+    const auto one = adapt::coarsen(g, all, 5);
+    EXPECT_EQ(as_vec(one.grid.faces()), (std::vector<Real>{0.0, 7.0}));
+    EXPECT_EQ(one.grid.center(0), 3.5);
+    EXPECT_EQ(one.map, (std::vector<Index>{0, 0, 0, 0, 0, 1}));
+}
+
+TEST(Grid1DAdapt, UntouchedCellsKeepTheirData) {
+    // Malha cell-centered: centros não são pontos médios das faces
+    const std::size_t N = 40;
+    std::vector<Real> xc(N), xf(N + 1u), dF(N), dC(N + 1u);
+    for (std::size_t i = 0; i < N; ++i) xc[i] = static_cast<Real>(i * i) / 10.0;
+    CellCentered{}(xc, xf, dF, dC);
+    const Grid1D g(xf, xc, dF, dC);
+
+    const std::vector<Index> cells = {5, 6, 20};
+    const auto r = adapt::refine(g, cells, 4);
+    for (std::size_t i = 0; i < N; ++i) {
+        if (i == 5 || i == 6 || i == 20) continue;
+        const auto j = r.map[i];
+        EXPECT_EQ(r.grid.face(j),        xf[i]);
+        EXPECT_EQ(r.grid.center(j),      xc[i]);
+        EXPECT_EQ(r.grid.deltaFace(j),   dF[i]);
+        // dC só muda na fronteira com células novas
+        if (i != 7 && i != 21) {
+            EXPECT_EQ(r.grid.deltaCenter(j), dC[i]) << "i=" << i;
+        }
+    }
+    EXPECT_EQ(r.grid.deltaCenter(r.map[7]),  r.grid.center(r.map[7])  - r.grid.center(r.map[7] - 1u));
+    EXPECT_EQ(r.grid.deltaCenter(r.map[21]), r.grid.center(r.map[21]) - r.grid.center(r.map[21] - 1u));
+    EXPECT_EQ(r.grid.deltasCenters().back(), dC[N]);
+    EXPECT_FALSE(validation::first_violation(r.grid.faces(), r.grid.centers()).has_value());
+}
+
+TEST(Grid1DAdapt, CoarsenUndoesRefine) {
+    const Grid1D g = from_faces(faces(100));
+    const std::vector<Index> cells = {0, 1, 17, 50, 98, 99};
+
+    for (const Index parts : {Index(2), Index(3), Index(7)}) {
+        const auto r = adapt::refine(g, cells, parts);
+        expect_closed(r.grid);
+
+        std::vector<Index> starts;
+        for (const auto i : cells) starts.push_back(r.map[i]);
+        const auto c = adapt::coarsen(r.grid, starts, parts);
+        expect_same(c.grid, g);
+
+        // Composição dos mapas = identidade
+        for (std::size_t i = 0; i <= 100; ++i) EXPECT_EQ(c.map[r.map[i]], i);
+    }
+}
+
+TEST(Grid1DAdapt, PredicateVariantsMatchLists) {
+    const Grid1D g = from_faces(faces(60));
+    auto wide = [&g](Index i) { return g.deltaFace(i) > 1.6; };
+
+    std::vector<Index> cells;
+    for (Index i = 0; i < 60; ++i) if (wide(i)) cells.push_back(i);
+    const auto r1 = adapt::refine_if(g, wide);
+    const auto r2 = adapt::refine(g, cells);
+    expect_same(r1.grid, r2.grid);
+    EXPECT_EQ(r1.map, r2.map);
+
+    // Sequências marcadas: {2..6} → grupos {2,3},{4,5}, sobra 6; {10,11,12} → {10,11}
+    auto marked = [](Index i) { return (i >= 2 && i <= 6) || (i >= 10 && i <= 12); };
+    const auto c = adapt::coarsen_if(g, marked);
+    const std::vector<Index> starts = {2, 4, 10};
+    expect_same(c.grid, adapt::coarsen(g, starts).grid);
+    EXPECT_EQ(c.grid.nVolumes(), 57u);
+
+    // Grupos de 3
+    const auto c3 = adapt::coarsen_if(g, marked, 3);
+    const std::vector<Index> starts3 = {2, 10};
+    expect_same(c3.grid, adapt::coarsen(g, starts3, 3).grid);
+}
+
+TEST(Grid1DAdapt, ExecPolicyDoesNotChangeResult) {
+    const std::size_t N = 300001;
+    const Grid1D g = from_faces(faces(N));
+
+    std::vector<Index> cells, starts;
+    for (Index i = 0; i < N; i += 7) cells.push_back(i);
+    for (Index i = 3; i + 3 <= N; i += 11) starts.push_back(i);
+    cells.back() = N - 1u;
+
+    const auto rs = adapt::refine(g, cells, 2, ExecPolicy::Serial);
+    const auto rp = adapt::refine(g, cells, 2, ExecPolicy::Parallel);
+    expect_same(rs.grid, rp.grid);
+    EXPECT_EQ(rs.map, rp.map);
+    expect_closed(rs.grid);
+
+    const auto cs = adapt::coarsen(g, starts, 3, ExecPolicy::Serial);
+    const auto cp = adapt::coarsen(g, starts, 3, ExecPolicy::Parallel);
+    expect_same(cs.grid, cp.grid);
+    EXPECT_EQ(cs.map, cp.map);
+    expect_closed(cs.grid);
+}
+
+TEST(Grid1DAdapt, EmptyListCopiesGrid) {
+    const Grid1D g = from_faces(faces(10));
+    const std::vector<Index> none;
+    const auto r = adapt::refine(g, none);
+    const auto c = adapt::coarsen(g, none);
+    expect_same(r.grid, g);
+    expect_same(c.grid, g);
+    for (std::size_t i = 0; i <= 10; ++i) EXPECT_EQ(r.map[i], i);
+}
+
+TEST(Grid1DAdapt, InvalidInputsThrow) {
+    const Grid1D g = from_faces(faces(10));
+    const std::vector<Index> unsorted = {3, 1};
+    const std::vector<Index> repeated = {2, 2};
+    const std::vector<Index> outside  = {10};
+    const std::vector<Index> overlap  = {2, 3};
+    const std::vector<Index> tail     = {9};
+    const std::vector<Index> ok       = {1};
+
+    EXPECT_THROW((void)adapt::refine(g, unsorted), FVMGException);
+    EXPECT_THROW((void)adapt::refine(g, repeated), FVMGException);
+    EXPECT_THROW((void)adapt::refine(g, outside),  FVMGException);
+    EXPECT_THROW((void)adapt::refine(g, ok, 1),    FVMGException);
+    EXPECT_THROW((void)adapt::coarsen(g, overlap), FVMGException);
+    EXPECT_THROW((void)adapt::coarsen(g, tail),    FVMGException);
+    EXPECT_THROW((void)adapt::coarsen(g, ok, 0),   FVMGException);
+}
+
+TEST(Grid1DAdapt, InvalidInputsLeaveGridUnderStatusPolicy) {
+    namespace err = FVMGridMaker::error;
+    const auto original = err::Config::get();
+    err::ErrorConfig cfg;
+    cfg.policy = err::Policy::Status;
+    err::Config::set(cfg);
+    (void)err::ErrorManager::flush();
+
+    const Grid1D g = from_faces(faces(2));
+    const std::vector<Index> outside  = {7};
+    const std::vector<Index> unsorted = {1, 0};
+    const std::vector<Index> ok       = {0};
+    for (const auto& r : {adapt::refine(g, outside), adapt::refine(g, unsorted),
+                          adapt::refine(g, ok, 1), adapt::coarsen(g, ok, 3)}) {
+        expect_same(r.grid, g);
+        ASSERT_EQ(r.map.size(), 3u);
+        for (std::size_t i = 0; i <= 2; ++i) EXPECT_EQ(r.map[i], i);
+    }
+
+    EXPECT_EQ(err::ErrorManager::flush().size(), 4u);
+    err::Config::set(*original);
+}
@@ -0,0 +1,222 @@
+// ----------------------------------------------------------------------------
+// File: ut_Grid1DFile.cpp
+// Author: FVMGridMaker Team
+// Version: 1.2
+// Date: 2025-10-27
+// Description: Testes de unidade do formato binário de malhas 1D: ida e
+//              volta bit a bit via mmap, metadados, alinhamento das seções,
+//              checksum, regravação atômica (tmp + rename) e rejeição de
+//              arquivos inválidos (inclusive tags fora da faixa no cabeçalho).
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/ErrorHandling/FVMGException.h>
+#include <FVMGridMaker/ErrorHandling/FileErrors.h>
+#include <FVMGridMaker/Grid/Common/Tags1D.hpp>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/IO/Grid1DFile.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using Real = FVMGridMaker::core::Real;
+using FVMGridMaker::core::ExecPolicy;
+using FVMGridMaker::grid::CenteringTag;
+using FVMGridMaker::grid::DistributionTag;
+using FVMGridMaker::grid::grid1d::api::Grid1D;
+namespace io = FVMGridMaker::grid::grid1d::io;
+
+namespace {
+
+// Malha não uniforme com N volumes (faces crescentes, fechamento explícito)
+Grid1D make_grid(std::size_t N) {
+    std::vector<Real> xf(N + 1), xc(N), dF(N), dC(N + 1);
+    Real x = 0.0;
+    for (std::size_t i = 0; i <= N; ++i) {
+        xf[i] = x;
+        x += 1.0 + 0.5 * static_cast<Real>(i % 7) / 7.0;
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+        xc[i] = 0.5 * (xf[i] + xf[i + 1]);
+        dF[i] = xf[i + 1] - xf[i];
+    }
+    dC[0] = xc[0] - xf[0];
+    for (std::size_t i = 1; i < N; ++i) dC[i] = xc[i] - xc[i - 1];
+    dC[N] = xf[N] - xc[N - 1];
+    return Grid1D(xf, xc, dF, dC);
+}
+
+std::string temp_path(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+std::vector<Real> to_vec(std::span<const Real> s) { return {s.begin(), s.end()}; }
+
+} // namespace
+
+TEST(Grid1DFile, RoundTripIsBitExactAndAligned) {
+    const std::string path = temp_path("fvmg_ut_roundtrip.fvmg");
+    for (std::size_t N : {1u, 7u, 8u, 100003u}) {
+        SCOPED_TRACE(N);
+        const auto g = make_grid(N);
+        io::Grid1DFileMeta meta{};
+        meta.distribution = DistributionTag::Random1D;
+        meta.centering    = CenteringTag::CellCentered;
+        meta.a            = -2.5;
+        meta.b            = 4.0;
+        meta.seed         = 0xDEADBEEFull;
+        io::write_grid1d(path, g, meta);
+
+        const auto m = io::MappedGrid1D::open(path, /*verify=*/true);
+        ASSERT_TRUE(m.is_open());
+        const auto& v = m.view();
+        EXPECT_EQ(v.nVolumes(), g.nVolumes());
+        EXPECT_EQ(to_vec(v.faces()),         to_vec(g.faces()));
+        EXPECT_EQ(to_vec(v.centers()),       to_vec(g.centers()));
+        EXPECT_EQ(to_vec(v.deltasFaces()),   to_vec(g.deltasFaces()));
+        EXPECT_EQ(to_vec(v.deltasCenters()), to_vec(g.deltasCenters()));
+
+        for (auto s : {v.faces(), v.centers(), v.deltasFaces(), v.deltasCenters()}) {
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(s.data()) % io::kGrid1DFileAlignment, 0u);
+        }
+
+        EXPECT_EQ(m.meta().distribution, DistributionTag::Random1D);
+        EXPECT_EQ(m.meta().centering,    CenteringTag::CellCentered);
+        EXPECT_EQ(m.meta().a, -2.5);
+        EXPECT_EQ(m.meta().b, 4.0);
+        EXPECT_EQ(m.meta().seed, 0xDEADBEEFull);
+        EXPECT_EQ(m.header().version, io::kGrid1DFileVersion);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(Grid1DFile, RewriteKeepsExistingMappingIntact) {
+    const std::string path = temp_path("fvmg_ut_rewrite.fvmg");
+    const auto g_old = make_grid(5000);
+    const auto g_new = make_grid(20);
+    io::write_grid1d(path, g_old);
+
+    // Um leitor ainda mapeando o arquivo antigo não vê a regravação
+    const auto m_old = io::MappedGrid1D::open(path);
+    io::write_grid1d(path, g_new);
+    EXPECT_EQ(to_vec(m_old.view().faces()), to_vec(g_old.faces()));
+
+    const auto m_new = io::MappedGrid1D::open(path, /*verify=*/true);
+    EXPECT_EQ(to_vec(m_new.view().faces()), to_vec(g_new.faces()));
+    EXPECT_FALSE(std::filesystem::exists(path + ".tmp"));
+    std::filesystem::remove(path);
+}
+
+TEST(Grid1DFile, ChecksumIsPolicyIndependentAndDetectsCorruption) {
+    const std::string path = temp_path("fvmg_ut_checksum.fvmg");
+    const auto g = make_grid(300001);
+    const FVMGridMaker::grid::grid1d::api::Grid1DView gv(
+        g.faces(), g.centers(), g.deltasFaces(), g.deltasCenters());
+    EXPECT_EQ(io::grid1d_checksum(gv, ExecPolicy::Serial),
+              io::grid1d_checksum(gv, ExecPolicy::Parallel));
+    io::write_grid1d(path, g);
+
+    std::uint64_t offset_dC = 0;
+    {
+        auto m = io::MappedGrid1D::open(path);
+        EXPECT_TRUE(m.verify(ExecPolicy::Parallel));
+        offset_dC = m.header().offset[3];
+
+        // mover transfere o mapeamento
+        io::MappedGrid1D moved = std::move(m);
+        EXPECT_FALSE(m.is_open());
+        EXPECT_TRUE(moved.is_open());
+        EXPECT_EQ(moved.view().nVolumes(), g.nVolumes());
+    }
+
+    // corrompe um byte dentro de dC
+    {
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(static_cast<std::streamoff>(offset_dC + 1000));
+        f.put('\x7f');
+    }
+    const auto m = io::MappedGrid1D::open(path);        // sem verificação: abre
+    ASSERT_TRUE(m.is_open());
+    EXPECT_FALSE(m.verify());
+    EXPECT_THROW((void)io::MappedGrid1D::open(path, true), FVMGridMaker::error::FVMGException);
+    std::filesystem::remove(path);
+}
+
+TEST(Grid1DFile, RejectsMissingTruncatedAndForeignFiles) {
+    EXPECT_THROW((void)io::MappedGrid1D::open(temp_path("fvmg_ut_does_not_exist.fvmg")),
+                 FVMGridMaker::error::FVMGException);
+
+    const std::string path = temp_path("fvmg_ut_invalid.fvmg");
+    {
+        std::ofstream f(path, std::ios::binary);
+        f << "not a grid file";
+    }
+    EXPECT_THROW((void)io::MappedGrid1D::open(path), FVMGridMaker::error::FVMGException);
+
+    // arquivo válido truncado: cabeçalho ok, seções fora do arquivo
+    io::write_grid1d(path, make_grid(1000));
+    std::filesystem::resize_file(path, 4096);
+    EXPECT_THROW((void)io::MappedGrid1D::open(path), FVMGridMaker::error::FVMGException);
+
+    // magic alterado
+    io::write_grid1d(path, make_grid(10));
+    {
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(0);
+        f.put('X');
+    }
+    EXPECT_THROW((void)io::MappedGrid1D::open(path), FVMGridMaker::error::FVMGException);
+    std::filesystem::remove(path);
+}
+
+TEST(Grid1DFile, RejectsOutOfRangeHeaderTags) {
+    const std::string path = temp_path("fvmg_ut_bad_tags.fvmg");
+
+    // sobrescreve um byte do cabeçalho de um arquivo válido
+    auto write_with = [&path](std::size_t offset, std::uint8_t value) {
+        io::write_grid1d(path, make_grid(10));
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(static_cast<std::streamoff>(offset));
+        f.put(static_cast<char>(value));
+    };
+    auto expect_invalid_format = [&path] {
+        try {
+            (void)io::MappedGrid1D::open(path);
+            ADD_FAILURE() << "open() deveria lançar";
+        } catch (const FVMGridMaker::error::FVMGException& e) {
+            EXPECT_EQ(e.code(), FVMGridMaker::error::code(FVMGridMaker::error::FileErr::InvalidFormat));
+        }
+    };
+
+    const std::size_t dist_at = offsetof(io::Grid1DFileHeader, distribution);
+    const std::size_t cent_at = offsetof(io::Grid1DFileHeader, centering);
+
+    write_with(dist_at, static_cast<std::uint8_t>(DistributionTag::Count));
+    expect_invalid_format();
+    write_with(dist_at, 0xFF);
+    expect_invalid_format();
+    write_with(cent_at, static_cast<std::uint8_t>(CenteringTag::Count));
+    expect_invalid_format();
+
+    // último valor válido de cada tag continua aceito
+    write_with(dist_at, static_cast<std::uint8_t>(DistributionTag::Count) - 1u);
+    EXPECT_TRUE(io::MappedGrid1D::open(path).is_open());
+    write_with(cent_at, static_cast<std::uint8_t>(CenteringTag::Count) - 1u);
+    EXPECT_TRUE(io::MappedGrid1D::open(path).is_open());
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,257 @@
+// ----------------------------------------------------------------------------
+// File: ut_Grid1DStats.cpp
+// Author: FVMGridMaker Team
+// Version: 1.5
+// Date: 2025-10-27
+// Description: Testes de unidade de Grid1DStats::all (varredura fundida):
+//              equivalência com as métricas separadas e determinismo entre
+//              políticas de execução; termos por par com larguras nulas
+//              e negativas; histograma paralelo (linear e log,
+//              NaN na classe 0);
+//              variância estável de basic(L, exec) em malha quase uniforme.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Grid1D/Utils/Grid1DStats.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using Real = FVMGridMaker::core::Real;
+using FVMGridMaker::core::ExecPolicy;
+using FVMGridMaker::grid::grid1d::utils::Grid1DStats;
+
+namespace {
+
+// Larguras positivas com ruído e tendência (não simétricas)
+std::vector<Real> widths(std::size_t n, unsigned seed) {
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<Real> u(0.5, 1.5);
+    std::vector<Real> L(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        L[i] = u(rng) * (1.0 + 1e-4 * static_cast<Real>(i % 97));
+    }
+    return L;
+}
+
+void expect_rel_near(Real a, Real b, Real tol) {
+    EXPECT_NEAR(a, b, tol * std::max(Real(1), std::abs(b)));
+}
+
+void expect_matches_separate(std::span<const Real> L, std::size_t bins) {
+    Grid1DStats::AllOptions opt{};
+    opt.bins = bins;
+    const auto s = Grid1DStats::all(L, opt);
+    constexpr Real tol = 1e-12;
+
+    const auto b = Grid1DStats::basic(L);
+    EXPECT_EQ(s.basic.min, b.min);
+    EXPECT_EQ(s.basic.max, b.max);
+    expect_rel_near(s.basic.mean,   b.mean,   tol);
+    expect_rel_near(s.basic.stddev, b.stddev, 1e-9);
+    expect_rel_near(s.basic.cv,     b.cv,     1e-9);
+    EXPECT_EQ(s.basic.aspect, b.aspect);
+
+    const auto a = Grid1DStats::adjacent_ratios(L);
+    EXPECT_EQ(s.adjacent.max_ratio,       a.max_ratio);
+    EXPECT_EQ(s.adjacent.worst_sym_ratio, a.worst_sym_ratio);
+    EXPECT_TRUE(s.adjacent.R.empty());
+
+    const auto sm = Grid1DStats::smoothness(L);
+    expect_rel_near(s.smooth.mean_grad, sm.mean_grad, tol);
+    EXPECT_EQ(s.smooth.max_grad, sm.max_grad);
+
+    const auto e = Grid1DStats::edges_vs_interior(L);
+    expect_rel_near(s.edges.mean_interior,       e.mean_interior,       1e-10);
+    expect_rel_near(s.edges.left_over_interior,  e.left_over_interior,  1e-10);
+    expect_rel_near(s.edges.right_over_interior, e.right_over_interior, 1e-10);
+
+    const auto y = Grid1DStats::symmetry(L);
+    expect_rel_near(s.symmetry.symmetry_score, y.symmetry_score, tol);
+    EXPECT_EQ(s.symmetry.max_rel_diff, y.max_rel_diff);
+
+    const auto g = Grid1DStats::geometric_progression(L);
+    expect_rel_near(s.geom.r_est,       g.r_est,       1e-10);
+    expect_rel_near(s.geom.std_log_r,   g.std_log_r,   1e-9);
+    expect_rel_near(s.geom.max_dev_abs, g.max_dev_abs, 1e-9);
+    EXPECT_EQ(s.geom.within_tolerance, g.within_tolerance);
+
+    const auto h = Grid1DStats::histogram(L, bins);
+    EXPECT_EQ(s.histogram.counts, h.counts);
+    EXPECT_EQ(s.histogram.bin_min, h.bin_min);
+    EXPECT_EQ(s.histogram.bin_max, h.bin_max);
+}
+
+} // namespace
+
+TEST(Grid1DStats, AllMatchesSeparateMetrics) {
+    // tamanhos pequenos, ímpares/pares e que cruzam vários blocos espelhados
+    for (std::size_t n : {1u, 2u, 3u, 4u, 7u, 4096u, 8193u, 50001u}) {
+        SCOPED_TRACE(n);
+        expect_matches_separate(widths(n, static_cast<unsigned>(n)), 16);
+    }
+}
+
+TEST(Grid1DStats, AllPairTermsMatchWithZeroAndNegativeWidths) {
+    // zeros e negativos em posições que caem nas lanes SIMD e na cauda
+    for (std::size_t n : {5u, 37u, 300u, 4099u}) {
+        SCOPED_TRACE(n);
+        auto L = widths(n, static_cast<unsigned>(n + 11u));
+        for (std::size_t i = 1; i < n; i += 7) L[i] = Real(0);
+        for (std::size_t i = 3; i < n; i += 11) L[i] = -L[i];
+        const auto s = Grid1DStats::all(std::span<const Real>(L));
+        const auto a = Grid1DStats::adjacent_ratios(L);
+        const auto m = Grid1DStats::smoothness(L);
+        const auto g = Grid1DStats::geometric_progression(L);
+        EXPECT_EQ(s.adjacent.max_ratio,       a.max_ratio);
+        EXPECT_EQ(s.adjacent.worst_sym_ratio, a.worst_sym_ratio);
+        EXPECT_EQ(s.smooth.max_grad,          m.max_grad);
+        expect_rel_near(s.smooth.mean_grad, m.mean_grad, 1e-12);
+        expect_rel_near(s.geom.r_est,       g.r_est,     1e-10);
+        expect_rel_near(s.geom.std_log_r,   g.std_log_r, 1e-9);
+    }
+}
+
+TEST(Grid1DStats, AllFusedHistogramWithRangeAndEmptyInput) {
+    const auto v = widths(30001, 7u);
+    const std::span<const Real> L(v);
+    Grid1DStats::AllOptions opt{};
+    opt.bins  = 32;
+    opt.range = std::make_pair(Real(0.6), Real(1.4));   // satura nos extremos
+    const auto s = Grid1DStats::all(L, opt);
+    const auto h = Grid1DStats::histogram(L, 32, opt.range);
+    EXPECT_EQ(s.histogram.counts, h.counts);
+    EXPECT_EQ(s.histogram.bin_width, h.bin_width);
+
+    const auto z = Grid1DStats::all(std::span<const Real>{}, opt);
+    EXPECT_EQ(z.basic.mean, 0.0);
+    EXPECT_TRUE(z.histogram.counts.empty());
+}
+
+TEST(Grid1DStats, AllIsIdenticalAcrossExecPolicies) {
+    const auto v = widths(400001, 3u);
+    const std::span<const Real> L(v);
+    Grid1DStats::AllOptions opt{};
+    opt.bins  = 64;
+    opt.range = std::make_pair(Real(0.5), Real(1.6));
+
+    opt.exec = ExecPolicy::Serial;
+    const auto a = Grid1DStats::all(L, opt);
+    opt.exec = ExecPolicy::Parallel;
+    const auto b = Grid1DStats::all(L, opt);
+
+    EXPECT_EQ(a.basic.mean,             b.basic.mean);
+    EXPECT_EQ(a.basic.stddev,           b.basic.stddev);
+    EXPECT_EQ(a.smooth.mean_grad,       b.smooth.mean_grad);
+    EXPECT_EQ(a.edges.mean_interior,    b.edges.mean_interior);
+    EXPECT_EQ(a.symmetry.symmetry_score, b.symmetry.symmetry_score);
+    EXPECT_EQ(a.geom.r_est,             b.geom.r_est);
+    EXPECT_EQ(a.geom.std_log_r,         b.geom.std_log_r);
+    EXPECT_EQ(a.histogram.counts,       b.histogram.counts);
+}
+
+TEST(Grid1DStats, HistogramIntoMatchesScalarReference) {
+    using BinScale = Grid1DStats::BinScale;
+    auto v = widths(200003, 11u);
+    v[5] = 0.1; v[6] = 7.0; v[7] = 0.6; v[8] = 1.4;   // saturação e bordas exatas
+    const std::span<const Real> L(v);
+    constexpr std::size_t bins = 37;
+    constexpr Real lo = 0.6, hi = 1.4;
+
+    // referência linear: regra escalar de bin_index
+    std::vector<std::size_t> ref(bins, 0);
+    for (Real x : L) ref[Grid1DStats::bin_index(x, lo, hi, bins)]++;
+
+    // buffer do chamador com lixo: deve ser sobrescrito
+    std::vector<std::size_t> counts(bins, 999u);
+    Grid1DStats::histogram_into(L, counts, lo, hi, BinScale::Linear, ExecPolicy::Serial);
+    EXPECT_EQ(counts, ref);
+    Grid1DStats::histogram_into(L, counts, lo, hi, BinScale::Linear, ExecPolicy::Parallel);
+    EXPECT_EQ(counts, ref);
+    EXPECT_EQ(Grid1DStats::histogram(L, bins, std::make_pair(lo, hi)).counts, ref);
+
+    // referência logarítmica: a mesma regra sobre log(x)
+    std::vector<std::size_t> ref_log(bins, 0);
+    for (Real x : L) {
+        ref_log[Grid1DStats::bin_index(std::log(x), std::log(lo), std::log(hi), bins)]++;
+    }
+    Grid1DStats::HistogramOptions opt{};
+    opt.scale = BinScale::Log;
+    opt.range = std::make_pair(lo, hi);
+    opt.exec  = ExecPolicy::Parallel;
+    const auto H = Grid1DStats::histogram(L, bins, opt);
+    EXPECT_EQ(H.counts, ref_log);
+    EXPECT_EQ(H.scale, BinScale::Log);
+    EXPECT_NEAR(H.bin_width, (std::log(hi) - std::log(lo)) / bins, 1e-15);
+
+    std::size_t total = 0;
+    for (auto c : H.counts) total += c;
+    EXPECT_EQ(total, L.size());
+}
+
+TEST(Grid1DStats, HistogramPutsNaNInFirstBin) {
+    using BinScale = Grid1DStats::BinScale;
+    const Real nan = std::numeric_limits<Real>::quiet_NaN();
+    auto v = widths(1001, 5u);
+    for (std::size_t i = 0; i < v.size(); i += 97) v[i] = nan;   // vários lanes/ladrilhos
+    const std::span<const Real> L(v);
+    constexpr std::size_t bins = 9;
+    constexpr Real lo = 0.5, hi = 1.6;
+
+    std::vector<std::size_t> ref(bins, 0), ref_log(bins, 0);
+    for (Real x : L) {
+        ref[Grid1DStats::bin_index(x, lo, hi, bins)]++;
+        ref_log[Grid1DStats::bin_index(std::log(x), std::log(lo), std::log(hi), bins)]++;
+    }
+    EXPECT_EQ(Grid1DStats::bin_index(nan, lo, hi, bins), 0u);
+
+    std::vector<std::size_t> counts(bins);
+    for (ExecPolicy p : {ExecPolicy::Serial, ExecPolicy::Parallel}) {
+        Grid1DStats::histogram_into(L, counts, lo, hi, BinScale::Linear, p);
+        EXPECT_EQ(counts, ref);
+        Grid1DStats::histogram_into(L, counts, lo, hi, BinScale::Log, p);
+        EXPECT_EQ(counts, ref_log);
+    }
+}
+
+TEST(Grid1DStats, BasicIsStableOnNearUniformWidths) {
+    // L = 1e8 ± 1: ss/n - média² perde todos os dígitos; Chan não.
+    std::vector<Real> v(300001);
+    for (std::size_t i = 0; i < v.size(); ++i) v[i] = Real(1e8) + ((i % 2) ? Real(1) : Real(-1));
+    v.back() = Real(1e8);
+    const std::span<const Real> L(v);
+    const Real n = static_cast<Real>(v.size());
+    const Real ref = std::sqrt((n - 1) / n);
+
+    const auto a = Grid1DStats::basic(L, ExecPolicy::Serial);
+    const auto b = Grid1DStats::basic(L, ExecPolicy::Parallel);
+    EXPECT_NEAR(a.stddev, ref, 1e-9);
+    EXPECT_EQ(a.mean,   Real(1e8));
+    EXPECT_EQ(a.min,    Real(1e8 - 1));
+    EXPECT_EQ(a.max,    Real(1e8 + 1));
+    EXPECT_NEAR(a.cv,   ref / 1e8, 1e-17);
+
+    EXPECT_EQ(a.mean,   b.mean);
+    EXPECT_EQ(a.stddev, b.stddev);
+    EXPECT_EQ(a.aspect, b.aspect);
+
+    const auto s = Grid1DStats::basic(L);
+    expect_rel_near(a.stddev, s.stddev, 1e-9);
+    EXPECT_EQ(Grid1DStats::basic(std::span<const Real>{}, ExecPolicy::Parallel).stddev, 0.0);
+}
@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------------
+// File: ut_Grid1DStatsExec.cpp
+// Author: FVMGridMaker Team
+// Version: 1.1
+// Date: 2025-10-27
+// Description: Testes de unidade de basic_exec: uso da via paralela
+//              conforme core::parallel_chunks, igualdade com
+//              Grid1DStats::basic(L, exec) e variância estável em malha
+//              quase uniforme.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/ParallelFor.hpp>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1DView.h>
+#include <FVMGridMaker/Grid/Grid1D/Utils/Grid1DStats.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Utils/Grid1DStatsExec.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using Real = FVMGridMaker::core::Real;
+using FVMGridMaker::core::ExecPolicy;
+namespace core = FVMGridMaker::core;
+using FVMGridMaker::grid::grid1d::api::Grid1DView;
+using FVMGridMaker::grid::grid1d::utils::Grid1DStats;
+namespace utils = FVMGridMaker::grid::grid1d::utils;
+
+namespace {
+
+// Arrays de uma malha com larguras de face L (faces por soma acumulada).
+struct Arrays {
+    std::vector<Real> xf, xc, dF, dC;
+
+    explicit Arrays(const std::vector<Real>& L)
+        : xf(L.size() + 1u), xc(L.size()), dF(L), dC(L.size() + 1u)
+    {
+        for (std::size_t i = 0; i < L.size(); ++i) {
+            xf[i + 1u] = xf[i] + L[i];
+            xc[i]      = xf[i] + Real(0.5) * L[i];
+        }
+    }
+
+    Grid1DView view() const { return Grid1DView(xf, xc, dF, dC); }
+};
+
+} // namespace
+
+TEST(Grid1DStatsExec, ParallelPathFollowsParallelChunks) {
+    EXPECT_TRUE(utils::has_parallel());
+
+    std::vector<Real> L(50001);
+    for (std::size_t i = 0; i < L.size(); ++i) {
+        L[i] = Real(1) + Real(1e-3) * static_cast<Real>(i % 17);
+    }
+    const Arrays g(L);
+
+    // Parallel: paralelo sempre que houver mais de um thread de hardware
+    const std::size_t blocks =
+        (L.size() + core::kReduceBlock - 1u) / core::kReduceBlock;
+    bool used = false;
+    const auto p = utils::basic_exec(g.view(), ExecPolicy::Parallel, &used);
+    EXPECT_EQ(used, core::parallel_chunks(blocks, ExecPolicy::Parallel) > 1u);
+
+    // Mesma redução da biblioteca: resultado idêntico bit a bit
+    const auto r = Grid1DStats::basic(std::span<const Real>(L), ExecPolicy::Parallel);
+    EXPECT_EQ(p.min,    r.min);
+    EXPECT_EQ(p.max,    r.max);
+    EXPECT_EQ(p.mean,   r.mean);
+    EXPECT_EQ(p.stddev, r.stddev);
+    EXPECT_EQ(p.aspect, r.aspect);
+    EXPECT_EQ(p.cv,     r.cv);
+
+    used = true;
+    (void)utils::basic_exec(g.view(), ExecPolicy::Serial, &used);
+    EXPECT_FALSE(used);
+
+    // Auto: 50001 elementos ficam abaixo de kParallelGrain → serial
+    used = true;
+    (void)utils::basic_exec(g.view(), ExecPolicy::Auto, &used);
+    EXPECT_FALSE(used);
+
+    used = true;
+    (void)utils::basic_exec(Grid1DView{}, ExecPolicy::Parallel, &used);
+    EXPECT_FALSE(used);
+}
+
+TEST(Grid1DStatsExec, ParallelIsStableOnNearUniformWidths) {
+    // L = 1e8 ± 1: ss/n - média² perde todos os dígitos; Chan não.
+    std::vector<Real> L(300001);
+    for (std::size_t i = 0; i < L.size(); ++i) {
+        L[i] = Real(1e8) + ((i % 2) ? Real(1) : Real(-1));
+    }
+    L.back() = Real(1e8);
+    const Arrays g(L);
+    const Real n   = static_cast<Real>(L.size());
+    const Real ref = std::sqrt((n - 1) / n);
+
+    const auto p = utils::basic_exec(g.view(), ExecPolicy::Parallel);
+    const auto s = utils::basic_exec(g.view(), ExecPolicy::Serial);
+    EXPECT_NEAR(p.stddev, ref, 1e-9);
+    EXPECT_EQ(p.mean, Real(1e8));
+    EXPECT_EQ(p.min,  Real(1e8 - 1));
+    EXPECT_EQ(p.max,  Real(1e8 + 1));
+    EXPECT_NEAR(p.stddev, s.stddev, 1e-9);
+}
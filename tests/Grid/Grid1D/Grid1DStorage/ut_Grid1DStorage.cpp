@@ -0,0 +1,139 @@
+// ----------------------------------------------------------------------------
+// File: ut_Grid1DStorage.cpp
+// Author: FVMGridMaker Team
+// Version: 1.2
+// Date: 2025-10-27
+// Description: Testes de unidade da arena única (Grid1DStorage) do Grid1D:
+//              alinhamento, tamanhos, cópia profunda, movimento e
+//              rejeição de vetores com tamanhos inconsistentes (com e
+//              sem exceção).
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/ErrorHandling/ErrorHandling.h>
+#include <FVMGridMaker/ErrorHandling/FVMGException.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1DStorage.h>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using Real  = FVMGridMaker::core::Real;
+using Index = FVMGridMaker::core::Index;
+using FVMGridMaker::error::FVMGException;
+using FVMGridMaker::grid::grid1d::api::Grid1D;
+using FVMGridMaker::grid::grid1d::api::Grid1DStorage;
+
+namespace {
+bool is_aligned(const Real* p) {
+    return reinterpret_cast<std::uintptr_t>(p) % Grid1DStorage::kAlignment == 0u;
+}
+} // namespace
+
+TEST(Grid1DStorage, SizesAndAlignment) {
+    for (Index n : {Index(1), Index(3), Index(7), Index(8), Index(9), Index(1000)}) {
+        Grid1DStorage s(n);
+        ASSERT_FALSE(s.empty());
+        EXPECT_EQ(s.nVolumes(), n);
+        EXPECT_EQ(s.faces().size(),         n + 1);
+        EXPECT_EQ(s.centers().size(),       n);
+        EXPECT_EQ(s.deltasFaces().size(),   n);
+        EXPECT_EQ(s.deltasCenters().size(), n + 1);
+
+        EXPECT_TRUE(is_aligned(s.faces().data()));
+        EXPECT_TRUE(is_aligned(s.centers().data()));
+        EXPECT_TRUE(is_aligned(s.deltasFaces().data()));
+        EXPECT_TRUE(is_aligned(s.deltasCenters().data()));
+
+        // blocos não se sobrepõem
+        EXPECT_LE(s.faces().data() + s.faces().size(), s.centers().data());
+        EXPECT_LE(s.centers().data() + s.centers().size(), s.deltasFaces().data());
+        EXPECT_LE(s.deltasFaces().data() + s.deltasFaces().size(), s.deltasCenters().data());
+    }
+}
+
+TEST(Grid1DStorage, DefaultIsEmpty) {
+    Grid1DStorage s;
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(s.bytes(), 0u);
+    EXPECT_TRUE(s.faces().empty());
+
+    Grid1D g;
+    EXPECT_EQ(g.nVolumes(), 0u);
+    EXPECT_EQ(g.nFaces(),   0u);
+}
+
+TEST(Grid1DStorage, GridFromVectorsCopyAndMove) {
+    std::vector<Real> xf{0.0, 0.25, 1.0};
+    std::vector<Real> xc{0.125, 0.625};
+    std::vector<Real> dF{0.25, 0.75};
+    std::vector<Real> dC{0.125, 0.5, 0.375};
+
+    Grid1D g(xf, xc, dF, dC);
+    EXPECT_EQ(g.nVolumes(), 2u);
+    EXPECT_TRUE(is_aligned(g.faces().data()));
+    EXPECT_TRUE(is_aligned(g.deltasCenters().data()));
+    EXPECT_EQ(std::vector<Real>(g.faces().begin(), g.faces().end()), xf);
+    EXPECT_EQ(std::vector<Real>(g.deltasCenters().begin(), g.deltasCenters().end()), dC);
+
+    // cópia profunda: nova arena, mesmos valores
+    Grid1D c = g;
+    EXPECT_NE(c.faces().data(), g.faces().data());
+    EXPECT_EQ(c.center(1), g.center(1));
+    EXPECT_EQ(c.deltaFace(1), g.deltaFace(1));
+
+    // movimento: transfere a arena sem realocar
+    const Real* p = g.faces().data();
+    Grid1D m = std::move(g);
+    EXPECT_EQ(m.faces().data(), p);
+    EXPECT_EQ(m.face(2), Real(1.0));
+}
+
+TEST(Grid1DStorage, GridFromVectorsRejectsMismatchedSizes) {
+    const std::vector<Real> xf{0.0, 0.25, 1.0};
+    const std::vector<Real> xc{0.125, 0.625};
+    const std::vector<Real> dF{0.25, 0.75};
+    const std::vector<Real> dC{0.125, 0.5, 0.375};
+    const std::vector<Real> big(64, 1.0);
+
+    EXPECT_THROW(Grid1D(big, xc, dF, dC), FVMGException);   // faces
+    EXPECT_THROW(Grid1D(xf, xc, big, dC), FVMGException);   // dF
+    EXPECT_THROW(Grid1D(xf, xc, dF, big), FVMGException);   // dC
+    EXPECT_THROW(Grid1D(xf, xc, dF, {}),  FVMGException);
+    EXPECT_THROW(Grid1D({}, xc, dF, dC),  FVMGException);
+    EXPECT_NO_THROW(Grid1D(xf, xc, dF, dC));
+}
+
+TEST(Grid1DStorage, GridFromVectorsStopsOnMismatchUnderStatusPolicy) {
+    namespace err = FVMGridMaker::error;
+    const auto original = err::Config::get();
+    err::ErrorConfig cfg;
+    cfg.policy = err::Policy::Status;
+    err::Config::set(cfg);
+    (void)err::ErrorManager::flush();
+
+    // dC muito maior que N+1: nada é copiado, a malha fica vazia
+    const std::vector<Real> xf{0.0, 0.25, 1.0};
+    const std::vector<Real> xc{0.125, 0.625};
+    const std::vector<Real> dF{0.25, 0.75};
+    const Grid1D g(xf, xc, dF, std::vector<Real>(100000, 1.0));
+    EXPECT_EQ(g.nVolumes(), Index{0});
+    EXPECT_TRUE(g.faces().empty());
+
+    const auto errors = err::ErrorManager::flush();
+    ASSERT_EQ(errors.size(), 1u);
+    EXPECT_EQ(errors[0].code, err::code(err::CoreErr::InvalidArgument));
+
+    err::Config::set(*original);
+}
@@ -0,0 +1,110 @@
+// ----------------------------------------------------------------------------
+// File: ut_Grid1DValidation.cpp
+// Author: FVMGridMaker Team
+// Version: 1.0
+// Date: 2025-10-27
+// Description: Testes de unidade das validações 1D: primeira violação
+//              (índice e tipo) igual em qualquer política de execução,
+//              inclusive com várias violações em trechos de threads distintas.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/ErrorHandling/FVMGException.h>
+#include <FVMGridMaker/ErrorHandling/GridErrors.h>
+#include <FVMGridMaker/Grid/Grid1D/Utils/Grid1DValidation.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using Real = FVMGridMaker::core::Real;
+using FVMGridMaker::core::ExecPolicy;
+using FVMGridMaker::error::GridErr;
+namespace validation = FVMGridMaker::grid::grid1d::utils::validation;
+
+namespace {
+
+struct Cells {
+    std::vector<Real> xf, xc;
+};
+
+// Malha válida não uniforme com N células
+Cells make_cells(std::size_t N) {
+    Cells g{std::vector<Real>(N + 1), std::vector<Real>(N)};
+    Real x = Real(0);
+    for (std::size_t i = 0; i <= N; ++i) {
+        g.xf[i] = x;
+        x += Real(1) + Real(0.25) * static_cast<Real>(i % 5);
+    }
+    for (std::size_t i = 0; i < N; ++i) g.xc[i] = Real(0.5) * (g.xf[i] + g.xf[i + 1]);
+    return g;
+}
+
+void expect_first(const Cells& g, GridErr code, std::size_t index) {
+    for (auto p : {ExecPolicy::Serial, ExecPolicy::Parallel, ExecPolicy::Auto}) {
+        const auto v = validation::first_violation(g.xf, g.xc, p);
+        ASSERT_TRUE(v.has_value());
+        EXPECT_EQ(v->code, code);
+        EXPECT_EQ(v->index, index);
+    }
+}
+
+} // namespace
+
+TEST(Grid1DValidation, ValidGridHasNoViolation) {
+    for (std::size_t N : {1u, 2u, 4095u, 4096u, 4097u, 300001u}) {
+        SCOPED_TRACE(N);
+        const auto g = make_cells(N);
+        EXPECT_FALSE(validation::first_violation(g.xf, g.xc, ExecPolicy::Serial));
+        EXPECT_FALSE(validation::first_violation(g.xf, g.xc, ExecPolicy::Parallel));
+        EXPECT_NO_THROW(validation::cells(g.xf, g.xc));
+        EXPECT_NO_THROW(validation::strictly_increasing_faces(g.xf, ExecPolicy::Parallel));
+        EXPECT_NO_THROW(validation::strictly_increasing_centers(g.xc, ExecPolicy::Parallel));
+        EXPECT_NO_THROW(validation::positive_face_lengths(g.xf, ExecPolicy::Parallel));
+    }
+    EXPECT_FALSE(validation::first_violation({}, {}));
+}
+
+TEST(Grid1DValidation, ReportsEarliestViolationAcrossThreads) {
+    constexpr std::size_t N = 400000;
+
+    // várias violações; a do fim do array é encontrada primeiro pela
+    // última thread, mas a menor deve prevalecer
+    auto g = make_cells(N);
+    g.xc[N - 3]  = g.xf[N - 2];                 // centro fora (à direita)
+    g.xf[250001] = g.xf[250000];                // faces iguais
+    g.xc[123457] = g.xf[123457] - Real(1);      // centro fora (à esquerda)
+    expect_first(g, GridErr::CenterOutsideCell, 123457);
+
+    g.xf[123457] = g.xf[123458] + Real(1);      // agora as faces decrescem antes
+    expect_first(g, GridErr::NonIncreasingFaces, 123457);
+
+    g.xf[7] = std::numeric_limits<Real>::quiet_NaN();
+    expect_first(g, GridErr::NonIncreasingFaces, 6);
+}
+
+TEST(Grid1DValidation, SingleChecksThrowOnFirstViolation) {
+    auto g = make_cells(200000);
+    g.xc[150000] = g.xc[149999];
+    EXPECT_NO_THROW(validation::strictly_increasing_faces(g.xf, ExecPolicy::Parallel));
+    EXPECT_THROW(validation::strictly_increasing_centers(g.xc, ExecPolicy::Parallel),
+                 FVMGridMaker::error::FVMGException);
+
+    g.xf[199999] = g.xf[199998];
+    EXPECT_THROW(validation::positive_face_lengths(g.xf, ExecPolicy::Parallel),
+                 FVMGridMaker::error::FVMGException);
+    EXPECT_THROW(validation::cells(g.xf, g.xc, ExecPolicy::Parallel),
+                 FVMGridMaker::error::FVMGException);
+    expect_first(g, GridErr::CenterOutsideCell, 150000);
+}
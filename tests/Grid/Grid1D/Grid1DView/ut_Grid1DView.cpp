@@ -0,0 +1,152 @@
+// ----------------------------------------------------------------------------
+// File: ut_Grid1DView.cpp
+// Author: FVMGridMaker Team
+// Version: 1.0
+// Date: 2025-10-27
+// Description: Testes de unidade do Grid1DView: construção sem cópia a partir
+//              de Grid1D e de ponteiros crus, acessores equivalentes e
+//              resultados idênticos em todos os templates GridLike de
+//              Grid1DStats e em basic_exec.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1D.h>
+#include <FVMGridMaker/Grid/Grid1D/API/Grid1DView.h>
+#include <FVMGridMaker/Grid/Grid1D/Utils/Grid1DStats.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Utils/Grid1DStatsExec.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using Real  = FVMGridMaker::core::Real;
+using Index = FVMGridMaker::core::Index;
+using FVMGridMaker::core::ExecPolicy;
+using FVMGridMaker::grid::grid1d::api::Grid1D;
+using FVMGridMaker::grid::grid1d::api::Grid1DView;
+using FVMGridMaker::grid::grid1d::utils::Grid1DStats;
+namespace utils = FVMGridMaker::grid::grid1d::utils;
+
+namespace {
+
+// Arrays "externos" (ex.: de um solver), tamanhos N+1, N, N, N+1
+struct External {
+    std::vector<Real> xf, xc, dF, dC;
+};
+
+External make_external(std::size_t N) {
+    External e{std::vector<Real>(N + 1), std::vector<Real>(N),
+               std::vector<Real>(N),     std::vector<Real>(N + 1)};
+    Real x = 0.0;
+    for (std::size_t i = 0; i <= N; ++i) {
+        e.xf[i] = x;
+        x += 1.0 + 0.3 * static_cast<Real>((i * 7) % 11) / 11.0;
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+        e.xc[i] = 0.5 * (e.xf[i] + e.xf[i + 1]);
+        e.dF[i] = e.xf[i + 1] - e.xf[i];
+    }
+    e.dC[0] = e.xc[0] - e.xf[0];
+    for (std::size_t i = 1; i < N; ++i) e.dC[i] = e.xc[i] - e.xc[i - 1];
+    e.dC[N] = e.xf[N] - e.xc[N - 1];
+    return e;
+}
+
+void expect_same_basic(const Grid1DStats::Basic& a, const Grid1DStats::Basic& b) {
+    EXPECT_EQ(a.min, b.min);
+    EXPECT_EQ(a.max, b.max);
+    EXPECT_EQ(a.mean, b.mean);
+    EXPECT_EQ(a.stddev, b.stddev);
+    EXPECT_EQ(a.aspect, b.aspect);
+    EXPECT_EQ(a.cv, b.cv);
+}
+
+} // namespace
+
+static_assert(std::is_trivially_copyable_v<Grid1DView>);
+static_assert(std::is_convertible_v<const Grid1D&, Grid1DView>);
+static_assert(!std::is_convertible_v<Grid1D&&, Grid1DView>,
+              "visão de temporário deve ser rejeitada");
+
+TEST(Grid1DView, WrapsGridWithoutCopy) {
+    const auto e = make_external(100);
+    const Grid1D g(e.xf, e.xc, e.dF, e.dC);
+    const Grid1DView v = g;
+
+    EXPECT_EQ(v.faces().data(),         g.faces().data());
+    EXPECT_EQ(v.centers().data(),       g.centers().data());
+    EXPECT_EQ(v.deltasFaces().data(),   g.deltasFaces().data());
+    EXPECT_EQ(v.deltasCenters().data(), g.deltasCenters().data());
+    EXPECT_EQ(v.nVolumes(), g.nVolumes());
+    EXPECT_EQ(v.nFaces(),   g.nFaces());
+    for (Index i = 0; i < g.nVolumes(); ++i) {
+        EXPECT_EQ(v.face(i),        g.face(i));
+        EXPECT_EQ(v.center(i),      g.center(i));
+        EXPECT_EQ(v.deltaFace(i),   g.deltaFace(i));
+        EXPECT_EQ(v.deltaCenter(i), g.deltaCenter(i));
+    }
+    EXPECT_EQ(v.deltaCenter(g.nVolumes()), g.deltaCenter(g.nVolumes()));
+    EXPECT_EQ(v.face(g.nVolumes()),        g.face(g.nVolumes()));
+}
+
+TEST(Grid1DView, RawPointersAndEmpty) {
+    const auto e = make_external(37);
+    const Grid1DView v(e.xf.data(), e.xc.data(), e.dF.data(), e.dC.data(), 37);
+    EXPECT_EQ(v.nVolumes(), 37u);
+    EXPECT_EQ(v.nFaces(),   38u);
+    EXPECT_EQ(v.faces().data(), e.xf.data());
+    EXPECT_EQ(v.deltasCenters().size(), 38u);
+
+    const Grid1DView empty(nullptr, nullptr, nullptr, nullptr, 0);
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.nFaces(), 0u);
+    EXPECT_TRUE(Grid1DView{}.empty());
+    const Grid1D none{};
+    EXPECT_TRUE(none.view().empty());
+}
+
+TEST(Grid1DView, GridLikeStatsMatchGrid1D) {
+    const auto e = make_external(5003);
+    const Grid1D g(e.xf, e.xc, e.dF, e.dC);
+    const Grid1DView v(e.xf.data(), e.xc.data(), e.dF.data(), e.dC.data(), 5003);
+
+    EXPECT_EQ(Grid1DStats::faces(v).mean,   Grid1DStats::faces(g).mean);
+    EXPECT_EQ(Grid1DStats::centers(v).max,  Grid1DStats::centers(g).max);
+    expect_same_basic(Grid1DStats::basicFaces(v), Grid1DStats::basicFaces(g));
+    expect_same_basic(Grid1DStats::basic(v),      Grid1DStats::basic(g));
+    EXPECT_EQ(Grid1DStats::uniformidadeFaces(v), Grid1DStats::uniformidadeFaces(g));
+    EXPECT_EQ(Grid1DStats::adjacent(v).R,        Grid1DStats::adjacent(g).R);
+    EXPECT_EQ(Grid1DStats::smooth(v).max_grad,   Grid1DStats::smooth(g).max_grad);
+    EXPECT_EQ(Grid1DStats::edgeBalance(v).mean_interior,
+              Grid1DStats::edgeBalance(g).mean_interior);
+    EXPECT_EQ(Grid1DStats::symmetry(v).max_rel_diff,
+              Grid1DStats::symmetry(g).max_rel_diff);
+    EXPECT_EQ(Grid1DStats::geom(v).r_est, Grid1DStats::geom(g).r_est);
+
+    const auto rv = Grid1DStats::region(v, 100.0, 900.0);
+    const auto rg = Grid1DStats::region(g, 100.0, 900.0);
+    EXPECT_EQ(rv.count, rg.count);
+    EXPECT_EQ(rv.sum_lengths, rg.sum_lengths);
+
+    Grid1DStats::AllOptions opt{};
+    opt.bins = 16;
+    const auto sv = Grid1DStats::all(v, opt);
+    const auto sg = Grid1DStats::all(g, opt);
+    expect_same_basic(sv.basic, sg.basic);
+    EXPECT_EQ(sv.histogram.counts, sg.histogram.counts);
+    expect_same_basic(Grid1DStats::all(v).basic, Grid1DStats::all(g).basic);
+
+    for (auto p : {ExecPolicy::Serial, ExecPolicy::Parallel, ExecPolicy::Auto}) {
+        expect_same_basic(utils::basic_exec(v, p), utils::basic_exec(g, p));
+    }
+}
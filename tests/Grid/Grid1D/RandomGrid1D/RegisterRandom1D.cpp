@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 #include <any>
 #include <cstdio> // fprintf
+#include <span>
 
 #include <FVMGridMaker/Core/type.h>
 #include <FVMGridMaker/Grid/Common/Tags1D.hpp>
@@ -49,6 +50,12 @@ static void register_random1d_once() {
     e.centers_fn = [](Index n, Real A, Real B, const std::any* any_opt) {
         return dist::Random1D::centers(n, A, B, any_opt);
     };
+    e.fill_faces_fn = [](Index n, Real A, Real B, std::span<Real> xf, const std::any* any_opt) {
+        dist::Random1D::faces_into(n, A, B, xf, any_opt);
+    };
+    e.fill_centers_fn = [](Index n, Real A, Real B, std::span<Real> xc, const std::any* any_opt) {
+        dist::Random1D::centers_into(n, A, B, xc, any_opt);
+    };
 
     auto& reg = Grid1DDistributionRegistry::instance();
     reg.registerDistribution("Random1D", std::move(e), DistributionTag::Random1D);
@@ -1,5 +1,6 @@
 // tests/Grid/Grid1D/RandomGrid1D/ut_RandomGrid1D.cpp
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <numeric>
 #include <vector>
 
@@ -68,3 +69,150 @@ TEST(RandomGrid1D, WidthsWithinBounds) {
     const Real sum_dF = std::accumulate(g.deltasFaces().begin(), g.deltasFaces().end(), Real(0));
     EXPECT_NEAR(sum_dF, B-A, Real(1e-9));
 }
+
+TEST(RandomGrid1D, BuildIntoMatchesBuild) {
+    constexpr Index N = 300;
+    Random1D::Options opt{};
+    opt.w_lo = 0.5; opt.w_hi = 1.5; opt.seed = 42u;
+
+    for (CenteringTag c : {CenteringTag::FaceCentered, CenteringTag::CellCentered}) {
+        const auto builder = FVMGridMaker::grid::grid1d::builders::Grid1DBuilder{}
+                                .setN(N).setDomain(-1.0, 3.0)
+                                .setDistribution(DistributionTag::Random1D)
+                                .setCentering(c)
+                                .setOption(opt);
+        const auto g = builder.build();
+
+        std::vector<Real> xf(N + 1), xc(N), dF(N), dC(N + 1);
+        builder.buildInto(xf, xc, dF, dC);
+
+        EXPECT_EQ(xf, as_vec(g.faces()));
+        EXPECT_EQ(xc, as_vec(g.centers()));
+        EXPECT_EQ(dF, as_vec(g.deltasFaces()));
+        EXPECT_EQ(dC, as_vec(g.deltasCenters()));
+    }
+
+    // faces_into/centers_into == versões que retornam vetor
+    std::vector<Real> xf(N + 1), xc(N);
+    Random1D::faces_into(N, -1.0, 3.0, xf, &opt);
+    Random1D::centers_into(N, -1.0, 3.0, xc, &opt);
+    EXPECT_EQ(xf, Random1D::faces(N, -1.0, 3.0, &opt));
+    EXPECT_EQ(xc, Random1D::centers(N, -1.0, 3.0, &opt));
+}
+
+TEST(RandomGrid1D, ParallelClosureMatchesSerial) {
+    using FVMGridMaker::core::ExecPolicy;
+    constexpr Index N = 100003;   // não múltiplo do número de blocos
+    Random1D::Options opt{};
+    opt.w_lo = 0.5; opt.w_hi = 1.5; opt.seed = 7u;
+
+    for (CenteringTag c : {CenteringTag::FaceCentered, CenteringTag::CellCentered}) {
+        auto builder = FVMGridMaker::grid::grid1d::builders::Grid1DBuilder{}
+                          .setN(N).setDomain(0.0, 1.0)
+                          .setDistribution(DistributionTag::Random1D)
+                          .setCentering(c)
+                          .setOption(opt);
+        const auto gs = builder.setExecPolicy(ExecPolicy::Serial).build();
+        const auto gp = builder.setExecPolicy(ExecPolicy::Parallel).build();
+
+        EXPECT_EQ(as_vec(gs.faces()),         as_vec(gp.faces()));
+        EXPECT_EQ(as_vec(gs.centers()),       as_vec(gp.centers()));
+        EXPECT_EQ(as_vec(gs.deltasFaces()),   as_vec(gp.deltasFaces()));
+        EXPECT_EQ(as_vec(gs.deltasCenters()), as_vec(gp.deltasCenters()));
+    }
+}
+
+TEST(RandomGrid1D, CounterBasedIsThreadCountInvariant) {
+    using FVMGridMaker::core::ExecPolicy;
+    constexpr Index N = 200001;
+    Random1D::Options opt{};
+    opt.w_lo = 0.6; opt.w_hi = 1.4; opt.seed = 2024u;
+    opt.policy = Random1D::Options::Policy::CounterBased;
+
+    opt.exec = ExecPolicy::Serial;
+    const auto xs = Random1D::faces(N, 0.0, 1.0, &opt);
+    opt.exec = ExecPolicy::Parallel;
+    const auto xp = Random1D::faces(N, 0.0, 1.0, &opt);
+    EXPECT_EQ(xs, xp);
+
+    // pesos dependem só de (seed, i)
+    EXPECT_EQ(Random1D::counter_uniform(2024u, 17u), Random1D::counter_uniform(2024u, 17u));
+    EXPECT_NE(Random1D::counter_uniform(2024u, 17u), Random1D::counter_uniform(2025u, 17u));
+    EXPECT_NE(Random1D::counter_uniform(2024u, 17u), Random1D::counter_uniform(2024u, 18u));
+
+    // cotas e fechamento no domínio
+    const Real dx0 = 1.0 / static_cast<Real>(N);
+    for (std::size_t i = 0; i + 1 < xs.size(); ++i) {
+        const Real d = xs[i + 1] - xs[i];
+        ASSERT_GE(d, 0.6 * dx0 * (1.0 - 1e-9));
+        ASSERT_LE(d, 1.4 * dx0 * (1.0 + 1e-9));
+    }
+    EXPECT_EQ(xs.front(), 0.0);
+    EXPECT_EQ(xs.back(),  1.0);
+
+    // outra semente → outra malha
+    opt.seed = 2025u;
+    EXPECT_NE(Random1D::faces(N, 0.0, 1.0, &opt), xs);
+}
+
+TEST(RandomGrid1D, ProjectionIsProportionalClampOnLargeTightBand) {
+    using FVMGridMaker::core::ExecPolicy;
+    constexpr Index N = 200000;
+    constexpr Real lo = 0.999, hi = 1.001;
+    Random1D::Options opt{};
+    opt.w_lo = lo; opt.w_hi = hi; opt.seed = 99u;
+    opt.policy = Random1D::Options::Policy::CounterBased;
+
+    opt.exec = ExecPolicy::Serial;
+    const auto xs = Random1D::faces(N, 0.0, 1.0, &opt);
+    opt.exec = ExecPolicy::Parallel;
+    EXPECT_EQ(Random1D::faces(N, 0.0, 1.0, &opt), xs);
+
+    // x_i = clamp(s·r_i, lo, hi): razão x_i/r_i comum entre os livres
+    const Real dx0 = 1.0 / static_cast<Real>(N);
+    Real s_min = 1e300, s_max = -1e300;
+    for (std::size_t i = 0; i + 1 < xs.size(); ++i) {
+        const Real x = (xs[i + 1] - xs[i]) / dx0;
+        ASSERT_GE(x, lo * (1.0 - 1e-9));
+        ASSERT_LE(x, hi * (1.0 + 1e-9));
+        if (x > lo * (1.0 + 1e-6) && x < hi * (1.0 - 1e-6)) {
+            const Real r = lo + (hi - lo) * Random1D::counter_uniform(99u, i);
+            s_min = std::min(s_min, x / r);
+            s_max = std::max(s_max, x / r);
+        }
+    }
+    ASSERT_LE(s_min, s_max);
+    EXPECT_NEAR(s_min, s_max, 1e-6);
+    EXPECT_EQ(xs.back(), 1.0);
+}
+
+TEST(RandomGrid1D, ScannedFacesCloseOnDomainWithoutOverride) {
+    using FVMGridMaker::core::ExecPolicy;
+    constexpr Index N = 150001;
+    constexpr Real A = 0.1, B = 0.7;   // B-A não é exato em binário
+
+    for (auto policy : {Random1D::Options::Policy::BoundedProject,
+                        Random1D::Options::Policy::CounterBased}) {
+        Random1D::Options opt{};
+        opt.w_lo = 0.3; opt.w_hi = 2.0; opt.seed = 5u; opt.policy = policy;
+
+        opt.exec = ExecPolicy::Serial;
+        const auto xf = Random1D::faces(N, A, B, &opt);
+        const auto xc = Random1D::centers(N, A, B, &opt);
+        opt.exec = ExecPolicy::Parallel;
+        EXPECT_EQ(Random1D::faces(N, A, B, &opt), xf);
+        EXPECT_EQ(Random1D::centers(N, A, B, &opt), xc);
+
+        ASSERT_EQ(xf.size(), static_cast<std::size_t>(N) + 1u);
+        EXPECT_EQ(xf.front(), A);
+        EXPECT_EQ(xf.back(),  B);
+
+        const Real dx0 = (B - A) / static_cast<Real>(N);
+        for (std::size_t i = 0; i < xc.size(); ++i) {
+            const Real d = xf[i + 1] - xf[i];
+            ASSERT_GE(d, 0.3 * dx0 * (1.0 - 1e-9));
+            ASSERT_LE(d, 2.0 * dx0 * (1.0 + 1e-9));
+            ASSERT_EQ(xc[i], 0.5 * (xf[i] + xf[i + 1]));
+        }
+    }
+}
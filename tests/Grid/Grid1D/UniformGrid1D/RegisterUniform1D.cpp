@@ -8,11 +8,13 @@
 #include <gtest/gtest.h>
 #include <any>
 #include <cstdio>   // std::fprintf, stderr
+#include <span>
 #include <vector>
 
 #include <FVMGridMaker/Core/type.h>
 #include <FVMGridMaker/Grid/Common/Tags1D.hpp>
 #include <FVMGridMaker/Grid/Grid1D/Builders/Grid1DDistributionRegistry.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Uniform1D.hpp>
 
 using FVMGridMaker::core::Index;
 using FVMGridMaker::core::Real;
@@ -61,6 +63,14 @@ static void register_uniform1d_once() {
         return xc;
     };
 
+    // Variantes in-place (usadas por build()/buildInto() sem alocação)
+    e.fill_faces_fn = [](Index n, Real A, Real B, std::span<Real> xf, const std::any*) {
+        FVMGridMaker::grid::grid1d::patterns::distribution::Uniform1D{}.makeFaces(n, A, B, xf);
+    };
+    e.fill_centers_fn = [](Index n, Real A, Real B, std::span<Real> xc, const std::any*) {
+        FVMGridMaker::grid::grid1d::patterns::distribution::Uniform1D{}.makeCenters(n, A, B, xc);
+    };
+
     auto& reg = Grid1DDistributionRegistry::instance();
     reg.registerDistribution("Uniform1D", std::move(e), DistributionTag::Uniform1D);
 
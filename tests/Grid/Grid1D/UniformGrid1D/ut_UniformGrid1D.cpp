@@ -1,7 +1,7 @@
 // ----------------------------------------------------------------------------
 // File: ut_UniformGrid1D.cpp
 // Author: FVMGridMaker Team
-// Version: 2.5
+// Version: 2.7
 // Date: 2025-10-26
 // Description: Testes de unidade para Grid1D (Uniform × Face/Cell Centered)
 //              usando gtest + gmock (matchers com tolerância).
@@ -19,6 +19,7 @@
 // includes C++
 // ----------------------------------------------------------------------------
 #include <algorithm>
+#include <cmath>
 #include <numeric>
 #include <type_traits>
 #include <vector>
@@ -322,3 +323,86 @@ TEST(Grid1D_Uniform, DxCentro_BorderFormulas_BothCenterings) {
     check(CenteringTag::FaceCentered);
     check(CenteringTag::CellCentered);
 }
+
+// -----------------------------------------------------------------------------
+// CENÁRIO 7: buildInto em buffers do chamador == build()
+// -----------------------------------------------------------------------------
+TEST(Grid1D_Uniform, BuildInto_MatchesBuild_BothCenterings) {
+    for (CenteringTag centering : {CenteringTag::FaceCentered, CenteringTag::CellCentered}) {
+        const auto builder = Grid1DBuilder{}
+                                .setN(NVol)
+                                .setDomain(A, B)
+                                .setDistribution(DistributionTag::Uniform1D)
+                                .setCentering(centering);
+        const auto g = builder.build();
+
+        std::vector<Real> xf(NVol + 1), xc(NVol), dF(NVol), dC(NVol + 1);
+        builder.buildInto(xf, xc, dF, dC);
+
+        EXPECT_EQ(xf, std::vector<Real>(g.faces().begin(),         g.faces().end()));
+        EXPECT_EQ(xc, std::vector<Real>(g.centers().begin(),       g.centers().end()));
+        EXPECT_EQ(dF, std::vector<Real>(g.deltasFaces().begin(),   g.deltasFaces().end()));
+        EXPECT_EQ(dC, std::vector<Real>(g.deltasCenters().begin(), g.deltasCenters().end()));
+    }
+}
+
+TEST(Grid1D_Uniform, BuildInto_WrongSizes_Throws) {
+    const auto builder = Grid1DBuilder{}.setN(NVol).setDomain(A, B)
+                            .setDistribution(DistributionTag::Uniform1D);
+
+    std::vector<Real> xf(NVol), xc(NVol), dF(NVol), dC(NVol + 1);   // xf curto
+    EXPECT_THROW(builder.buildInto(xf, xc, dF, dC), FVMGridMaker::error::FVMGException);
+}
+
+// -----------------------------------------------------------------------------
+// CENÁRIO 8: fechamento paralelo == serial (bit a bit), inclusive N pequeno
+// -----------------------------------------------------------------------------
+TEST(Grid1D_Uniform, ExecPolicy_ParallelMatchesSerial) {
+    using FVMGridMaker::core::ExecPolicy;
+    for (Index n : {Index(1), Index(3), Index(NVol), Index(65537)}) {
+        for (CenteringTag centering : {CenteringTag::FaceCentered, CenteringTag::CellCentered}) {
+            auto builder = Grid1DBuilder{}.setN(n).setDomain(A, B)
+                              .setDistribution(DistributionTag::Uniform1D)
+                              .setCentering(centering);
+            const auto gs = builder.setExecPolicy(ExecPolicy::Serial).build();
+            const auto gp = builder.setExecPolicy(ExecPolicy::Parallel).build();
+
+            EXPECT_EQ(std::vector<Real>(gs.faces().begin(), gs.faces().end()),
+                      std::vector<Real>(gp.faces().begin(), gp.faces().end()));
+            EXPECT_EQ(std::vector<Real>(gs.centers().begin(), gs.centers().end()),
+                      std::vector<Real>(gp.centers().begin(), gp.centers().end()));
+            EXPECT_EQ(std::vector<Real>(gs.deltasFaces().begin(), gs.deltasFaces().end()),
+                      std::vector<Real>(gp.deltasFaces().begin(), gp.deltasFaces().end()));
+            EXPECT_EQ(std::vector<Real>(gs.deltasCenters().begin(), gs.deltasCenters().end()),
+                      std::vector<Real>(gp.deltasCenters().begin(), gp.deltasCenters().end()));
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// CENÁRIO 9: validação durante o build (setValidation)
+// -----------------------------------------------------------------------------
+TEST(Grid1D_Uniform, ValidationDuringBuild) {
+    using FVMGridMaker::core::ExecPolicy;
+    for (CenteringTag centering : {CenteringTag::FaceCentered, CenteringTag::CellCentered}) {
+        // malha válida: mesmo resultado com e sem validação
+        auto builder = Grid1DBuilder{}.setN(65537).setDomain(A, B)
+                          .setDistribution(DistributionTag::Uniform1D)
+                          .setCentering(centering)
+                          .setExecPolicy(ExecPolicy::Parallel);
+        const auto g0 = builder.build();
+        const auto g1 = builder.setValidation(true).build();
+        EXPECT_EQ(std::vector<Real>(g0.deltasCenters().begin(), g0.deltasCenters().end()),
+                  std::vector<Real>(g1.deltasCenters().begin(), g1.deltasCenters().end()));
+
+        // domínio de poucos ulps: faces/centros se repetem após arredondar
+        const Real a0 = 1.0;
+        const Real b0 = std::nextafter(std::nextafter(a0, 2.0), 2.0);
+        auto tiny = Grid1DBuilder{}.setN(64).setDomain(a0, b0)
+                       .setDistribution(DistributionTag::Uniform1D)
+                       .setCentering(centering);
+        EXPECT_NO_THROW((void)tiny.build());
+        EXPECT_THROW((void)tiny.setValidation(true).build(),
+                     FVMGridMaker::error::FVMGException);
+    }
+}
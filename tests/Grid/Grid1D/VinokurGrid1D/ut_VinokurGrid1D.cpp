@@ -0,0 +1,191 @@
+// ----------------------------------------------------------------------------
+// File: ut_VinokurGrid1D.cpp
+// Author: FVMGridMaker Team
+// Version: 1.2
+// Date: 2025-10-27
+// Description: Testes de unidade da distribuição Vinokur1D: larguras da
+//              primeira e da última célula atingidas pelo Newton, kernel
+//              contra referência em long double, ramos hiperbólico,
+//              trigonométrico e linear, alvos inatingíveis (N = 1, 2)
+//              rejeitados. Política de execução e builders:
+//              ut_FaceKernelDistribution1D.
+// License: GNU GPL v3
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// includes FVMGridMaker
+// ----------------------------------------------------------------------------
+#include <FVMGridMaker/Core/ExecPolicy.hpp>
+#include <FVMGridMaker/Core/type.h>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/ConceptsDistribution.hpp>
+#include <FVMGridMaker/Grid/Grid1D/Patterns/Distribution/Vinokur1D.hpp>
+
+// ----------------------------------------------------------------------------
+// includes C++
+// ----------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using Real  = FVMGridMaker::core::Real;
+using Index = FVMGridMaker::core::Index;
+using FVMGridMaker::core::ExecPolicy;
+using FVMGridMaker::grid::grid1d::patterns::distribution::Distribution1D;
+using FVMGridMaker::grid::grid1d::patterns::distribution::Vinokur1D;
+
+static_assert(Distribution1D<Vinokur1D>);
+
+namespace {
+
+constexpr Real kEps = std::numeric_limits<Real>::epsilon();
+
+Vinokur1D::Options opts(Real d0, Real d1, ExecPolicy exec = ExecPolicy::Auto) {
+    Vinokur1D::Options o{};
+    o.first_width = d0;
+    o.last_width  = d1;
+    o.exec        = exec;
+    return o;
+}
+
+struct Case { Index n; Real d0, d1; Vinokur1D::Kind kind; };
+
+// Hiperbólico (pontas finas), trigonométrico (pontas grossas) e extremos
+const Case kCases[] = {
+    {100,     1e-5,  1e-3,  Vinokur1D::Kind::Hyperbolic},
+    {100,     1e-3,  1e-3,  Vinokur1D::Kind::Hyperbolic},
+    {64,      1e-8,  1e-2,  Vinokur1D::Kind::Hyperbolic},
+    {1000,    1e-7,  1e-7,  Vinokur1D::Kind::Hyperbolic},
+    {400,     1e-6,  0.02,  Vinokur1D::Kind::Hyperbolic},
+    {100,     1e-3,  0.5,   Vinokur1D::Kind::Trigonometric},
+    {50,      0.05,  0.05,  Vinokur1D::Kind::Trigonometric},
+    {10,      0.3,   0.3,   Vinokur1D::Kind::Trigonometric},
+    {3,       0.45,  0.45,  Vinokur1D::Kind::Trigonometric},
+    {100000,  1e-9,  1e-9,  Vinokur1D::Kind::Hyperbolic},
+};
+
+// Referência: mesma família (δ, α) avaliada em long double, pela ponta
+// mais próxima
+long double ref_face(std::size_t i, std::size_t N, const Vinokur1D::Stretching& s,
+                     long double A, long double B) {
+    const long double q = static_cast<long double>(s.delta) / static_cast<long double>(N);
+    auto S = [&](std::size_t k) {
+        const long double x = static_cast<long double>(k);
+        switch (s.kind) {
+            case Vinokur1D::Kind::Hyperbolic:    return std::sinh(x * q);
+            case Vinokur1D::Kind::Trigonometric: return std::sin(x * q);
+            default:                             return x;
+        }
+    };
+    const long double a = S(i), r = static_cast<long double>(s.alpha) * S(N - i);
+    return (2u * i <= N) ? A + (B - A) * (a / (a + r)) : B - (B - A) * (r / (a + r));
+}
+
+} // namespace
+
+TEST(Vinokur1D, EndWidthsMatchTargets) {
+    for (const auto& c : kCases) {
+        SCOPED_TRACE(testing::Message() << "N=" << c.n << " d0=" << c.d0 << " d1=" << c.d1);
+        const auto s = Vinokur1D::stretching(c.n, c.d0, c.d1);
+        EXPECT_EQ(s.kind, c.kind);
+
+        // Larguras relativas a 1e-12, limitadas pela resolução de A e B
+        const Real L   = 3.0;
+        const Real ulp = 2 * kEps * 2.0;
+        const auto o   = opts(c.d0, c.d1);
+        const auto xf  = Vinokur1D::faces(c.n, -1.0, 2.0, &o);
+        EXPECT_NEAR(xf[1] - xf[0],         c.d0 * L, 1e-12 * c.d0 * L + ulp);
+        EXPECT_NEAR(xf[c.n] - xf[c.n - 1], c.d1 * L, 1e-12 * c.d1 * L + ulp);
+        EXPECT_EQ(xf.front(), -1.0);
+        EXPECT_EQ(xf.back(),   2.0);
+        for (std::size_t i = 0; i < c.n; ++i) ASSERT_LT(xf[i], xf[i + 1]) << "i=" << i;
+    }
+}
+
+TEST(Vinokur1D, MatchesLongDoubleReference) {
+    for (const auto& c : kCases) {
+        SCOPED_TRACE(testing::Message() << "N=" << c.n << " d0=" << c.d0 << " d1=" << c.d1);
+        const auto s  = Vinokur1D::stretching(c.n, c.d0, c.d1);
+        const auto o  = opts(c.d0, c.d1);
+        const auto xf = Vinokur1D::faces(c.n, 0.0, 1.0, &o);
+        // Erro relativo à distância até a ponta mais próxima (células
+        // pequenas junto de A e B mantêm seus dígitos)
+        for (std::size_t i = 1; i < c.n; ++i) {
+            const long double ref  = ref_face(i, c.n, s, 0.0L, 1.0L);
+            const long double dist = std::min(ref, 1.0L - ref);
+            const long double err  = std::abs(static_cast<long double>(xf[i]) - ref);
+            ASSERT_LE(err, 64.0L * kEps * dist + kEps) << "i=" << i;
+        }
+    }
+}
+
+TEST(Vinokur1D, SymmetricWidthsGiveSymmetricGrid) {
+    const Index N = 257;
+    const auto  o  = opts(1e-4, 1e-4);
+    const auto  xf = Vinokur1D::faces(N, 0.0, 1.0, &o);
+    EXPECT_NEAR(Vinokur1D::stretching(N, 1e-4, 1e-4).alpha, 1.0, 1e-12);
+    for (std::size_t i = 0; i <= N; ++i) {
+        EXPECT_NEAR(xf[i], 1.0 - xf[N - i], 16 * kEps) << "i=" << i;
+    }
+}
+
+TEST(Vinokur1D, UniformWidthsGiveUniformGrid) {
+    const Index N = 40;
+    const auto  s = Vinokur1D::stretching(N, 1.0 / 40.0, 1.0 / 40.0);
+    EXPECT_EQ(s.kind, Vinokur1D::Kind::Linear);
+    const auto o  = opts(1.0 / 40.0, 1.0 / 40.0);
+    const auto xf = Vinokur1D::faces(N, 0.0, 2.0, &o);
+    for (std::size_t i = 0; i <= N; ++i) {
+        EXPECT_NEAR(xf[i], 2.0 * static_cast<Real>(i) / 40.0, 4 * kEps) << "i=" << i;
+    }
+}
+
+TEST(Vinokur1D, SmallGrids) {
+    // N = 1: a única célula mede L, nenhum alvo < 1 é atingível
+    std::vector<Real> xf1(2);
+    for (const auto& o : {opts(0.2, 0.6), opts(0.5, 0.5)}) {
+        EXPECT_THROW((void)Vinokur1D::stretching(1, o.first_width, o.last_width),
+                     std::invalid_argument);
+        EXPECT_THROW(Vinokur1D::faces_into(1, 0.0, 1.0, xf1, &o), std::invalid_argument);
+    }
+
+    // N = 2: só d0 + d1 = 1 é atingível; a face interna fica em d0
+    std::vector<Real> xf2(3);
+    const auto o2 = opts(0.2, 0.6);
+    EXPECT_THROW((void)Vinokur1D::stretching(2, 0.2, 0.6), std::invalid_argument);
+    EXPECT_THROW(Vinokur1D::faces_into(2, 0.0, 1.0, xf2, &o2), std::invalid_argument);
+    for (Real d0 : {0.25, 0.3, 0.5}) {
+        const auto o = opts(d0, 1.0 - d0);
+        Vinokur1D::faces_into(2, 0.0, 4.0, xf2, &o);
+        EXPECT_EQ(xf2.front(), 0.0);
+        EXPECT_EQ(xf2.back(),  4.0);
+        EXPECT_NEAR(xf2[1], 4.0 * d0, 8 * kEps) << "d0=" << d0;
+    }
+
+    // Soma 1 só vale para N = 2
+    EXPECT_THROW((void)Vinokur1D::stretching(3, 0.25, 0.75), std::invalid_argument);
+
+    const auto o3  = opts(0.2, 0.3);
+    const auto xf3 = Vinokur1D::faces(3, 0.0, 1.0, &o3);
+    EXPECT_NEAR(xf3[1], 0.2, 1e-12);
+    EXPECT_NEAR(xf3[2], 0.7, 1e-12);
+}
+
+TEST(Vinokur1D, InvalidInputsThrow) {
+    std::vector<Real> xf(11);
+    const Real nan = std::numeric_limits<Real>::quiet_NaN();
+    for (const auto& o : {opts(0.0, 0.1), opts(0.1, -0.1), opts(0.6, 0.4), opts(0.7, 0.4), opts(nan, 0.1)}) {
+        EXPECT_THROW(Vinokur1D::faces_into(10, 0.0, 1.0, xf, &o), std::invalid_argument);
+    }
+    // Exigiria δ > kMaxDelta
+    const auto extreme = opts(1e-300, 1e-300);
+    EXPECT_THROW(Vinokur1D::faces_into(10, 0.0, 1.0, xf, &extreme), std::invalid_argument);
+
+    EXPECT_THROW(Vinokur1D::faces_into(0, 0.0, 1.0, xf), std::invalid_argument);
+    EXPECT_THROW(Vinokur1D::faces_into(10, 1.0, 1.0, xf), std::invalid_argument);
+    EXPECT_THROW(Vinokur1D::faces_into(9, 0.0, 1.0, xf), std::invalid_argument);
+}